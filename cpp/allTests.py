@@ -62,6 +62,7 @@ tests = [
     ("Ice/timeout", ["core"]),
     ("Ice/background", ["core", "nomingw"]),
     ("Ice/servantLocator", ["core"]),
+    ("Ice/servantLookup", ["once"]),
     ("Ice/interceptor", ["core"]),
     ("Ice/stringConverter", ["core"]),
     ("Ice/udp", ["core"]),
@@ -70,6 +71,7 @@ tests = [
     ("Ice/invoke", ["core"]),
     ("Ice/plugin", ["core", "nomingw"]),
     ("Ice/hash", ["once"]),
+    ("Ice/refCount", ["once"]),
     ("Ice/admin", ["core", "noipv6"]),
     ("Ice/metrics", ["core", "nossl", "noipv6", "nocompress", "nomingw", "nosocks"]),
     ("Ice/enums", ["once"]),
@@ -81,6 +83,7 @@ tests = [
     ("Freeze/evictor", ["core", "novc90", "nomingw"]),
     ("Freeze/fileLock", ["core", "novc90", "nomingw"]),
     ("IceStorm/single", ["service", "novc90", "noappverifier", "nomingw"]), # This test doesn't work with appverifier
+    ("IceStorm/durable", ["service", "novc90", "nowin32"]),
     ("IceStorm/federation", ["service", "novc90", "nomingw"]),
     ("IceStorm/federation2", ["service", "novc90", "nomingw"]),
     ("IceStorm/stress", ["service", "stress", "novc90", "noappverifier", "nomingw"]), # Too slow with appverifier.
@@ -0,0 +1,95 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <Dispatch.h>
+
+using namespace std;
+using namespace Demo;
+
+class DispatchClient : public Ice::Application
+{
+public:
+
+    virtual int run(int, char*[]);
+};
+
+int
+main(int argc, char* argv[])
+{
+    DispatchClient app;
+    return app.main(argc, argv, "config.client");
+}
+
+int
+DispatchClient::run(int argc, char* argv[])
+{
+    if(argc > 1)
+    {
+        cerr << appName() << ": too many arguments" << endl;
+        return EXIT_FAILURE;
+    }
+
+    LargePrx large = LargePrx::checkedCast(communicator()->propertyToProxy("Large.Proxy"));
+    if(!large)
+    {
+        cerr << argv[0] << ": invalid proxy" << endl;
+        return EXIT_FAILURE;
+    }
+
+    //
+    // The names of the operations of the Large interface.
+    //
+    const char* verbs[] = { "get", "set", "add", "remove", "find", "list", "update", "reset" };
+    const char* nouns[] = { "Account", "Balance", "Customer", "Order", "Item", "Price", "Quantity", "Address",
+                            "Name", "Status", "Owner", "Limit", "Rate", "Currency", "Date", "Note" };
+    vector<string> operations;
+    for(size_t i = 0; i < sizeof(nouns) / sizeof(nouns[0]); ++i)
+    {
+        for(size_t j = 0; j < sizeof(verbs) / sizeof(verbs[0]); ++j)
+        {
+            operations.push_back(string(verbs[j]) + nouns[i]);
+        }
+    }
+
+    //
+    // The requests are sent in batches to keep the server busy
+    // dispatching, and a twoway ping after each batch waits for the
+    // server to dispatch the batch. The time per request is mostly
+    // the time the server spends reading and dispatching the request.
+    //
+    Ice::ObjectPrx batch = large->ice_batchOneway();
+    const Ice::ByteSeq inParams;
+    Ice::ByteSeq outParams;
+    const int batchSize = 1000;
+    const int batches = 1000;
+
+    large->ice_ping();
+
+    cout << "dispatching " << batches * batchSize << " requests to " << operations.size()
+         << " operations (this may take a while)" << endl;
+
+    IceUtil::Time tm = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < batches; ++i)
+    {
+        for(int j = 0; j < batchSize; ++j)
+        {
+            batch->ice_invoke(operations[(i * batchSize + j) % operations.size()], Ice::Normal, inParams,
+                              outParams);
+        }
+        batch->ice_flushBatchRequests();
+        large->ice_ping();
+    }
+    tm = IceUtil::Time::now(IceUtil::Time::Monotonic) - tm;
+
+    cout << "time for " << batches * batchSize << " requests: " << tm * 1000 << "ms" << endl;
+    cout << "time per request: " << tm.toMicroSecondsDouble() / (batches * batchSize) << "us" << endl;
+
+    return EXIT_SUCCESS;
+}
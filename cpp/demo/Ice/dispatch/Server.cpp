@@ -0,0 +1,80 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <Dispatch.h>
+
+using namespace std;
+using namespace Demo;
+
+//
+// The operations don't do anything, the cost of a request is the cost
+// of reading and dispatching it.
+//
+#define OPERATIONS(noun) \
+    virtual void get##noun(const Ice::Current&) {} \
+    virtual void set##noun(const Ice::Current&) {} \
+    virtual void add##noun(const Ice::Current&) {} \
+    virtual void remove##noun(const Ice::Current&) {} \
+    virtual void find##noun(const Ice::Current&) {} \
+    virtual void list##noun(const Ice::Current&) {} \
+    virtual void update##noun(const Ice::Current&) {} \
+    virtual void reset##noun(const Ice::Current&) {}
+
+class LargeI : public Large
+{
+public:
+
+    OPERATIONS(Account)
+    OPERATIONS(Balance)
+    OPERATIONS(Customer)
+    OPERATIONS(Order)
+    OPERATIONS(Item)
+    OPERATIONS(Price)
+    OPERATIONS(Quantity)
+    OPERATIONS(Address)
+    OPERATIONS(Name)
+    OPERATIONS(Status)
+    OPERATIONS(Owner)
+    OPERATIONS(Limit)
+    OPERATIONS(Rate)
+    OPERATIONS(Currency)
+    OPERATIONS(Date)
+    OPERATIONS(Note)
+};
+
+class DispatchServer : public Ice::Application
+{
+public:
+
+    virtual int run(int, char*[]);
+};
+
+int
+main(int argc, char* argv[])
+{
+    DispatchServer app;
+    return app.main(argc, argv, "config.server");
+}
+
+int
+DispatchServer::run(int argc, char*[])
+{
+    if(argc > 1)
+    {
+        cerr << appName() << ": too many arguments" << endl;
+        return EXIT_FAILURE;
+    }
+
+    Ice::ObjectAdapterPtr adapter = communicator()->createObjectAdapter("Dispatch");
+    adapter->add(new LargeI, communicator()->stringToIdentity("large"));
+    adapter->activate();
+    communicator()->waitForShutdown();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <Graph.h>
+
+using namespace std;
+using namespace Demo;
+
+class GraphClient : public Ice::Application
+{
+public:
+
+    virtual int run(int, char*[]);
+
+private:
+
+    void measure(const string&, const NodePtr&, int);
+    void measure(const string&, const NodePtr&, int, const Ice::EncodingVersion&);
+};
+
+int
+main(int argc, char* argv[])
+{
+    GraphClient app;
+    return app.main(argc, argv);
+}
+
+namespace
+{
+
+//
+// A list of nodes, each node references the next one. The 1.1
+// encoding marshals the nodes recursively, the depth must remain
+// reasonable.
+//
+NodePtr
+createList(int size)
+{
+    NodePtr head = new Node(0, NodeSeq());
+    NodePtr tail = head;
+    for(int i = 1; i < size; ++i)
+    {
+        NodePtr n = new Node(i, NodeSeq());
+        tail->children.push_back(n);
+        tail = n;
+    }
+    return head;
+}
+
+//
+// A root node with many leaf nodes.
+//
+NodePtr
+createTree(int size)
+{
+    NodePtr root = new Node(0, NodeSeq());
+    root->children.reserve(size);
+    for(int i = 1; i <= size; ++i)
+    {
+        root->children.push_back(new Node(i, NodeSeq()));
+    }
+    return root;
+}
+
+//
+// Layers of nodes, each node references several nodes of the next
+// layer and each node is referenced by several nodes of the previous
+// layer.
+//
+NodePtr
+createLayers(int layers, int width, int fanout)
+{
+    NodeSeq next;
+    for(int l = layers; l > 0; --l)
+    {
+        NodeSeq layer;
+        for(int i = 0; i < width; ++i)
+        {
+            NodePtr n = new Node(l * width + i, NodeSeq());
+            for(int j = 0; j < fanout && !next.empty(); ++j)
+            {
+                n->children.push_back(next[(i + j) % next.size()]);
+            }
+            layer.push_back(n);
+        }
+        next.swap(layer);
+    }
+    return new Node(0, next);
+}
+
+}
+
+int
+GraphClient::run(int argc, char* argv[])
+{
+    if(argc > 1)
+    {
+        cerr << appName() << ": too many arguments" << endl;
+        return EXIT_FAILURE;
+    }
+
+    measure("list of 500 nodes", createList(500), 1000);
+    measure("tree of 50000 nodes", createTree(50000), 20);
+    measure("100 layers of 100 nodes", createLayers(100, 100, 4), 20);
+
+    return EXIT_SUCCESS;
+}
+
+void
+GraphClient::measure(const string& name, const NodePtr& graph, int repetitions)
+{
+    cout << name << ":" << endl;
+    measure("1.0", graph, repetitions, Ice::Encoding_1_0);
+    measure("1.1", graph, repetitions, Ice::Encoding_1_1);
+}
+
+void
+GraphClient::measure(const string& name, const NodePtr& graph, int repetitions, const Ice::EncodingVersion& encoding)
+{
+    Ice::ByteSeq data;
+
+    IceUtil::Time tm = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < repetitions; ++i)
+    {
+        Ice::OutputStreamPtr out = Ice::createOutputStream(communicator(), encoding);
+        out->write(graph);
+        out->writePendingObjects();
+        out->finished(data);
+    }
+    IceUtil::Time marshal = IceUtil::Time::now(IceUtil::Time::Monotonic) - tm;
+
+    tm = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < repetitions; ++i)
+    {
+        Ice::InputStreamPtr in = Ice::createInputStream(communicator(), data, encoding);
+        NodePtr node;
+        in->read(node);
+        in->readPendingObjects();
+        assert(node && node->value == graph->value);
+    }
+    IceUtil::Time unmarshal = IceUtil::Time::now(IceUtil::Time::Monotonic) - tm;
+
+    cout << "  encoding " << name << ": " << data.size() << " bytes, "
+         << "marshal " << marshal.toMilliSecondsDouble() / repetitions << "ms, "
+         << "unmarshal " << unmarshal.toMilliSecondsDouble() / repetitions << "ms" << endl;
+}
@@ -9,6 +9,7 @@
 
 #include <Ice/Ice.h>
 #include <Latency.h>
+#include <ctime>
 
 using namespace std;
 using namespace Demo;
@@ -47,6 +48,7 @@ LatencyClient::run(int argc, char* argv[])
     ping->ice_ping();
 
     IceUtil::Time tm = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    clock_t cpu = clock();
 
     const int repetitions = 100000;
     cout << "pinging server " << repetitions << " times (this may take a while)" << endl;
@@ -56,9 +58,42 @@ LatencyClient::run(int argc, char* argv[])
     }
 
     tm = IceUtil::Time::now(IceUtil::Time::Monotonic) - tm;
+    cpu = clock() - cpu;
 
     cout << "time for " << repetitions << " pings: " << tm * 1000 << "ms" << endl;
     cout << "time per ping: " << tm * 1000 / repetitions << "ms" << endl;
+    cout << "client CPU time per ping: " << static_cast<double>(cpu) * 1000 / CLOCKS_PER_SEC / repetitions << "ms"
+         << endl;
+
+    //
+    // Keep many asynchronous requests pending on the connection, the
+    // cost of each reply includes looking up its request.
+    //
+    const int outstanding = 10000;
+    const int bursts = 10;
+    cout << "pinging server " << bursts << " times with " << outstanding << " outstanding asynchronous requests"
+         << endl;
+    vector<Ice::AsyncResultPtr> results;
+    results.reserve(outstanding);
+
+    tm = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < bursts; ++i)
+    {
+        for(int j = 0; j < outstanding; ++j)
+        {
+            results.push_back(ping->begin_ice_ping());
+        }
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            ping->end_ice_ping(*p);
+        }
+        results.clear();
+    }
+
+    tm = IceUtil::Time::now(IceUtil::Time::Monotonic) - tm;
+
+    cout << "time for " << bursts * outstanding << " asynchronous pings: " << tm * 1000 << "ms" << endl;
+    cout << "time per asynchronous ping: " << tm * 1000 / (bursts * outstanding) << "ms" << endl;
 
     return EXIT_SUCCESS;
 }
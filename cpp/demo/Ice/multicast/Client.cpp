@@ -66,6 +66,7 @@ public:
 private:
 
     void menu();
+    int benchmark(const HelloPrx&, const DiscoverPrx&, int, int);
 };
 
 int
@@ -104,5 +105,66 @@ HelloClient::run(int argc, char* argv[])
 
     hello->sayHello();
 
+    if(args.size() > 1 && args[1] == "bench")
+    {
+        int count = args.size() > 2 ? atoi(args[2].c_str()) : 100000;
+        int size = args.size() > 3 ? atoi(args[3].c_str()) : 64;
+        if(count <= 0 || size < 0)
+        {
+            cerr << argv[0] << ": usage: " << argv[0] << " [bench [count [size]]]" << endl;
+            return EXIT_FAILURE;
+        }
+        return benchmark(hello, discover, count, size);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int
+HelloClient::benchmark(const HelloPrx& hello, const DiscoverPrx& discover, int count, int size)
+{
+    //
+    // The datagrams are sent to the multicast endpoint of the sink,
+    // the results are collected from the sink of the server which
+    // replied to the discovery request.
+    //
+    SinkPrx sink = SinkPrx::uncheckedCast(hello->ice_identity(communicator()->stringToIdentity("sink")));
+    SinkPrx sinkDatagram = SinkPrx::uncheckedCast(discover->ice_identity(communicator()->stringToIdentity("sink")));
+    sink->reset();
+
+    cout << "sending " << count << " datagrams of " << size << " bytes... " << flush;
+    ByteSeq data(size);
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < count; ++i)
+    {
+        sinkDatagram->send(data);
+    }
+    IceUtil::Time sent = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    cout << "ok" << endl;
+    cout << "sent " << count / sent.toSecondsDouble() << " datagrams/s" << endl;
+
+    //
+    // Wait for the server to stop receiving datagrams, datagrams may
+    // be lost if the server can't keep up.
+    //
+    Ice::Int received = 0;
+    Ice::Long microseconds = 0;
+    while(true)
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        Ice::Int previous = received;
+        received = sink->received(microseconds);
+        if(received == count || received == previous)
+        {
+            break;
+        }
+    }
+
+    cout << "received " << received << " datagrams (" << (count - received) << " lost)";
+    if(microseconds > 0)
+    {
+        cout << ", " << received * 1000000.0 / microseconds << " datagrams/s";
+    }
+    cout << endl;
     return EXIT_SUCCESS;
 }
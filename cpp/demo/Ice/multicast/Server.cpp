@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <IceUtil/IceUtil.h>
 
 #include <Discovery.h>
 #include <Hello.h>
@@ -26,6 +27,48 @@ public:
     }
 };
 
+class SinkI : public Sink, public IceUtil::Mutex
+{
+public:
+
+    SinkI() :
+        _count(0)
+    {
+    }
+
+    virtual void
+    send(const ByteSeq&, const Ice::Current&)
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        _last = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(_count++ == 0)
+        {
+            _first = _last;
+        }
+    }
+
+    virtual void
+    reset(const Ice::Current&)
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        _count = 0;
+    }
+
+    virtual Ice::Int
+    received(Ice::Long& microseconds, const Ice::Current&)
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        microseconds = _count > 0 ? (_last - _first).toMicroSeconds() : 0;
+        return _count;
+    }
+
+private:
+
+    Ice::Int _count;
+    IceUtil::Time _first;
+    IceUtil::Time _last;
+};
+
 class DiscoverI : public Discover
 {
 public:
@@ -80,6 +123,14 @@ HelloServer::run(int argc, char* argv[])
     DiscoverPtr d = new DiscoverI(hello);
     discoverAdapter->add(d, communicator()->stringToIdentity("discover"));
 
+    //
+    // The sink receives the datagrams of the client benchmark on the
+    // multicast endpoint, the client collects the results over TCP.
+    //
+    SinkPtr sink = new SinkI;
+    discoverAdapter->add(sink, communicator()->stringToIdentity("sink"));
+    adapter->add(sink, communicator()->stringToIdentity("sink"));
+
     discoverAdapter->activate();
     adapter->activate();
 
@@ -12,9 +12,48 @@
 
 #include <iomanip>
 
+#ifndef _WIN32
+#   include <sys/resource.h>
+#endif
+
 using namespace std;
 using namespace Demo;
 
+namespace
+{
+
+//
+// Returns the CPU time (user and system) used by the client process
+// so far.
+//
+IceUtil::Time
+cpuTime()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if(!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    {
+        return IceUtil::Time();
+    }
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return IceUtil::Time::microSeconds(static_cast<IceUtil::Int64>((k.QuadPart + u.QuadPart) / 10)); // 100ns units
+#else
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return IceUtil::Time();
+    }
+    return IceUtil::Time::seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           IceUtil::Time::microSeconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+#endif
+}
+
+}
+
 class ThroughputClient : public Ice::Application
 {
 public:
@@ -84,6 +123,9 @@ ThroughputClient::run(int argc, char* argv[])
         fixedSeq[i].d = 0;
     }
 
+    DoubleSeq doubleSeq(DoubleStructSize, 3.14);
+    DoubleStruct doubleStruct;
+    doubleStruct.values = Ice::SequenceView<Ice::Double>(&doubleSeq[0], &doubleSeq[0] + doubleSeq.size());
 
     //
     // To allow cross-language tests we may need to "warm up" the
@@ -138,6 +180,23 @@ ThroughputClient::run(int argc, char* argv[])
         throughput->ice_ping(); // Initial ping to setup the connection.
     }
 
+    //
+    // Show the protocol compression settings, the CPU time reported
+    // for each test allows to compare the codecs. The codec is
+    // negotiated with the server, bzip2 is used if the server doesn't
+    // support the requested codec.
+    //
+    Ice::PropertiesPtr properties = communicator()->getProperties();
+    if(properties->getPropertyAsInt("Ice.Override.Compress") > 0)
+    {
+        cout << "using protocol compression with the "
+             << properties->getPropertyWithDefault("Ice.Compression.Codec", "bzip2") << " codec" << endl;
+    }
+    else
+    {
+        cout << "not using protocol compression" << endl;
+    }
+
     menu();
 
     //
@@ -155,9 +214,10 @@ ThroughputClient::run(int argc, char* argv[])
             cin >> c;
 
             IceUtil::Time tm = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            IceUtil::Time cpu = cpuTime();
             const int repetitions = 1000;
 
-            if(c == '1' || c == '2' || c == '3' || c == '4')
+            if(c == '1' || c == '2' || c == '3' || c == '4' || c == '5')
             {
                 currentType = c;
                 switch(c)
@@ -189,6 +249,13 @@ ThroughputClient::run(int argc, char* argv[])
                         seqSize = FixedSeqSize;
                         break;
                     }
+
+                    case '5':
+                    {
+                        cout << "using structs with a double sequence view" << endl;
+                        seqSize = DoubleStructSize;
+                        break;
+                    }
                 }
             }
             else if(c == 't' || c == 'o' || c == 'r' || c == 'e')
@@ -241,6 +308,12 @@ ThroughputClient::run(int argc, char* argv[])
                         cout << " fixed-length struct";
                         break;
                     }
+
+                    case '5':
+                    {
+                        cout << " double view";
+                        break;
+                    }
                 }
                 cout << " sequences of size " << seqSize;
 
@@ -378,10 +451,48 @@ ThroughputClient::run(int argc, char* argv[])
                             }
                             break;
                         }
+
+                        case '5':
+                        {
+                            //
+                            // The replies are received with asynchronous
+                            // invocations: views unmarshaled from the reply
+                            // of a synchronous invocation hold a copy of the
+                            // doubles.
+                            //
+                            switch(c)
+                            {
+                                case 't':
+                                {
+                                    throughput->sendDoubleStruct(doubleStruct);
+                                    break;
+                                }
+
+                                case 'o':
+                                {
+                                    throughputOneway->sendDoubleStruct(doubleStruct);
+                                    break;
+                                }
+
+                                case 'r':
+                                {
+                                    throughput->end_recvDoubleStruct(throughput->begin_recvDoubleStruct());
+                                    break;
+                                }
+
+                                case 'e':
+                                {
+                                    throughput->end_echoDoubleStruct(throughput->begin_echoDoubleStruct(doubleStruct));
+                                    break;
+                                }
+                            }
+                            break;
+                        }
                     }
                 }
 
                 tm = IceUtil::Time::now(IceUtil::Time::Monotonic) - tm;
+                cpu = cpuTime() - cpu;
                 cout << "time for " << repetitions << " sequences: " << tm * 1000 << "ms" << endl;
                 cout << "time per sequence: " << tm * 1000 / repetitions << "ms" << endl;
                 int wireSize = 0;
@@ -408,13 +519,30 @@ ThroughputClient::run(int argc, char* argv[])
                         wireSize = 16; // Size of two ints and a double on the wire.
                         break;
                     }
+                    case '5':
+                    {
+                        wireSize = 8; // Size of a double on the wire.
+                        break;
+                    }
                 }
-                double mbit = repetitions * seqSize * wireSize * 8.0 / tm.toMicroSeconds();
+                double bytes = static_cast<double>(repetitions) * seqSize * wireSize;
                 if(c == 'e')
                 {
-                    mbit *= 2;
+                    bytes *= 2;
                 }
-                cout << "throughput: " << setprecision(5) << mbit << "Mbps" << endl;
+                double mbit = bytes * 8.0 / tm.toMicroSeconds();
+                cout << "throughput: " << setprecision(5) << mbit << "Mbps ("
+                     << bytes / tm.toSecondsDouble() << " bytes/s)" << endl;
+
+                //
+                // The CPU time of the client includes the compression
+                // and decompression of the messages, it's the cost of
+                // the codec for the client side of the test.
+                //
+                cout << "client CPU time: " << cpu * 1000 << "ms ("
+                     << setprecision(3) << cpu / tm * 100 << "% of the elapsed time)" << endl;
+                cout << "client CPU time per MB: " << setprecision(5)
+                     << cpu.toMilliSecondsDouble() * 1024 * 1024 / bytes << "ms" << endl;
             }
             else if(c == 's')
             {
@@ -455,6 +583,7 @@ ThroughputClient::menu()
         "2: sequence of strings (\"hello\")\n"
         "3: sequence of structs with a string (\"hello\") and a double\n"
         "4: sequence of structs with two ints and a double\n"
+        "5: struct with a view of 1MB of doubles\n"
         "\n"
         "select test to run:\n"
         "t: Send sequence as twoway\n"
@@ -15,6 +15,7 @@ ThroughputI::ThroughputI() :
     _stringSeq(Demo::StringSeqSize, "hello"),
     _structSeq(Demo::StringDoubleSeqSize),
     _fixedSeq(Demo::FixedSeqSize),
+    _doubleSeq(Demo::DoubleStructSize, 3.14),
     _warmup(false)
 {
     int i;
@@ -152,6 +153,36 @@ ThroughputI::echoFixedSeq(const Demo::FixedSeq& seq, const Ice::Current&)
     return seq;
 }
 
+void
+ThroughputI::sendDoubleStruct(const Demo::DoubleStruct&, const Ice::Current&)
+{
+}
+
+Demo::DoubleStruct
+ThroughputI::recvDoubleStruct(const Ice::Current&)
+{
+    Demo::DoubleStruct ret;
+    if(!_warmup)
+    {
+        //
+        // The view references _doubleSeq, the doubles are marshaled
+        // without being copied first.
+        //
+        ret.values = Ice::SequenceView<Ice::Double>(&_doubleSeq[0], &_doubleSeq[0] + _doubleSeq.size());
+    }
+    return ret;
+}
+
+Demo::DoubleStruct
+ThroughputI::echoDoubleStruct(const Demo::DoubleStruct& s, const Ice::Current&)
+{
+    //
+    // The view references the request buffer, which is valid until
+    // the reply is marshaled.
+    //
+    return s;
+}
+
 void
 ThroughputI::shutdown(const Ice::Current& c)
 {
@@ -35,6 +35,9 @@ public:
     virtual void sendFixedSeq(const Demo::FixedSeq&, const Ice::Current&);
     virtual Demo::FixedSeq recvFixedSeq(const Ice::Current&);
     virtual Demo::FixedSeq echoFixedSeq(const Demo::FixedSeq&, const Ice::Current&);
+    virtual void sendDoubleStruct(const Demo::DoubleStruct&, const Ice::Current&);
+    virtual Demo::DoubleStruct recvDoubleStruct(const Ice::Current&);
+    virtual Demo::DoubleStruct echoDoubleStruct(const Demo::DoubleStruct&, const Ice::Current&);
     virtual void shutdown(const Ice::Current& c);
 
 private:
@@ -43,6 +46,7 @@ private:
     Demo::StringSeq _stringSeq;
     Demo::StringDoubleSeq _structSeq;
     Demo::FixedSeq _fixedSeq;
+    Demo::DoubleSeq _doubleSeq;
 
     bool _warmup;
 };
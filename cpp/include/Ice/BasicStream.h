@@ -21,6 +21,7 @@
 #include <Ice/UserExceptionFactory.h>
 #include <Ice/StreamHelpers.h>
 #include <Ice/FactoryTable.h>
+#include <Ice/FlatHashMap.h>
 
 namespace Ice
 {
@@ -766,6 +767,15 @@ public:
 
     void sliceObjects(bool);
 
+    //
+    // Sequence views (cpp:view) unmarshaled from this stream reference
+    // its buffer once zero-copy views are enabled, and they keep the
+    // given owner of the stream alive. Otherwise they hold a copy of
+    // the elements.
+    //
+    void enableZeroCopyViews(IceUtil::Shared* = 0);
+    bool zeroCopyViews(IceUtil::Shared*&) const;
+
     // Read/write/skip optionals
     bool readOptImpl(Ice::Int, Ice::OptionalFormat);
     bool writeOptImpl(Ice::Int, Ice::OptionalFormat);
@@ -855,7 +865,7 @@ private:
     protected:
 
         EncapsDecoder(BasicStream* stream, ReadEncaps* encaps, bool sliceObjects, const ObjectFactoryManagerPtr& f) :
-            _stream(stream), _encaps(encaps), _sliceObjects(sliceObjects), _servantFactoryManager(f), _typeIdIndex(0)
+            _stream(stream), _encaps(encaps), _sliceObjects(sliceObjects), _servantFactoryManager(f)
         {
         } 
 
@@ -865,8 +875,8 @@ private:
         void addPatchEntry(Ice::Int, PatchFunc, void*);
         void unmarshal(Ice::Int, const Ice::ObjectPtr&);
 
-        typedef std::map<Ice::Int, Ice::ObjectPtr> IndexToPtrMap;
-        typedef std::map<Ice::Int, std::string> TypeIdReadMap;
+        typedef FlatHashMap<Ice::Int, Ice::ObjectPtr, IntHash> IndexToPtrMap;
+        typedef std::vector<std::string> TypeIdReadList; // Indexed by type ID index - 1.
 
         struct PatchEntry
         {
@@ -874,7 +884,7 @@ private:
             void* patchAddr;
         };
         typedef std::vector<PatchEntry> PatchList;
-        typedef std::map<Ice::Int, PatchList> PatchMap;
+        typedef FlatHashMap<Ice::Int, PatchList, IntHash> PatchMap;
 
         BasicStream* _stream;
         ReadEncaps* _encaps;
@@ -888,8 +898,7 @@ private:
 
         // Encapsulation attributes for object un-marshalling
         IndexToPtrMap _unmarshaledMap;
-        TypeIdReadMap _typeIdMap;
-        Ice::Int _typeIdIndex;
+        TypeIdReadList _typeIds;
         ObjectList _objectList;
     };
 
@@ -1050,8 +1059,8 @@ private:
         BasicStream* _stream;
         WriteEncaps* _encaps;
 
-        typedef std::map<Ice::ObjectPtr, Ice::Int> PtrToIndexMap;
-        typedef std::map<std::string, Ice::Int> TypeIdWriteMap;
+        typedef FlatHashMap<Ice::ObjectPtr, Ice::Int, PtrHash> PtrToIndexMap;
+        typedef FlatHashMap<std::string, Ice::Int, StringHash> TypeIdWriteMap;
 
         // Encapsulation attributes for object marshalling.
         PtrToIndexMap _marshaledMap;
@@ -1092,9 +1101,12 @@ private:
         // Slice attributes
         Container::size_type _writeSlice; // Position of the slice data members
 
-        // Encapsulation attributes for object marshalling.
+        // Encapsulation attributes for object marshalling. The objects
+        // to be marshaled are registered in the marshaled map and kept
+        // in ID order until written by writePendingObjects.
         Ice::Int _objectIdIndex;
-        PtrToIndexMap _toBeMarshaledMap;
+        ObjectList _toBeMarshaledList;
+        ObjectList _writeList;
     };
 
     class ICE_API EncapsEncoder11 : public EncapsEncoder
@@ -1241,6 +1253,9 @@ private:
 
     bool _sliceObjects;
 
+    bool _zeroCopyViews;
+    IceUtil::Shared* _viewOwner;
+
     const Container::size_type _messageSizeMax;
     bool _unlimited;
 
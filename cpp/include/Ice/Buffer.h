@@ -11,6 +11,7 @@
 #define ICE_BUFFER_H
 
 #include <Ice/Config.h>
+#include <Ice/BufferPoolF.h>
 
 namespace IceInternal
 {
@@ -20,6 +21,7 @@ class ICE_API Buffer : private IceUtil::noncopyable
 public:
 
     Buffer(size_t maxCapacity) : b(maxCapacity), i(b.begin()) { }
+    Buffer(size_t maxCapacity, const BufferPoolPtr& pool) : b(maxCapacity, pool), i(b.begin()) { }
     Buffer(const Ice::Byte* beg, const Ice::Byte* end) : b(beg, end), i(b.begin()) { }
     virtual ~Buffer() { }
 
@@ -42,6 +44,7 @@ public:
         typedef size_t size_type;
 
         Container(size_type maxCapacity);
+        Container(size_type maxCapacity, const BufferPoolPtr&);
         Container(const_iterator, const_iterator);
 
         ~Container();
@@ -149,6 +152,7 @@ public:
         size_type _capacity;
         size_type _maxCapacity;
         int _shrinkCounter;
+        BufferPoolPtr _pool;
     };
 
     Container b;
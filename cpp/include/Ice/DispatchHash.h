@@ -0,0 +1,52 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DISPATCH_HASH_H
+#define ICE_DISPATCH_HASH_H
+
+#include <IceUtil/Config.h>
+
+#include <string>
+
+namespace IceInternal
+{
+
+//
+// The hash functions of the operation tables generated by slice2cpp
+// for __dispatch(). slice2cpp computes a perfect hash of the operation
+// names of each class with these functions: the low bits of the name
+// hash select a seed and the seed is mixed with the name hash to
+// select the slot of the operation. slice2cpp and the generated code
+// must agree on these functions, changing them requires regenerating
+// the code.
+//
+inline unsigned int
+dispatchHash(const std::string& name)
+{
+    unsigned int h = 2166136261U;
+    for(std::string::const_iterator p = name.begin(); p != name.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return h;
+}
+
+inline unsigned int
+dispatchSlot(unsigned int h, unsigned int seed)
+{
+    h ^= seed * 0x9e3779b9U;
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    return h;
+}
+
+}
+
+#endif
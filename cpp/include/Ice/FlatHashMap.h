@@ -0,0 +1,285 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_FLAT_HASH_MAP_H
+#define ICE_FLAT_HASH_MAP_H
+
+#include <Ice/Config.h>
+#include <Ice/Handle.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// Hash and equality functions for FlatHashMap keys.
+//
+struct IntHash
+{
+    size_t operator()(Ice::Int v) const
+    {
+        //
+        // Object and type ID indexes are allocated sequentially, the
+        // identity puts them in consecutive slots.
+        //
+        return static_cast<size_t>(v);
+    }
+
+    bool equal(Ice::Int lhs, Ice::Int rhs) const
+    {
+        return lhs == rhs;
+    }
+};
+
+struct PtrHash
+{
+    template<typename P> size_t operator()(const P& p) const
+    {
+        //
+        // Objects are heap allocated, drop the alignment bits and mix
+        // the remaining ones so that consecutive allocations spread out.
+        //
+        size_t h = reinterpret_cast<size_t>(p.get()) >> 4;
+        h ^= h >> 16;
+        h *= 0x45d9f3b;
+        h ^= h >> 16;
+        return h;
+    }
+
+    //
+    // Compare the pointers rather than the objects, the comparison
+    // operators of handles call the (virtual) object operators.
+    //
+    template<typename P> bool equal(const P& lhs, const P& rhs) const
+    {
+        return lhs.get() == rhs.get();
+    }
+};
+
+struct StringHash
+{
+    size_t operator()(const std::string& s) const
+    {
+        size_t h = 2166136261U;
+        for(std::string::const_iterator p = s.begin(); p != s.end(); ++p)
+        {
+            h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+        }
+        return h;
+    }
+
+    bool equal(const std::string& lhs, const std::string& rhs) const
+    {
+        return lhs == rhs;
+    }
+};
+
+//
+// Entries are moved around with swaps, handles are swapped without
+// updating the reference count of the objects.
+//
+template<typename T> inline void
+swapValue(T& lhs, T& rhs)
+{
+    std::swap(lhs, rhs);
+}
+
+template<typename T> inline void
+swapValue(IceUtil::Handle<T>& lhs, IceUtil::Handle<T>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+template<typename T> inline void
+swapValue(IceInternal::Handle<T>& lhs, IceInternal::Handle<T>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+//
+// An open addressing hash map with linear probing and Robin Hood
+// insertion, stored in a single array. It's used for the object and
+// type ID tables of the encapsulation encoders and decoders: clear()
+// keeps the memory of the map so that tables cleared for each slice
+// or each round of pending objects don't allocate again.
+//
+template<typename K, typename V, typename H>
+class FlatHashMap
+{
+public:
+
+    FlatHashMap() :
+        _size(0)
+    {
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    V* find(const K& key)
+    {
+        size_t i = lookup(key);
+        return i == _slots.size() ? 0 : &_slots[i].value;
+    }
+
+    const V* find(const K& key) const
+    {
+        size_t i = lookup(key);
+        return i == _slots.size() ? 0 : &_slots[i].value;
+    }
+
+    //
+    // Add an entry, the key must not be in the map already.
+    //
+    void insert(const K& key, const V& value)
+    {
+        if((_size + 1) * 4 > _slots.size() * 3)
+        {
+            resize(_slots.empty() ? 16 : _slots.size() * 2);
+        }
+        Slot slot;
+        slot.key = key;
+        slot.value = value;
+        place(slot);
+        ++_size;
+    }
+
+    bool erase(const K& key)
+    {
+        size_t i = lookup(key);
+        if(i == _slots.size())
+        {
+            return false;
+        }
+
+        //
+        // Shift back the following entries which aren't in their home
+        // slot, so that lookups never need to skip deleted slots.
+        //
+        const size_t mask = _slots.size() - 1;
+        size_t j = (i + 1) & mask;
+        while(_slots[j].distance > 1)
+        {
+            swapSlots(_slots[i], _slots[j]);
+            --_slots[i].distance;
+            i = j;
+            j = (j + 1) & mask;
+        }
+        _slots[i] = Slot();
+        --_size;
+        return true;
+    }
+
+    void clear()
+    {
+        if(_size > 0)
+        {
+            for(typename std::vector<Slot>::iterator p = _slots.begin(); p != _slots.end(); ++p)
+            {
+                if(p->distance > 0)
+                {
+                    *p = Slot();
+                }
+            }
+            _size = 0;
+        }
+    }
+
+private:
+
+    struct Slot
+    {
+        Slot() : distance(0)
+        {
+        }
+
+        K key;
+        V value;
+        size_t distance; // Distance to the home slot plus one, 0 for an empty slot.
+    };
+
+    static void swapSlots(Slot& lhs, Slot& rhs)
+    {
+        swapValue(lhs.key, rhs.key);
+        swapValue(lhs.value, rhs.value);
+        std::swap(lhs.distance, rhs.distance);
+    }
+
+    size_t lookup(const K& key) const
+    {
+        if(_size == 0)
+        {
+            return _slots.size();
+        }
+        const size_t mask = _slots.size() - 1;
+        const H hash = H();
+        size_t i = hash(key) & mask;
+        for(size_t d = 1; _slots[i].distance >= d; ++d)
+        {
+            if(hash.equal(_slots[i].key, key))
+            {
+                return i;
+            }
+            i = (i + 1) & mask;
+        }
+        return _slots.size();
+    }
+
+    void place(Slot& slot)
+    {
+        //
+        // Robin Hood insertion: an entry takes the slot of any entry
+        // closer to its own home slot, which keeps probe sequences
+        // short and lets lookups stop early.
+        //
+        const size_t mask = _slots.size() - 1;
+        size_t i = H()(slot.key) & mask;
+        slot.distance = 1;
+        while(_slots[i].distance > 0)
+        {
+            if(_slots[i].distance < slot.distance)
+            {
+                swapSlots(slot, _slots[i]);
+            }
+            i = (i + 1) & mask;
+            ++slot.distance;
+        }
+        swapSlots(slot, _slots[i]);
+    }
+
+    void resize(size_t capacity)
+    {
+        std::vector<Slot> slots(capacity);
+        _slots.swap(slots);
+        for(typename std::vector<Slot>::iterator p = slots.begin(); p != slots.end(); ++p)
+        {
+            if(p->distance > 0)
+            {
+                place(*p);
+            }
+        }
+    }
+
+    std::vector<Slot> _slots;
+    size_t _size;
+};
+
+}
+
+#endif
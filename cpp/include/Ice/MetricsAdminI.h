@@ -44,6 +44,62 @@ template<typename T> class MetricsHelperT;
 namespace IceInternal
 {
 
+//
+// A histogram of durations in microseconds with logarithmic buckets:
+// the bounds of the buckets keep the given number of significant
+// decimal digits. Observations are recorded with atomic increments
+// where available, the histogram doesn't need to be locked.
+//
+class ICE_API MetricsHistogram : public IceUtil::Shared
+{
+public:
+
+    MetricsHistogram(int);
+    ~MetricsHistogram();
+
+    void add(Ice::Long);
+    IceMX::LatencyHistogram get() const;
+
+private:
+
+    size_t index(Ice::Long) const;
+    Ice::Long upperBound(size_t) const;
+
+    const int _bits;
+    const size_t _size;
+    Ice::Long* _counts;
+    IceUtil::Mutex _mutex; // Only used without atomic 64 bits operations.
+};
+typedef IceUtil::Handle<MetricsHistogram> MetricsHistogramPtr;
+
+//
+// Returns the histogram data member of the given metrics class, or
+// null if the metrics class doesn't support histograms.
+//
+inline IceUtil::Optional<IceMX::LatencyHistogram>*
+histogramMember(IceMX::Metrics*)
+{
+    return 0;
+}
+
+inline IceUtil::Optional<IceMX::LatencyHistogram>*
+histogramMember(IceMX::DispatchMetrics* m)
+{
+    return &m->histogram;
+}
+
+inline IceUtil::Optional<IceMX::LatencyHistogram>*
+histogramMember(IceMX::InvocationMetrics* m)
+{
+    return &m->histogram;
+}
+
+inline IceUtil::Optional<IceMX::LatencyHistogram>*
+histogramMember(IceMX::RemoteMetrics* m)
+{
+    return &m->histogram;
+}
+
 class ICE_API MetricsMapI : public IceUtil::Shared
 {
 public:
@@ -112,6 +168,7 @@ protected:
     const std::vector<std::string> _groupByAttributes;
     const std::vector<std::string> _groupBySeparators;
     const int _retain;
+    const int _histogram; // The histogram precision, 0 if disabled.
     const std::vector<RegExpPtr> _accept;
     const std::vector<RegExpPtr> _reject;
 };
@@ -154,6 +211,10 @@ public:
         EntryT(MetricsMapT* map, const TPtr& object, const typename std::list<EntryTPtr>::iterator& p) : 
             _map(map), _object(object), _detachedPos(p)
         {
+            if(map->_histogram > 0 && histogramMember(object.get()))
+            {
+                _histogram = new MetricsHistogram(map->_histogram);
+            }
         }
 
         ~EntryT()
@@ -205,6 +266,11 @@ public:
         void
         detach(Ice::Long lifetime)
         {
+            if(_histogram)
+            {
+                _histogram->add(lifetime);
+            }
+
             IceUtil::Mutex::Lock sync(*_map);
             _object->totalLifetime += lifetime;
             if(--_object->current == 0)
@@ -247,6 +313,10 @@ public:
             {
                 metrics.get()->*p->second.second = p->second.first->getMetrics();
             }
+            if(_histogram)
+            {
+                *histogramMember(metrics.get()) = _histogram->get();
+            }
             return metrics;
         }
 
@@ -267,6 +337,7 @@ public:
         friend class MetricsMapT;
         MetricsMapTPtr _map;
         TPtr _object;
+        MetricsHistogramPtr _histogram;
         IceMX::StringIntDict _failures;
         std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> > _subMaps;
         typename std::list<EntryTPtr>::iterator _detachedPos;
@@ -585,18 +656,7 @@ public:
     template<class MetricsType> void 
     registerMap(const std::string& map, IceMX::Updater* updater)
     {
-        bool updated;
-        MetricsMapFactoryPtr factory;
-        {
-            Lock sync(*this);
-            factory = new MetricsMapFactoryT<MetricsType>(updater);
-            _factories[map] = factory;
-            updated = addOrUpdateMap(map, factory);
-        }
-        if(updated)
-        {
-            factory->update();
-        }
+        registerMap(map, new MetricsMapFactoryT<MetricsType>(updater));
     }
 
     template<class MemberMetricsType, class MetricsType> void
@@ -623,6 +683,7 @@ public:
         }
     }
 
+    void registerMap(const std::string&, const MetricsMapFactoryPtr&);
     void unregisterMap(const std::string&);
 
     virtual Ice::StringSeq getMetricsViewNames(Ice::StringSeq&, const ::Ice::Current&);
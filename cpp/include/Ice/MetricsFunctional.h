@@ -106,6 +106,18 @@ template<typename T> struct Increment
     }
 };
 
+//
+// Optional metrics members aren't set if they were unmarshaled from
+// an older peer, an unset member counts as 0.
+//
+template<typename T> struct Increment<IceUtil::Optional<T> >
+{
+    void operator()(IceUtil::Optional<T>& v)
+    {
+        v = (v ? *v : T()) + 1;
+    }
+};
+
 template<typename T> struct Add
 {
     Add(T value) : value(value) { }
@@ -116,6 +128,12 @@ template<typename T> struct Add
         v += value;
     }
 
+    template<typename Y>
+    void operator()(IceUtil::Optional<Y>& v)
+    {
+        v = (v ? *v : Y()) + value;
+    }
+
     T value;
 };
 
@@ -26,6 +26,8 @@
 
 #ifdef ICE_CPP11
 #   include <functional> // for std::function
+#   include <future> // for std::promise
+#   include <tuple> // for std::tuple
 #endif
 
 namespace IceInternal
@@ -34,6 +36,19 @@ namespace IceInternal
 class CallbackBase;
 typedef IceUtil::Handle<CallbackBase> CallbackBasePtr;
 
+//
+// The stream of the reply of an asynchronous invocation. Sequence
+// views (cpp:view) unmarshaled from the reply reference its buffer
+// and keep this stream alive, but not the AsyncResult.
+//
+class ICE_API ReplyStream : public IceUtil::Shared, public BasicStream
+{
+public:
+
+    ReplyStream(Instance*);
+};
+typedef IceUtil::Handle<ReplyStream> ReplyStreamPtr;
+
 }
 
 namespace Ice
@@ -154,7 +169,8 @@ protected:
     const LocalObjectPtr _cookie;
 
     IceUtil::Monitor<IceUtil::Mutex> _monitor;
-    IceInternal::BasicStream _is;
+    const IceInternal::ReplyStreamPtr _replyStream;
+    IceInternal::BasicStream& _is;
     IceInternal::BasicStream _os;
 
     static const unsigned char OK;
@@ -181,6 +197,45 @@ extern ICE_API CallbackBasePtr __dummyCallback;
 
 class LocalExceptionWrapper;
 
+//
+// The context and in-parameters of a request, encoded once to be sent
+// to many proxies with IceProxy::Ice::Object::__begin_ice_invoke. The
+// connection writes the encoded bytes after the request header of
+// each request without copying them.
+//
+class ICE_API EncodedParams : public IceUtil::Shared
+{
+public:
+
+    EncodedParams(const Ice::CommunicatorPtr&, const Ice::Context&,
+                  const std::pair<const Ice::Byte*, const Ice::Byte*>&);
+
+    const Ice::Byte* begin() const
+    {
+        return _os.b.begin();
+    }
+
+    const Ice::Byte* end() const
+    {
+        return _os.b.end();
+    }
+
+    //
+    // True if the in-parameters are empty, the empty encapsulation
+    // depends on the encoding of the proxy so it isn't encoded here.
+    //
+    bool emptyParams() const
+    {
+        return _emptyParams;
+    }
+
+private:
+
+    const InstancePtr _instance;
+    BasicStream _os;
+    const bool _emptyParams;
+};
+
 //
 // This interface is used by the connection to handle OutgoingAsync
 // and BatchOutgoingAsync messages.
@@ -223,6 +278,15 @@ public:
 
     void __prepare(const std::string&, Ice::OperationMode, const Ice::Context*);
 
+    //
+    // Prepare a request with an explicit context and in-parameters
+    // which were encoded beforehand, the context is only used by the
+    // observers. Unless the request is sent with a gather write by
+    // the connection, the encoded bytes are merged into the request
+    // stream with __mergeTail().
+    //
+    void __prepare(const std::string&, Ice::OperationMode, const Ice::Context&, const EncodedParamsPtr&);
+
     virtual Ice::ObjectPrx
     getProxy() const
     {
@@ -269,12 +333,25 @@ public:
         return &_is;
     }
 
+    //
+    // The encoded bytes which follow the request stream, or 0 if the
+    // request stream holds the whole request.
+    //
+    Buffer*
+    __getTail()
+    {
+        return _tail.get();
+    }
+    void __mergeTail();
+
 protected:
 
     Ice::ObjectPrx _proxy;
 
 private:
 
+    Reference* prepareRequest(const std::string&, Ice::OperationMode, const Ice::Context*);
+
     int handleException(const Ice::LocalException&, bool);
     int handleException(const LocalExceptionWrapper&);
 
@@ -285,6 +362,8 @@ private:
     Ice::EncodingVersion _encoding;
     int _cnt;
     Ice::OperationMode _mode;
+    EncodedParamsPtr _params;
+    IceUtil::UniquePtr<Buffer> _tail;
 };
 
 class ICE_API BatchOutgoingAsync : public OutgoingAsyncMessageCallback, public Ice::AsyncResult
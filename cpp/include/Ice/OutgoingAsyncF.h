@@ -30,6 +30,10 @@ class OutgoingAsync;
 ICE_API IceUtil::Shared* upCast(OutgoingAsync*);
 typedef IceInternal::Handle<OutgoingAsync> OutgoingAsyncPtr;
 
+class EncodedParams;
+ICE_API IceUtil::Shared* upCast(EncodedParams*);
+typedef IceInternal::Handle<EncodedParams> EncodedParamsPtr;
+
 class OutgoingAsyncMessageCallback;
 ICE_API IceUtil::Shared* upCast(OutgoingAsyncMessageCallback*);
 typedef IceInternal::Handle<OutgoingAsyncMessageCallback> OutgoingAsyncMessageCallbackPtr;
@@ -55,6 +55,19 @@ const ::Ice::Byte replyMsg = 2;
 const ::Ice::Byte validateConnectionMsg = 3;
 const ::Ice::Byte closeConnectionMsg = 4;
 
+//
+// The Ice protocol compression status values. Statuses above
+// compressionBZip2 identify additional compression codecs. An
+// uncompressed message with the compressionCodecRequest bit set asks
+// for the response, if any, to be compressed with the given codec.
+//
+const ::Ice::Byte compressionNone = 0;
+const ::Ice::Byte compressionSupported = 1;
+const ::Ice::Byte compressionBZip2 = 2;
+const ::Ice::Byte compressionLZ4 = 3;
+const ::Ice::Byte compressionZstd = 4;
+const ::Ice::Byte compressionCodecRequest = 0x80;
+
 //
 // The request header, batch request header and reply header.
 //
@@ -219,6 +219,91 @@ private:
     ::std::function<void ()> _cb;
 };
 
+//
+// Base class for the callbacks of the future-returning invocation
+// methods. The callback fulfills the promise of the returned future
+// when the invocation completes.
+//
+template<typename R>
+class Cpp11PromiseCallback : virtual public CallbackBase
+{
+public:
+
+    ::std::future<R> __getFuture()
+    {
+        return _promise.get_future();
+    }
+
+    virtual CallbackBasePtr __verify(::Ice::LocalObjectPtr&)
+    {
+        return this;
+    }
+
+    virtual void __sent(const ::Ice::AsyncResultPtr&) const
+    {
+    }
+
+    virtual bool __hasSentCallback() const
+    {
+        return false;
+    }
+
+    //
+    // Store an exception raised by the begin_ method, before the
+    // request is sent, in the future.
+    //
+    void __setException(::std::exception_ptr ex)
+    {
+        _promise.set_exception(ex);
+        __releasePromise();
+    }
+
+protected:
+
+    void __exception(const ::Ice::Exception& ex) const
+    {
+        try
+        {
+            ex.ice_throw();
+        }
+        catch(...)
+        {
+            _promise.set_exception(::std::current_exception());
+        }
+        __releasePromise();
+    }
+
+    //
+    // Drop the promise once it's satisfied, the future keeps the shared
+    // state. The AsyncResult holds this callback, it doesn't need to
+    // keep the value alive as well.
+    //
+    void __releasePromise() const
+    {
+        ::std::promise<R>().swap(_promise);
+    }
+
+    mutable ::std::promise<R> _promise;
+};
+
+//
+// Callback for the future-returning methods of operations which don't
+// return data. With a oneway proxy the future is ready once the request
+// is sent.
+//
+class ICE_API Cpp11OnewayPromiseCallback : public Cpp11PromiseCallback<void>
+{
+public:
+
+    virtual void __completed(const ::Ice::AsyncResultPtr&) const;
+    virtual void __sent(const ::Ice::AsyncResultPtr&) const;
+
+    virtual bool __hasSentCallback() const
+    {
+        return true;
+    }
+};
+
 }
 #endif
 
@@ -828,6 +913,9 @@ public:
     bool ice_isPreferSecure() const;
     ::Ice::ObjectPrx ice_preferSecure(bool) const;
 
+    bool ice_isCoalesce() const;
+    ::Ice::ObjectPrx ice_coalesce(bool) const;
+
     ::Ice::RouterPrx ice_getRouter() const;
     ::Ice::ObjectPrx ice_router(const ::Ice::RouterPrx&) const;
 
@@ -906,6 +994,18 @@ public:
     void __checkAsyncTwowayOnly(const ::std::string&) const;
     void __end(const ::Ice::AsyncResultPtr&, const std::string&) const;
 
+    //
+    // Send an ice_invoke request whose context and in-parameters were
+    // encoded beforehand, to send the same request to many proxies.
+    // The request is completed with end_ice_invoke.
+    //
+    ::Ice::AsyncResultPtr __begin_ice_invoke(const ::std::string&,
+                                             ::Ice::OperationMode,
+                                             const ::Ice::Context&,
+                                             const ::IceInternal::EncodedParamsPtr&,
+                                             const ::IceInternal::CallbackBasePtr&,
+                                             const ::Ice::LocalObjectPtr& = 0);
+
     ::IceInternal::Handle< ::IceDelegate::Ice::Object> __getDelegate(bool);
     void __setRequestHandler(const ::IceInternal::Handle< ::IceDelegate::Ice::Object>&, 
                              const ::IceInternal::RequestHandlerPtr&);
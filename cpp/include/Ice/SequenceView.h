@@ -0,0 +1,260 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_SEQUENCE_VIEW_H
+#define ICE_SEQUENCE_VIEW_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Handle.h>
+#include <Ice/StreamHelpers.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace IceInternal
+{
+
+class BasicStream;
+
+//
+// Returns true if sequence views unmarshaled from the given stream can
+// reference its buffer, and sets owner to the object the views must
+// keep alive, if any. Other streams (Ice::InputStream) always allow it.
+//
+ICE_API bool zeroCopyViews(const BasicStream*, IceUtil::Shared*&);
+
+template<class S> inline bool
+zeroCopyViews(const S*, IceUtil::Shared*& owner)
+{
+    owner = 0;
+    return true;
+}
+
+}
+
+namespace Ice
+{
+
+//
+// The mapping of sequences of primitive types with the cpp:view
+// metadata. Once unmarshaled, the view references the elements in
+// the buffer of the request or reply instead of holding a copy of
+// them. A view unmarshaled from a request is only valid for the
+// duration of the dispatch, call detach() to copy the elements and
+// keep it beyond that (for example with AMD). A view unmarshaled from
+// the reply of an asynchronous invocation keeps the reply buffer
+// alive, but not the AsyncResult of the invocation.
+//
+// Views hold a copy of the elements when they can't be referenced,
+// for example on big-endian platforms or for the replies of
+// synchronous invocations.
+//
+template<typename T>
+class SequenceView
+{
+public:
+
+    typedef T value_type;
+    typedef const T* iterator;
+    typedef const T* const_iterator;
+    typedef const T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+
+    SequenceView() :
+        _begin(0), _end(0)
+    {
+    }
+
+    //
+    // The view doesn't copy the elements, they must outlive it.
+    //
+    SequenceView(const T* begin, const T* end) :
+        _begin(begin), _end(end)
+    {
+    }
+
+    SequenceView(const std::pair<const T*, const T*>& p) :
+        _begin(p.first), _end(p.second)
+    {
+    }
+
+    SequenceView(const SequenceView& other) :
+        _begin(other._begin), _end(other._end), _owner(other._owner)
+    {
+        if(other.detached())
+        {
+            detach();
+        }
+    }
+
+    SequenceView& operator=(const SequenceView& other)
+    {
+        if(this != &other)
+        {
+            SequenceView(other).swap(*this);
+        }
+        return *this;
+    }
+
+    const_iterator begin() const
+    {
+        return _begin;
+    }
+
+    const_iterator end() const
+    {
+        return _end;
+    }
+
+    size_type size() const
+    {
+        return static_cast<size_type>(_end - _begin);
+    }
+
+    bool empty() const
+    {
+        return _begin == _end;
+    }
+
+    const T& operator[](size_type i) const
+    {
+        return _begin[i];
+    }
+
+    //
+    // Returns true if the view holds its own copy of the elements.
+    //
+    bool detached() const
+    {
+        return _data.get() != 0 && _begin == _data.get();
+    }
+
+    //
+    // Copy the elements so that the view no longer references the
+    // buffer it was unmarshaled from.
+    //
+    void detach()
+    {
+        if(!detached() && _begin != _end)
+        {
+            IceUtil::ScopedArray<T> data(new T[size()]);
+            std::copy(_begin, _end, data.get());
+            _end = data.get() + size();
+            _begin = data.get();
+            _data.swap(data);
+            _owner = 0;
+        }
+    }
+
+    std::vector<T> toVector() const
+    {
+        return std::vector<T>(_begin, _end);
+    }
+
+    void swap(SequenceView& other)
+    {
+        std::swap(_begin, other._begin);
+        std::swap(_end, other._end);
+        _data.swap(other._data);
+        _owner.swap(other._owner);
+    }
+
+    //
+    // Used by the stream helper: the view either adopts the copy made
+    // by the stream or references the stream buffer held by owner.
+    //
+    void __adopt(const std::pair<const T*, const T*>& p, IceUtil::ScopedArray<T>& data, IceUtil::Shared* owner)
+    {
+        _begin = p.first;
+        _end = p.second;
+        _data.swap(data);
+        _owner = _data.get() ? 0 : owner;
+    }
+
+private:
+
+    const T* _begin;
+    const T* _end;
+    IceUtil::ScopedArray<T> _data;
+    IceUtil::Handle<IceUtil::Shared> _owner;
+};
+
+template<typename T> inline bool
+operator==(const SequenceView<T>& lhs, const SequenceView<T>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T> inline bool
+operator!=(const SequenceView<T>& lhs, const SequenceView<T>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<typename T> inline bool
+operator<(const SequenceView<T>& lhs, const SequenceView<T>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T> inline bool
+operator<=(const SequenceView<T>& lhs, const SequenceView<T>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template<typename T> inline bool
+operator>(const SequenceView<T>& lhs, const SequenceView<T>& rhs)
+{
+    return rhs < lhs;
+}
+
+template<typename T> inline bool
+operator>=(const SequenceView<T>& lhs, const SequenceView<T>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template<typename T>
+struct StreamableTraits< SequenceView<T> >
+{
+    static const StreamHelperCategory helper = StreamHelperCategorySequence;
+    static const int minWireSize = 1;
+    static const bool fixedLength = false;
+};
+
+template<typename T>
+struct StreamHelper<SequenceView<T>, StreamHelperCategorySequence>
+{
+    template<class S> static inline void
+    write(S* stream, const SequenceView<T>& v)
+    {
+        stream->write(v.begin(), v.end());
+    }
+
+    template<class S> static inline void
+    read(S* stream, SequenceView<T>& v)
+    {
+        std::pair<const T*, const T*> p;
+        IceUtil::ScopedArray<T> data;
+        stream->read(p, data);
+        IceUtil::Shared* owner = 0;
+        bool zeroCopy = IceInternal::zeroCopyViews(stream, owner);
+        v.__adopt(p, data, owner);
+        if(!zeroCopy)
+        {
+            v.detach();
+        }
+    }
+};
+
+}
+
+#endif
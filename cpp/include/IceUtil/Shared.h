@@ -16,6 +16,14 @@
 
 #   include <IceUtil/Mutex.h>
 
+// The __atomic builtins are available with gcc 4.7 or better and
+// clang on all architectures. They allow the reference count to use
+// relaxed increments and release/acquire decrements.
+
+#elif (defined(__GNUC__) && (((__GNUC__* 100) + __GNUC_MINOR__) >= 407)) || defined(__clang__)
+
+#   define ICE_HAS_GCC_ATOMIC_BUILTINS
+
 // Using the gcc builtins requires gcc 4.1 or better. For Linux, i386
 // doesn't work. Apple is supported for all architectures. Sun only
 // supports sparc (32 and 64 bit).
@@ -134,6 +142,8 @@ protected:
 
 #if defined(_WIN32)
     LONG _ref;
+#elif defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+    int _ref;
 #elif defined(ICE_HAS_ATOMIC_FUNCTIONS) || defined(ICE_HAS_GCC_BUILTINS)
     volatile int _ref;
 #else
@@ -14,10 +14,18 @@
 #include <IceUtil/Thread.h>
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Time.h>
+#include <IceUtil/UniquePtr.h>
 
 #include <set>
 #include <map>
 
+namespace IceUtilInternal
+{
+
+class TimerWheel;
+
+}
+
 namespace IceUtil
 {
 
@@ -58,6 +66,22 @@ public:
     //
     Timer(int priority);
 
+    //
+    // Construct a timer which keeps its tasks in a hierarchical timing
+    // wheel with the given tick and starts its execution thread. Tasks
+    // are scheduled and cancelled in constant time but their delay is
+    // rounded up to the next tick. A zero tick is the same as using the
+    // constructors above.
+    //
+    Timer(const IceUtil::Time&);
+
+    //
+    // Same as above with the priority of the execution thread.
+    //
+    Timer(const IceUtil::Time&, int priority);
+
+    virtual ~Timer();
+
     //
     // Destroy the timer and detach its execution thread if the calling thread 
     // is the timer thread, join the timer execution thread otherwise.
@@ -111,6 +135,7 @@ private:
         }
     };
     std::map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare> _tasks;
+    IceUtil::UniquePtr<IceUtilInternal::TimerWheel> _wheel;
     IceUtil::Time _wakeUpTime;
 };
 typedef IceUtil::Handle<Timer> TimerPtr;
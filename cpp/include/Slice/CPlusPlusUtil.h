@@ -57,6 +57,7 @@ SLICE_API void writeEndCode(::IceUtilInternal::Output&, const ParamDeclList&, co
 
 SLICE_API std::string findMetaData(const StringList&, int = 0);
 SLICE_API bool inWstringModule(const SequencePtr&);
+SLICE_API bool isViewableSequence(const SequencePtr&);
 
 SLICE_API std::string getDataMemberRef(const DataMemberPtr&);
 }
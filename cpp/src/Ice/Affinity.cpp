@@ -0,0 +1,186 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Affinity.h>
+#include <Ice/LocalException.h>
+#include <IceUtil/StringUtil.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux)
+#   include <pthread.h>
+#   include <sched.h>
+#   include <dirent.h>
+#   include <errno.h>
+#endif
+
+using namespace std;
+using namespace IceInternal;
+
+bool
+IceInternal::parseCPUList(const string& str, vector<int>& cpus)
+{
+    vector<string> ranges;
+    if(!IceUtilInternal::splitString(str, ", \t\n", ranges))
+    {
+        return false;
+    }
+
+    vector<int> result;
+    for(vector<string>::const_iterator p = ranges.begin(); p != ranges.end(); ++p)
+    {
+        istringstream is(*p);
+        int first;
+        if(!(is >> first) || first < 0)
+        {
+            return false;
+        }
+        int last = first;
+        char c;
+        if(is >> c)
+        {
+            if(c != '-' || !(is >> last) || last < first || is >> c)
+            {
+                return false;
+            }
+        }
+        for(int i = first; i <= last; ++i)
+        {
+            result.push_back(i);
+        }
+    }
+
+    sort(result.begin(), result.end());
+    result.erase(unique(result.begin(), result.end()), result.end());
+    cpus.swap(result);
+    return true;
+}
+
+string
+IceInternal::cpuListToString(const vector<int>& cpus)
+{
+    ostringstream os;
+    vector<int>::const_iterator p = cpus.begin();
+    while(p != cpus.end())
+    {
+        vector<int>::const_iterator q = p;
+        while(q + 1 != cpus.end() && *(q + 1) == *q + 1)
+        {
+            ++q;
+        }
+        if(p != cpus.begin())
+        {
+            os << ',';
+        }
+        os << *p;
+        if(q != p)
+        {
+            os << '-' << *q;
+        }
+        p = q + 1;
+    }
+    return os.str();
+}
+
+vector<vector<int> >
+IceInternal::getNUMANodes()
+{
+    vector<vector<int> > nodes;
+#if defined(__linux)
+    //
+    // Each node is a /sys/devices/system/node/node<N> directory with a
+    // cpulist file. Node numbers may have holes, nodes are returned in
+    // node number order.
+    //
+    const string path = "/sys/devices/system/node";
+    DIR* dir = opendir(path.c_str());
+    if(!dir)
+    {
+        return nodes;
+    }
+
+    vector<int> numbers;
+    struct dirent* entry;
+    while((entry = readdir(dir)) != 0)
+    {
+        string name = entry->d_name;
+        if(name.size() > 4 && name.compare(0, 4, "node") == 0)
+        {
+            istringstream is(name.substr(4));
+            int number;
+            if(is >> number && is.eof())
+            {
+                numbers.push_back(number);
+            }
+        }
+    }
+    closedir(dir);
+    sort(numbers.begin(), numbers.end());
+
+    for(vector<int>::const_iterator p = numbers.begin(); p != numbers.end(); ++p)
+    {
+        ostringstream file;
+        file << path << "/node" << *p << "/cpulist";
+        ifstream is(file.str().c_str());
+        string line;
+        vector<int> cpus;
+        if(is && getline(is, line) && parseCPUList(line, cpus) && !cpus.empty())
+        {
+            nodes.push_back(cpus);
+        }
+    }
+#endif
+    return nodes;
+}
+
+void
+IceInternal::setThreadAffinity(const vector<int>& cpus)
+{
+#if defined(__linux)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(vector<int>::const_iterator p = cpus.begin(); p != cpus.end(); ++p)
+    {
+        if(*p < CPU_SETSIZE)
+        {
+            CPU_SET(*p, &set);
+        }
+    }
+    int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if(rc != 0)
+    {
+        Ice::SyscallException ex(__FILE__, __LINE__);
+        ex.error = rc;
+        throw ex;
+    }
+#elif defined(_WIN32) && !defined(ICE_OS_WINRT)
+    //
+    // Only the CPUs of the calling thread's processor group (the first
+    // 64 CPUs) can be used.
+    //
+    DWORD_PTR mask = 0;
+    for(vector<int>::const_iterator p = cpus.begin(); p != cpus.end(); ++p)
+    {
+        if(*p < static_cast<int>(sizeof(DWORD_PTR) * 8))
+        {
+            mask |= static_cast<DWORD_PTR>(1) << *p;
+        }
+    }
+    if(SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+    {
+        Ice::SyscallException ex(__FILE__, __LINE__);
+        ex.error = GetLastError();
+        throw ex;
+    }
+#else
+    throw Ice::FeatureNotSupportedException(__FILE__, __LINE__, "thread affinity");
+#endif
+}
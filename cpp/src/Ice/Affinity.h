@@ -0,0 +1,44 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_AFFINITY_H
+#define ICE_AFFINITY_H
+
+#include <Ice/Config.h>
+
+#include <string>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// Parse a list of CPU numbers and ranges such as "0-3,8,10-11" (the
+// format of Linux cpusets). Returns false if the list is invalid.
+//
+bool parseCPUList(const std::string&, std::vector<int>&);
+
+std::string cpuListToString(const std::vector<int>&);
+
+//
+// Returns the CPUs of each NUMA node, or an empty vector if the NUMA
+// topology isn't available on this platform.
+//
+std::vector<std::vector<int> > getNUMANodes();
+
+//
+// Restrict the calling thread to the given CPUs. Throws
+// Ice::SyscallException on failure and Ice::FeatureNotSupportedException
+// if thread affinity isn't supported on this platform.
+//
+void setThreadAffinity(const std::vector<int>&);
+
+}
+
+#endif
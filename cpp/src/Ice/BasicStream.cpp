@@ -9,6 +9,7 @@
 
 #include <IceUtil/DisableWarnings.h>
 #include <Ice/BasicStream.h>
+#include <Ice/SequenceView.h>
 #include <Ice/DefaultsAndOverrides.h>
 #include <Ice/Instance.h>
 #include <Ice/Object.h>
@@ -90,13 +91,15 @@ const Byte FLAG_IS_LAST_SLICE         = (1<<5);
 
 
 IceInternal::BasicStream::BasicStream(Instance* instance, const EncodingVersion& encoding, bool unlimited) :
-    IceInternal::Buffer(instance->messageSizeMax()),
+    IceInternal::Buffer(instance->messageSizeMax(), instance->bufferPool()),
     _instance(instance),
     _closure(0),
     _encoding(encoding),
     _currentReadEncaps(0),
     _currentWriteEncaps(0),
     _sliceObjects(true),
+    _zeroCopyViews(false),
+    _viewOwner(0),
     _messageSizeMax(_instance->messageSizeMax()), // Cached for efficiency.
     _unlimited(unlimited),
     _stringConverter(instance->initializationData().stringConverter),
@@ -121,6 +124,8 @@ IceInternal::BasicStream::BasicStream(Instance* instance, const EncodingVersion&
     _currentReadEncaps(0),
     _currentWriteEncaps(0),
     _sliceObjects(true),
+    _zeroCopyViews(false),
+    _viewOwner(0),
     _messageSizeMax(_instance->messageSizeMax()), // Cached for efficiency.
     _unlimited(false),
     _stringConverter(instance->initializationData().stringConverter),
@@ -1648,6 +1653,26 @@ IceInternal::BasicStream::sliceObjects(bool doSlice)
     _sliceObjects = doSlice;
 }
 
+void
+IceInternal::BasicStream::enableZeroCopyViews(IceUtil::Shared* owner)
+{
+    _zeroCopyViews = true;
+    _viewOwner = owner;
+}
+
+bool
+IceInternal::BasicStream::zeroCopyViews(IceUtil::Shared*& owner) const
+{
+    owner = _viewOwner;
+    return _zeroCopyViews;
+}
+
+bool
+IceInternal::zeroCopyViews(const BasicStream* stream, IceUtil::Shared*& owner)
+{
+    return stream->zeroCopyViews(owner);
+}
+
 bool
 IceInternal::BasicStream::readOptImpl(Int readTag, OptionalFormat expectedFormat)
 {
@@ -1871,19 +1896,17 @@ IceInternal::BasicStream::EncapsDecoder::readTypeId(bool isIndex)
     if(isIndex)
     {
         Int index = _stream->readSize();
-        TypeIdReadMap::const_iterator k = _typeIdMap.find(index);
-        if(k == _typeIdMap.end())
+        if(index <= 0 || index > static_cast<Int>(_typeIds.size()))
         {
             throw UnmarshalOutOfBoundsException(__FILE__, __LINE__);
         }
-        return k->second;
+        return _typeIds[index - 1];
     }
     else
     {
-        string typeId;
-        _stream->read(typeId, false);
-        _typeIdMap.insert(make_pair(++_typeIdIndex, typeId));
-        return typeId;
+        _typeIds.push_back(string());
+        _stream->read(_typeIds.back(), false);
+        return _typeIds.back();
     }
 }
 
@@ -1940,10 +1963,10 @@ IceInternal::BasicStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patc
     // Check if already un-marshalled the object. If that's the case,
     // just patch the object smart pointer and we're done.
     //
-    IndexToPtrMap::iterator p = _unmarshaledMap.find(index);
-    if(p != _unmarshaledMap.end())
+    Ice::ObjectPtr* p = _unmarshaledMap.find(index);
+    if(p)
     {
-        (*patchFunc)(patchAddr, p->second);
+        (*patchFunc)(patchAddr, *p);
         return;
     }
 
@@ -1953,14 +1976,15 @@ IceInternal::BasicStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patc
     // un-marshalled.
     //
 
-    PatchMap::iterator q = _patchMap.find(index);
-    if(q == _patchMap.end())
+    PatchList* q = _patchMap.find(index);
+    if(!q)
     {
         //
         // We have no outstanding instances to be patched for this
         // index, so make a new entry in the patch map.
         //
-        q = _patchMap.insert(make_pair(index, PatchList())).first;
+        _patchMap.insert(index, PatchList());
+        q = _patchMap.find(index);
     }
 
     //
@@ -1969,7 +1993,7 @@ IceInternal::BasicStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patc
     PatchEntry e;
     e.patchFunc = patchFunc;
     e.patchAddr = patchAddr;
-    q->second.push_back(e);
+    q->push_back(e);
 }
 
 void
@@ -1979,7 +2003,7 @@ IceInternal::BasicStream::EncapsDecoder::unmarshal(Int index, const Ice::ObjectP
     // Add the object to the map of un-marshalled objects, this must
     // be done before reading the objects (for circular references).
     // 
-    _unmarshaledMap.insert(make_pair(index, v));
+    _unmarshaledMap.insert(index, v);
 
     //
     // Read the object.
@@ -1989,15 +2013,15 @@ IceInternal::BasicStream::EncapsDecoder::unmarshal(Int index, const Ice::ObjectP
     //
     // Patch all instances now that the object is un-marshalled.
     //
-    PatchMap::iterator patchPos = _patchMap.find(index);
-    if(patchPos != _patchMap.end())
+    PatchList* patchList = _patchMap.find(index);
+    if(patchList)
     {
-        assert(patchPos->second.size() > 0);
+        assert(patchList->size() > 0);
         
         //
         // Patch all pointers that refer to the instance.
         //
-        for(PatchList::iterator k = patchPos->second.begin(); k != patchPos->second.end(); ++k)
+        for(PatchList::iterator k = patchList->begin(); k != patchList->end(); ++k)
         {
             (*k->patchFunc)(k->patchAddr, v);
         }
@@ -2006,7 +2030,7 @@ IceInternal::BasicStream::EncapsDecoder::unmarshal(Int index, const Ice::ObjectP
         // Clear out the patch map for that index -- there is nothing left
         // to patch for that index for the time being.
         //
-        _patchMap.erase(patchPos);
+        _patchMap.erase(index);
     }
 
     if(_objectList.empty() && _patchMap.empty())
@@ -2892,14 +2916,14 @@ IceInternal::BasicStream::EncapsDecoder11::readSlicedData()
 Int
 IceInternal::BasicStream::EncapsEncoder::registerTypeId(const string& typeId)
 {
-    TypeIdWriteMap::const_iterator p = _typeIdMap.find(typeId);
-    if(p != _typeIdMap.end())
+    const Int* p = _typeIdMap.find(typeId);
+    if(p)
     {
-        return p->second;
+        return *p;
     }
     else
     {
-        _typeIdMap.insert(make_pair(typeId, ++_typeIdIndex));
+        _typeIdMap.insert(typeId, ++_typeIdIndex);
         return -1;
     }
 }
@@ -3007,31 +3031,29 @@ IceInternal::BasicStream::EncapsEncoder10::endSlice()
 void
 IceInternal::BasicStream::EncapsEncoder10::writePendingObjects()
 {
-    while(!_toBeMarshaledMap.empty())
+    while(!_toBeMarshaledList.empty())
     {
         //
-        // Consider the to be marshalled objects as marshalled now,
-        // this is necessary to avoid adding again the "to be
-        // marshalled objects" into _toBeMarshaledMap while writing
-        // objects.
+        // The to be marshalled objects are already in the marshaled
+        // map, objects registered while writing this round are added
+        // to _toBeMarshaledList for the next round. IDs are allocated
+        // sequentially so the objects of a round have consecutive IDs.
         //
-        _marshaledMap.insert(_toBeMarshaledMap.begin(), _toBeMarshaledMap.end());
-
-        PtrToIndexMap savedMap;
-        savedMap.swap(_toBeMarshaledMap);
-        _stream->writeSize(static_cast<Int>(savedMap.size()));
-        for(PtrToIndexMap::iterator p = savedMap.begin(); p != savedMap.end(); ++p)
+        _writeList.swap(_toBeMarshaledList);
+        Int index = _objectIdIndex - static_cast<Int>(_writeList.size());
+        _stream->writeSize(static_cast<Int>(_writeList.size()));
+        for(ObjectList::iterator p = _writeList.begin(); p != _writeList.end(); ++p)
         {
             //
             // Ask the instance to marshal itself. Any new class
             // instances that are triggered by the classes marshaled
-            // are added to toBeMarshaledMap.
+            // are added to toBeMarshaledList.
             //
-            _stream->write(p->second);
+            _stream->write(++index);
 
             try
             {
-                p->first->ice_preMarshal();
+                (*p)->ice_preMarshal();
             }
             catch(const std::exception& ex)
             {
@@ -3044,8 +3066,9 @@ IceInternal::BasicStream::EncapsEncoder10::writePendingObjects()
                 out << "unknown exception raised by ice_preMarshal";
             }
 
-            p->first->__write(_stream);
+            (*p)->__write(_stream);
         }
+        _writeList.clear();
     }
     _stream->writeSize(0); // Zero marker indicates end of sequence of sequences of instances.
 }
@@ -3056,28 +3079,21 @@ IceInternal::BasicStream::EncapsEncoder10::registerObject(const ObjectPtr& v)
     assert(v);
 
     //
-    // Look for this instance in the to-be-marshaled map.
-    //
-    PtrToIndexMap::const_iterator p = _toBeMarshaledMap.find(v);
-    if(p != _toBeMarshaledMap.end())
-    {
-        return p->second;
-    }
-
-    //
-    // Didn't find it, try the marshaled map next.
+    // Look for this instance in the marshaled map, it also contains
+    // the instances to be marshaled.
     //
-    PtrToIndexMap::const_iterator q = _marshaledMap.find(v);
-    if(q != _marshaledMap.end())
+    const Int* p = _marshaledMap.find(v);
+    if(p)
     {
-        return q->second;
+        return *p;
     }
 
     //
     // We haven't seen this instance previously, create a new
-    // index, and insert it into the to-be-marshaled map.
+    // index, and add it to the to-be-marshaled list.
     //
-    _toBeMarshaledMap.insert(make_pair(v, ++_objectIdIndex));
+    _marshaledMap.insert(v, ++_objectIdIndex);
+    _toBeMarshaledList.push_back(v);
     return _objectIdIndex;
 }
 
@@ -3097,17 +3113,17 @@ IceInternal::BasicStream::EncapsEncoder11::write(const ObjectPtr& v)
         // each slice and is always read (even if the Slice is
         // unknown).
         // 
-        PtrToIndexMap::const_iterator p = _current->indirectionMap.find(v);
-        if(p == _current->indirectionMap.end())
+        const Int* p = _current->indirectionMap.find(v);
+        if(!p)
         {
             _current->indirectionTable.push_back(v);
             Int idx = static_cast<Int>(_current->indirectionTable.size()); // Position + 1 (0 is reserved for nil)
-            _current->indirectionMap.insert(make_pair(v, idx));
+            _current->indirectionMap.insert(v, idx);
             _stream->writeSize(idx); 
         }
         else
         {
-            _stream->writeSize(p->second);
+            _stream->writeSize(*p);
         }
     }
     else
@@ -3334,10 +3350,10 @@ IceInternal::BasicStream::EncapsEncoder11::writeInstance(const ObjectPtr& v)
     //
     // If the instance was already marshaled, just write it's ID.
     //
-    PtrToIndexMap::const_iterator q = _marshaledMap.find(v);
-    if(q != _marshaledMap.end())
+    const Int* q = _marshaledMap.find(v);
+    if(q)
     {
-        _stream->writeSize(q->second);
+        _stream->writeSize(*q);
         return;
     }
 
@@ -3345,7 +3361,7 @@ IceInternal::BasicStream::EncapsEncoder11::writeInstance(const ObjectPtr& v)
     // We haven't seen this instance previously, create a new ID,
     // insert it into the marshaled map, and write the instance.
     //
-    _marshaledMap.insert(make_pair(v, ++_objectIdIndex));
+    _marshaledMap.insert(v, ++_objectIdIndex);
 
     try
     {
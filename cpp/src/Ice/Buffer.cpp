@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Buffer.h>
+#include <Ice/BufferPool.h>
 #include <Ice/LocalException.h>
 
 using namespace std;
@@ -30,6 +31,16 @@ IceInternal::Buffer::Container::Container(size_type maxCapacity) :
 {
 }
 
+IceInternal::Buffer::Container::Container(size_type maxCapacity, const BufferPoolPtr& pool) :
+    _buf(0),
+    _size(0),
+    _capacity(0),
+    _maxCapacity(maxCapacity),
+    _shrinkCounter(0),
+    _pool(pool)
+{
+}
+
 IceInternal::Buffer::Container::Container(const_iterator beg, const_iterator end) :
     _buf(const_cast<iterator>(beg)),
     _size(end - beg),
@@ -43,7 +54,14 @@ IceInternal::Buffer::Container::~Container()
 {
     if(_buf && _capacity > 0)
     {
-        ::free(_buf);
+        if(_pool)
+        {
+            _pool->deallocate(_buf, _capacity);
+        }
+        else
+        {
+            ::free(_buf);
+        }
     }
 }
 
@@ -57,6 +75,10 @@ IceInternal::Buffer::Container::swap(Container& other)
     std::swap(_size, other._size);
     std::swap(_capacity, other._capacity);
     std::swap(_shrinkCounter, other._shrinkCounter);
+    if(_pool.get() != other._pool.get())
+    {
+        std::swap(_pool, other._pool);
+    }
 }
 
 void
@@ -64,7 +86,17 @@ IceInternal::Buffer::Container::clear()
 {
     assert(!_buf || _capacity > 0);
 
-    free(_buf);
+    if(_pool)
+    {
+        if(_buf)
+        {
+            _pool->deallocate(_buf, _capacity);
+        }
+    }
+    else
+    {
+        free(_buf);
+    }
     _buf = 0;
     _size = 0;
     _capacity = 0;
@@ -90,6 +122,23 @@ IceInternal::Buffer::Container::reserve(size_type n)
         return;
     }
     
+    if(_pool)
+    {
+        //
+        // The pool rounds the capacity up to the size of its buffers.
+        //
+        try
+        {
+            _buf = _pool->reallocate(_buf, std::min(_size, _capacity), c, _capacity);
+        }
+        catch(...)
+        {
+            _capacity = c; // Restore the previous capacity.
+            throw;
+        }
+        return;
+    }
+
     pointer p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     if(!p)
     {
@@ -0,0 +1,329 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/BufferPool.h>
+#include <Ice/Metrics.h>
+#include <cstring>
+#include <sstream>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceMX;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(BufferPool* p) { return p; }
+
+namespace
+{
+
+//
+// The size of the smallest pooled buffers, buffers are never smaller
+// than 240 bytes (see Buffer::Container::reserve()).
+//
+const size_t minBufferSize = 256;
+
+//
+// The maximum number of buffers of each size kept by a striped cache.
+//
+const size_t stripeCacheSize = 8;
+
+//
+// The pool metrics are computed when they are retrieved, the maps
+// don't need to be updated.
+//
+class BufferPoolUpdater : public Updater
+{
+public:
+
+    virtual void
+    update()
+    {
+    }
+};
+BufferPoolUpdater bufferPoolUpdater;
+
+class BufferPoolMetricsMapI : public MetricsMapI
+{
+public:
+
+    BufferPoolMetricsMapI(const string& mapPrefix, const PropertiesPtr& properties, const BufferPoolPtr& pool) :
+        MetricsMapI(mapPrefix, properties), _pool(pool)
+    {
+    }
+
+    BufferPoolMetricsMapI(const BufferPoolMetricsMapI& map) : MetricsMapI(map), _pool(map._pool)
+    {
+    }
+
+    virtual void
+    destroy()
+    {
+    }
+
+    virtual MetricsFailuresSeq
+    getFailures()
+    {
+        return MetricsFailuresSeq();
+    }
+
+    virtual MetricsFailures
+    getFailures(const string& id)
+    {
+        MetricsFailures failures;
+        failures.id = id;
+        return failures;
+    }
+
+    //
+    // The pool counters are always grouped by buffer size, the map
+    // GroupBy, Accept and Reject properties don't apply.
+    //
+    virtual MetricsMap
+    getMetrics() const
+    {
+        return _pool->getMetrics();
+    }
+
+    virtual MetricsMapI*
+    clone() const
+    {
+        return new BufferPoolMetricsMapI(*this);
+    }
+
+private:
+
+    const BufferPoolPtr _pool;
+};
+
+}
+
+IceInternal::BufferPool::BufferPool(size_t maxSize, size_t maxBuffers) :
+    _maxSize(max(maxSize, minBufferSize)),
+    _maxBuffers(maxBuffers),
+    _sizeClasses(0)
+{
+    for(size_t sz = minBufferSize; sz < _maxSize; sz *= 2)
+    {
+        ++_sizeClasses;
+    }
+    ++_sizeClasses;
+    const_cast<size_t&>(_maxSize) = minBufferSize << (_sizeClasses - 1);
+
+    for(size_t i = 0; i < stripeCount; ++i)
+    {
+        _caches[i].buffers.resize(_sizeClasses);
+        _caches[i].hits.resize(_sizeClasses, 0);
+        _caches[i].misses.resize(_sizeClasses, 0);
+    }
+    _overflow.buffers.resize(_sizeClasses);
+}
+
+IceInternal::BufferPool::~BufferPool()
+{
+    for(size_t i = 0; i <= stripeCount; ++i)
+    {
+        Cache& cache = i < stripeCount ? _caches[i] : _overflow;
+        for(vector<vector<Byte*> >::const_iterator p = cache.buffers.begin(); p != cache.buffers.end(); ++p)
+        {
+            for(vector<Byte*>::const_iterator q = p->begin(); q != p->end(); ++q)
+            {
+                ::free(*q);
+            }
+        }
+    }
+}
+
+Byte*
+IceInternal::BufferPool::allocate(size_t& size)
+{
+    size_t c = sizeClass(size);
+    if(c < _sizeClasses)
+    {
+        size = minBufferSize << c;
+
+        Cache& cache = stripeCache();
+        {
+            IceUtil::Mutex::Lock sync(cache);
+            if(!cache.buffers[c].empty())
+            {
+                Byte* p = cache.buffers[c].back();
+                cache.buffers[c].pop_back();
+                ++cache.hits[c];
+                return p;
+            }
+        }
+
+        Byte* p = 0;
+        {
+            IceUtil::Mutex::Lock sync(_overflow);
+            if(!_overflow.buffers[c].empty())
+            {
+                p = _overflow.buffers[c].back();
+                _overflow.buffers[c].pop_back();
+            }
+        }
+
+        IceUtil::Mutex::Lock sync(cache);
+        if(p)
+        {
+            ++cache.hits[c];
+            return p;
+        }
+        ++cache.misses[c];
+    }
+
+    Byte* p = reinterpret_cast<Byte*>(::malloc(size));
+    if(!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+Byte*
+IceInternal::BufferPool::reallocate(Byte* buf, size_t used, size_t capacity, size_t& size)
+{
+    if(!buf)
+    {
+        return allocate(size);
+    }
+
+    if(size > _maxSize && capacity > _maxSize)
+    {
+        //
+        // Neither buffer is pooled, use realloc.
+        //
+        Byte* p = reinterpret_cast<Byte*>(::realloc(buf, size));
+        if(!p)
+        {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+    size_t c = sizeClass(size);
+    if(c < _sizeClasses && (minBufferSize << c) == capacity)
+    {
+        size = capacity; // Same size class, keep the buffer.
+        return buf;
+    }
+
+    Byte* p = allocate(size);
+    memcpy(p, buf, min(used, size));
+    deallocate(buf, capacity);
+    return p;
+}
+
+void
+IceInternal::BufferPool::deallocate(Byte* buf, size_t capacity)
+{
+    size_t c = sizeClass(capacity);
+    if(c < _sizeClasses && (minBufferSize << c) == capacity)
+    {
+        Cache& cache = stripeCache();
+        {
+            IceUtil::Mutex::Lock sync(cache);
+            if(cache.buffers[c].size() < stripeCacheSize)
+            {
+                cache.buffers[c].push_back(buf);
+                return;
+            }
+        }
+
+        IceUtil::Mutex::Lock sync(_overflow);
+        if(_overflow.buffers[c].size() < _maxBuffers)
+        {
+            _overflow.buffers[c].push_back(buf);
+            return;
+        }
+    }
+    ::free(buf);
+}
+
+MetricsMap
+IceInternal::BufferPool::getMetrics() const
+{
+    MetricsMap metrics;
+    for(size_t c = 0; c < _sizeClasses; ++c)
+    {
+        BufferPoolMetricsPtr m = new BufferPoolMetrics();
+        ostringstream os;
+        os << (minBufferSize << c);
+        m->id = os.str();
+        for(size_t i = 0; i <= stripeCount; ++i)
+        {
+            const Cache& cache = i < stripeCount ? _caches[i] : _overflow;
+            IceUtil::Mutex::Lock sync(cache);
+            m->current += static_cast<Int>(cache.buffers[c].size());
+            if(i < stripeCount)
+            {
+                m->hits += cache.hits[c];
+                m->misses += cache.misses[c];
+            }
+        }
+        m->total = m->hits + m->misses;
+        metrics.push_back(m);
+    }
+    return metrics;
+}
+
+size_t
+IceInternal::BufferPool::sizeClass(size_t size) const
+{
+    if(size > _maxSize)
+    {
+        return _sizeClasses;
+    }
+
+    size_t c = 0;
+    for(size_t sz = minBufferSize; sz < size; sz *= 2)
+    {
+        ++c;
+    }
+    return c;
+}
+
+IceInternal::BufferPool::Cache&
+IceInternal::BufferPool::stripeCache()
+{
+    //
+    // The caches are lock striped: threads are spread over a fixed
+    // number of caches by thread id, and threads which hash to the
+    // same stripe share its cache and its mutex. Unlike thread-local
+    // caches, the stripes don't need to be released when threads
+    // terminate and the pool can be destroyed while threads which
+    // used it are still running.
+    //
+    size_t h = 0;
+#ifdef _WIN32
+    h = static_cast<size_t>(GetCurrentThreadId());
+#else
+    pthread_t id = pthread_self();
+    memcpy(&h, &id, min(sizeof(h), sizeof(id)));
+#endif
+    h ^= h >> 7;
+    h ^= h >> 13;
+    return _caches[h % stripeCount];
+}
+
+IceInternal::BufferPoolMetricsMapFactory::BufferPoolMetricsMapFactory(const BufferPoolPtr& pool) :
+    MetricsMapFactory(&bufferPoolUpdater),
+    _pool(pool)
+{
+}
+
+MetricsMapIPtr
+IceInternal::BufferPoolMetricsMapFactory::create(const string& mapPrefix, const PropertiesPtr& properties)
+{
+    return new BufferPoolMetricsMapI(mapPrefix, properties, _pool);
+}
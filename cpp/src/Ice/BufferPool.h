@@ -0,0 +1,93 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <Ice/BufferPoolF.h>
+#include <Ice/MetricsAdminI.h>
+#include <Ice/MetricsObserverI.h>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// A pool of message buffer memory, enabled with the Ice.BufferPool
+// property. Buffers are allocated in power of two size classes up to
+// Ice.BufferPool.MaxSize, larger buffers are allocated with malloc.
+// Released buffers are kept in a fixed set of lock-striped caches,
+// selected by thread id, and once a cache is full, in a shared
+// overflow list bounded by Ice.BufferPool.MaxBuffers.
+//
+class BufferPool : public IceUtil::Shared
+{
+public:
+
+    BufferPool(size_t, size_t);
+    virtual ~BufferPool();
+
+    //
+    // Allocate a buffer of at least the given size and set the size
+    // to the capacity of the allocated buffer.
+    //
+    Ice::Byte* allocate(size_t&);
+
+    //
+    // Move the first bytes of the given buffer to a buffer of at
+    // least the given capacity and release the given buffer.
+    //
+    Ice::Byte* reallocate(Ice::Byte*, size_t, size_t, size_t&);
+
+    void deallocate(Ice::Byte*, size_t);
+
+    IceMX::MetricsMap getMetrics() const;
+
+private:
+
+    enum { stripeCount = 16 };
+
+    size_t sizeClass(size_t) const;
+
+    struct Cache : public IceUtil::Mutex
+    {
+        std::vector<std::vector<Ice::Byte*> > buffers;
+        std::vector<Ice::Long> hits;
+        std::vector<Ice::Long> misses;
+    };
+    Cache& stripeCache();
+
+    const size_t _maxSize;
+    const size_t _maxBuffers;
+    size_t _sizeClasses;
+    Cache _caches[stripeCount];
+    Cache _overflow;
+};
+
+//
+// Factory for the BufferPool map of the metrics admin facet.
+//
+class BufferPoolMetricsMapFactory : public MetricsMapFactory
+{
+public:
+
+    BufferPoolMetricsMapFactory(const BufferPoolPtr&);
+
+    virtual MetricsMapIPtr create(const std::string&, const Ice::PropertiesPtr&);
+
+private:
+
+    const BufferPoolPtr _pool;
+};
+
+}
+
+#endif
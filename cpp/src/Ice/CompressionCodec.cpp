@@ -0,0 +1,302 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/CompressionCodec.h>
+#include <Ice/Protocol.h>
+#include <Ice/LocalException.h>
+#ifndef ICE_OS_WINRT
+#    include <bzlib.h>
+#endif
+#ifdef ICE_USE_LZ4
+#    include <lz4.h>
+#endif
+#ifdef ICE_USE_ZSTD
+#    include <zstd.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#ifndef ICE_OS_WINRT
+string
+getBZ2Error(int bzError)
+{
+    if(bzError == BZ_RUN_OK)
+    {
+        return ": BZ_RUN_OK";
+    }
+    else if(bzError == BZ_FLUSH_OK)
+    {
+        return ": BZ_FLUSH_OK";
+    }
+    else if(bzError == BZ_FINISH_OK)
+    {
+        return ": BZ_FINISH_OK";
+    }
+    else if(bzError == BZ_STREAM_END)
+    {
+        return ": BZ_STREAM_END";
+    }
+    else if(bzError == BZ_CONFIG_ERROR)
+    {
+        return ": BZ_CONFIG_ERROR";
+    }
+    else if(bzError == BZ_SEQUENCE_ERROR)
+    {
+        return ": BZ_SEQUENCE_ERROR";
+    }
+    else if(bzError == BZ_PARAM_ERROR)
+    {
+        return ": BZ_PARAM_ERROR";
+    }
+    else if(bzError == BZ_MEM_ERROR)
+    {
+        return ": BZ_MEM_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR)
+    {
+        return ": BZ_DATA_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    {
+        return ": BZ_DATA_ERROR_MAGIC";
+    }
+    else if(bzError == BZ_IO_ERROR)
+    {
+        return ": BZ_IO_ERROR";
+    }
+    else if(bzError == BZ_UNEXPECTED_EOF)
+    {
+        return ": BZ_UNEXPECTED_EOF";
+    }
+    else if(bzError == BZ_OUTBUFF_FULL)
+    {
+        return ": BZ_OUTBUFF_FULL";
+    }
+    else
+    {
+        return "";
+    }
+}
+
+class BZip2Codec : public CompressionCodec
+{
+public:
+
+    virtual Byte
+    id() const
+    {
+        return compressionBZip2;
+    }
+
+    virtual string
+    name() const
+    {
+        return "bzip2";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return static_cast<size_t>(sz * 1.01 + 600);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen, int level) const
+    {
+        unsigned int compressedLen = static_cast<unsigned int>(dstLen);
+        int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(dst), &compressedLen,
+                                               reinterpret_cast<char*>(const_cast<Byte*>(src)),
+                                               static_cast<unsigned int>(srcLen), level, 0, 0);
+        if(bzError != BZ_OK)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
+            throw ex;
+        }
+        return compressedLen;
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen) const
+    {
+        unsigned int uncompressedLen = static_cast<unsigned int>(dstLen);
+        int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(dst), &uncompressedLen,
+                                                 reinterpret_cast<char*>(const_cast<Byte*>(src)),
+                                                 static_cast<unsigned int>(srcLen), 0, 0);
+        if(bzError != BZ_OK)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
+            throw ex;
+        }
+    }
+};
+const BZip2Codec bzip2Codec;
+#endif
+
+#ifdef ICE_USE_LZ4
+class LZ4Codec : public CompressionCodec
+{
+public:
+
+    virtual Byte
+    id() const
+    {
+        return compressionLZ4;
+    }
+
+    virtual string
+    name() const
+    {
+        return "lz4";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return static_cast<size_t>(LZ4_compressBound(static_cast<int>(sz)));
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen, int) const
+    {
+        //
+        // LZ4 has a single compression level, Ice.Compression.Level
+        // doesn't apply.
+        //
+        int compressedLen = LZ4_compress_default(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+                                                 static_cast<int>(srcLen), static_cast<int>(dstLen));
+        if(compressedLen <= 0)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "LZ4_compress_default failed";
+            throw ex;
+        }
+        return static_cast<size_t>(compressedLen);
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen) const
+    {
+        int uncompressedLen = LZ4_decompress_safe(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+                                                  static_cast<int>(srcLen), static_cast<int>(dstLen));
+        if(uncompressedLen < 0 || static_cast<size_t>(uncompressedLen) != dstLen)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "LZ4_decompress_safe failed";
+            throw ex;
+        }
+    }
+};
+const LZ4Codec lz4Codec;
+#endif
+
+#ifdef ICE_USE_ZSTD
+class ZstdCodec : public CompressionCodec
+{
+public:
+
+    virtual Byte
+    id() const
+    {
+        return compressionZstd;
+    }
+
+    virtual string
+    name() const
+    {
+        return "zstd";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return ZSTD_compressBound(sz);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen, int level) const
+    {
+        size_t compressedLen = ZSTD_compress(dst, dstLen, src, srcLen, level);
+        if(ZSTD_isError(compressedLen))
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = string("ZSTD_compress failed: ") + ZSTD_getErrorName(compressedLen);
+            throw ex;
+        }
+        return compressedLen;
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen) const
+    {
+        size_t uncompressedLen = ZSTD_decompress(dst, dstLen, src, srcLen);
+        if(ZSTD_isError(uncompressedLen))
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = string("ZSTD_decompress failed: ") + ZSTD_getErrorName(uncompressedLen);
+            throw ex;
+        }
+        if(uncompressedLen != dstLen)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "ZSTD_decompress failed: unexpected uncompressed size";
+            throw ex;
+        }
+    }
+};
+const ZstdCodec zstdCodec;
+#endif
+
+const CompressionCodec* codecs[] =
+{
+#ifndef ICE_OS_WINRT
+    &bzip2Codec,
+#endif
+#ifdef ICE_USE_LZ4
+    &lz4Codec,
+#endif
+#ifdef ICE_USE_ZSTD
+    &zstdCodec,
+#endif
+    0
+};
+
+}
+
+const CompressionCodec*
+IceInternal::findCompressionCodec(Byte id)
+{
+    for(const CompressionCodec** p = codecs; *p != 0; ++p)
+    {
+        if((*p)->id() == id)
+        {
+            return *p;
+        }
+    }
+    return 0;
+}
+
+const CompressionCodec*
+IceInternal::findCompressionCodec(const string& name)
+{
+    for(const CompressionCodec** p = codecs; *p != 0; ++p)
+    {
+        if((*p)->name() == name)
+        {
+            return *p;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_COMPRESSION_CODEC_H
+#define ICE_COMPRESSION_CODEC_H
+
+#include <Ice/Config.h>
+#include <string>
+
+namespace IceInternal
+{
+
+//
+// A protocol compression codec. Codecs are stateless and registered
+// statically, the codec id is the compression status carried in the
+// header of the messages compressed with the codec.
+//
+class CompressionCodec
+{
+public:
+
+    virtual ~CompressionCodec() { }
+
+    virtual Ice::Byte id() const = 0;
+    virtual std::string name() const = 0;
+
+    //
+    // Return the maximum size of the compressed data for the given
+    // uncompressed size.
+    //
+    virtual size_t compressBound(size_t) const = 0;
+
+    //
+    // Compress the source buffer into the destination buffer and
+    // return the size of the compressed data. The destination buffer
+    // must be at least compressBound() bytes long. Both methods raise
+    // CompressionException on failure.
+    //
+    virtual size_t compress(const Ice::Byte*, size_t, Ice::Byte*, size_t, int) const = 0;
+    virtual void uncompress(const Ice::Byte*, size_t, Ice::Byte*, size_t) const = 0;
+};
+
+//
+// Find a codec by compression status or by name. Returns 0 if the
+// codec is unknown or if support for it wasn't built in.
+//
+const CompressionCodec* findCompressionCodec(Ice::Byte);
+const CompressionCodec* findCompressionCodec(const std::string&);
+
+}
+
+#endif
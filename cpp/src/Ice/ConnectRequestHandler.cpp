@@ -218,7 +218,7 @@ ConnectRequestHandler::sendRequest(Outgoing* out)
     // Must be called first, _compress might not be initialized before this returns.
     Ice::ConnectionIPtr connection = getConnection(true);
     assert(connection);
-    if(!connection->sendRequest(out, _compress, _response) || _response)
+    if(!connection->sendRequest(out, _compress, _response, _coalesce) || _response)
     {
         return _connection.get(); // The request hasn't been sent or we're expecting a response.
     }
@@ -241,7 +241,7 @@ ConnectRequestHandler::sendAsyncRequest(const OutgoingAsyncPtr& out)
             return AsyncStatusQueued;
         }
     }
-    return _connection->sendAsyncRequest(out, _compress, _response);
+    return _connection->sendAsyncRequest(out, _compress, _response, _coalesce);
 }
 
 bool
@@ -413,7 +413,7 @@ ConnectRequestHandler::flushRequests()
             Request& req = _requests.front();
             if(req.out)
             {
-                if(_connection->sendAsyncRequest(req.out, _compress, _response) & AsyncStatusInvokeSentCallback)
+                if(_connection->sendAsyncRequest(req.out, _compress, _response, _coalesce) & AsyncStatusInvokeSentCallback)
                 {
                     sentCallbacks.push_back(req.out);
                 }
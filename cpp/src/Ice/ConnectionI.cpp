@@ -25,9 +25,8 @@
 #include <Ice/LocalException.h>
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
-#ifndef ICE_OS_WINRT
-#    include <bzlib.h>
-#endif
+#include <Ice/CompressionCodec.h>
+#include <Ice/InstrumentationI.h>
 
 using namespace std;
 using namespace Ice;
@@ -41,6 +40,11 @@ namespace
 
 const ::std::string __flushBatchRequests_name = "flushBatchRequests";
 
+//
+// The maximum number of messages sent with a single gather write.
+//
+const size_t maxGatherMessages = 64;
+
 
 class TimeoutCallback : public IceUtil::TimerTask
 {
@@ -61,6 +65,27 @@ private:
     Ice::ConnectionI* _connection;
 };
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+class CoalesceTimeoutCallback : public IceUtil::TimerTask
+{
+public:
+
+    CoalesceTimeoutCallback(Ice::ConnectionI* connection) : _connection(connection)
+    {
+    }
+
+    void
+    runTimerTask()
+    {
+        _connection->coalesceTimedOut();
+    }
+    
+private:
+
+    Ice::ConnectionI* _connection;
+};
+#endif
+
 class DispatchDispatcherCall : public DispatcherCall
 {
 public:
@@ -104,6 +129,102 @@ private:
     BasicStream _stream;
 };
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+class DatagramDispatcherCall : public DispatcherCall
+{
+public:
+
+    DatagramDispatcherCall(const ConnectionIPtr& connection, BasicStream& batch,
+                           const vector<ConnectionI::DatagramRequest>& requests) :
+        _connection(connection),
+        _batch(batch.instance(), currentProtocolEncoding),
+        _requests(requests)
+    {
+        _batch.swap(batch);
+    }
+
+    virtual void
+    run()
+    {
+        _connection->dispatchDatagrams(_batch, _requests);
+    }
+
+private:
+
+    ConnectionIPtr _connection;
+    BasicStream _batch;
+    vector<ConnectionI::DatagramRequest> _requests;
+};
+#endif
+
+//
+// Calls the writable callback of a connection from the thread pool.
+//
+class WritableCallbackCall : public DispatchWorkItem
+{
+public:
+
+    WritableCallbackCall(const InstancePtr& instance, const ConnectionWritableCallbackPtr& callback,
+                         const ConnectionPtr& connection) :
+        DispatchWorkItem(instance),
+        _instance(instance),
+        _callback(callback),
+        _connection(connection)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        try
+        {
+            _callback->writable(_connection);
+        }
+        catch(const std::exception& ex)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "connection writable callback exception:\n" << ex << '\n' << _connection->toString();
+        }
+        catch(...)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "connection writable callback exception:\nunknown c++ exception" << '\n'
+                << _connection->toString();
+        }
+    }
+
+private:
+
+    const InstancePtr _instance;
+    const ConnectionWritableCallbackPtr _callback;
+    const ConnectionPtr _connection;
+};
+
+//
+// Notifies an asynchronous oneway request dropped from the send queue,
+// the callbacks can't be called with the connection locked.
+//
+class DroppedRequestCall : public DispatchWorkItem
+{
+public:
+
+    DroppedRequestCall(const InstancePtr& instance, const OutgoingAsyncMessageCallbackPtr& outAsync) :
+        DispatchWorkItem(instance),
+        _outAsync(outAsync)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _outAsync->__finished(SendQueueFullException(__FILE__, __LINE__), false);
+    }
+
+private:
+
+    const OutgoingAsyncMessageCallbackPtr _outAsync;
+};
+
 class FinishDispatcherCall : public DispatcherCall
 {
 public:
@@ -154,7 +275,7 @@ IceInternal::ConnectionReaper::swapConnections(vector<ConnectionIPtr>& connectio
     _connections.swap(connections);
 }
 
-Ice::ConnectionI::Observer::Observer() : _readStreamPos(0), _writeStreamPos(0)
+Ice::ConnectionI::Observer::Observer() : _readStreamPos(0), _writeStreamPos(0), _metricsObserver(0)
 {
 }
 
@@ -202,10 +323,25 @@ Ice::ConnectionI::Observer::finishWrite(Ice::Byte* i)
     _writeStreamPos = 0;
 }
 
+void
+Ice::ConnectionI::Observer::sentMessages(Int num)
+{
+    //
+    // The number of messages sent per write isn't part of the
+    // ConnectionObserver interface, it's only reported to the
+    // metrics observer.
+    //
+    if(_observer && _metricsObserver)
+    {
+        _metricsObserver->sentMessages(num);
+    }
+}
+
 void
 Ice::ConnectionI::Observer::attach(const Ice::Instrumentation::ConnectionObserverPtr& observer)
 {
     ObserverHelperT<Ice::Instrumentation::ConnectionObserver>::attach(observer);
+    _metricsObserver = dynamic_cast<IceInternal::ConnectionObserverI*>(observer.get());
     if(!observer)
     {
         _writeStreamPos = 0;
@@ -532,38 +668,45 @@ Ice::ConnectionI::updateObserver()
                                                                      _observer.get()));
 }
 
-void
+IceUtil::Time
 Ice::ConnectionI::monitor(const IceUtil::Time& now)
 {
+    //
+    // Returns the time at which the connection monitor must check the
+    // connection again: the ACM deadline of an idle connection, `now'
+    // to check a busy connection on the next run of the monitor, or 0
+    // if the connection doesn't need to be monitored anymore.
+    //
     IceUtil::Monitor<IceUtil::Mutex>::TryLock sync(*this);
     if(!sync.acquired())
     {
-        return;
+        return now;
     }
 
-    if(_state != StateActive)
+    if(_state != StateActive || _acmTimeout <= 0)
     {
-        return;
+        return IceUtil::Time();
     }
 
     //
     // Active connection management for idle connections.
     //
-    if(_acmTimeout <= 0 ||
-       !_requests.empty() || !_asyncRequests.empty() || _dispatchCount > 0 ||
+    if(!_requests.empty() || !_asyncRequests.empty() || _dispatchCount > 0 ||
        static_cast<Int>(_readStream.b.size()) > headerSize || !_writeStream.b.empty() || !_batchStream.b.empty())
     {
-        return;
+        return now;
     }
 
     if(now >= _acmAbsoluteTimeout)
     {
         setState(StateClosing, ConnectionTimeoutException(__FILE__, __LINE__));
+        return IceUtil::Time();
     }
+    return _acmAbsoluteTimeout;
 }
 
 bool
-Ice::ConnectionI::sendRequest(Outgoing* out, bool compress, bool response)
+Ice::ConnectionI::sendRequest(Outgoing* out, bool compress, bool response, bool coalesce)
 {
     BasicStream* os = out->os();
 
@@ -587,6 +730,12 @@ Ice::ConnectionI::sendRequest(Outgoing* out, bool compress, bool response)
     //
     _transceiver->checkSendSize(*os, _instance->messageSizeMax());
 
+    //
+    // Synchronous requests wait for the send queue to drain with the
+    // Block policy.
+    //
+    checkSendQueue(os->b.size(), true);
+
     Int requestId = 0;
     if(response)
     {
@@ -622,7 +771,8 @@ Ice::ConnectionI::sendRequest(Outgoing* out, bool compress, bool response)
     try
     {
         OutgoingMessage message(out, os, compress, requestId);
-        sent = sendMessage(message) & AsyncStatusSent;
+        message.oneway = !response;
+        sent = sendMessage(message, coalesce) & AsyncStatusSent;
     }
     catch(const LocalException& ex)
     {
@@ -636,14 +786,14 @@ Ice::ConnectionI::sendRequest(Outgoing* out, bool compress, bool response)
         //
         // Add to the requests map.
         //
-        _requestsHint = _requests.insert(_requests.end(), pair<const Int, Outgoing*>(requestId, out));
+        _requests.insert(requestId, out);
     }
 
     return sent;
 }
 
 AsyncStatus
-Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncPtr& out, bool compress, bool response)
+Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncPtr& out, bool compress, bool response, bool coalesce)
 {
     BasicStream* os = out->__getOs();
 
@@ -661,11 +811,44 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncPtr& out, bool compress, b
     assert(_state > StateNotValidated);
     assert(_state < StateClosing);
 
+    //
+    // The encoded tail of the request, if any, is written after the
+    // request stream with a gather write. It's merged into the request
+    // stream if the whole message must be in a single buffer: to be
+    // compressed, traced or sent with a datagram.
+    //
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
+    out->__mergeTail();
+#else
+    if(out->__getTail() && (compress || _endpoint->datagram() || _traceLevels->protocol >= 1))
+    {
+        out->__mergeTail();
+    }
+#endif
+    Buffer* tail = out->__getTail();
+    size_t size = os->b.size() + (tail ? tail->b.size() : 0);
+
     //
     // Ensure the message isn't bigger than what we can send with the
     // transport.
     //
-    _transceiver->checkSendSize(*os, _instance->messageSizeMax());
+    if(tail)
+    {
+        if(size > _instance->messageSizeMax())
+        {
+            Ex::throwMemoryLimitException(__FILE__, __LINE__, size, _instance->messageSizeMax());
+        }
+    }
+    else
+    {
+        _transceiver->checkSendSize(*os, _instance->messageSizeMax());
+    }
+
+    //
+    // Asynchronous requests can't wait, they fail with
+    // SendQueueFullException with the Block policy.
+    //
+    checkSendQueue(size, false);
 
     Int requestId = 0;
     if(response)
@@ -692,13 +875,15 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncPtr& out, bool compress, b
     }
 
     out->__attachRemoteObserver(initConnectionInfo(), _endpoint, requestId, 
-                                static_cast<Int>(os->b.size() - headerSize - 4));
+                                static_cast<Int>(size - headerSize - 4));
 
     AsyncStatus status = AsyncStatusQueued;
     try
     {
         OutgoingMessage message(out, os, compress, requestId);
-        status = sendMessage(message);
+        message.oneway = !response;
+        message.tail = tail;
+        status = sendMessage(message, coalesce);
     }
     catch(const LocalException& ex)
     {
@@ -712,8 +897,7 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncPtr& out, bool compress, b
         //
         // Add to the async requests map.
         //
-        _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
-                                                   pair<const Int, OutgoingAsyncPtr>(requestId, out));
+        _asyncRequests.insert(requestId, out);
     }
     return status;
 }
@@ -1120,6 +1304,21 @@ Ice::ConnectionI::sendResponse(BasicStream* os, Byte compressFlag)
         }
         
         OutgoingMessage message(os, compressFlag > 0);
+        if(compressFlag > compressionNone)
+        {
+            //
+            // Compress the response with the codec used or requested
+            // by the client, bzip2 if we don't support it.
+            //
+            if(compressFlag > compressionBZip2)
+            {
+                message.codec = findCompressionCodec(static_cast<Byte>(compressFlag & ~compressionCodecRequest));
+            }
+            if(!message.codec)
+            {
+                message.codec = findCompressionCodec(compressionBZip2);
+            }
+        }
         sendMessage(message);
         
         if(_state == StateClosing && _dispatchCount == 0)
@@ -1319,6 +1518,10 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
     ServantManagerPtr servantManager;
     ObjectAdapterPtr adapter;
     OutgoingAsyncPtr outAsync;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    BasicStream datagramBatch(_instance.get(), currentProtocolEncoding);
+    vector<DatagramRequest> datagrams;
+#endif
 
     ThreadPoolMessage<ConnectionI> msg(current, *this);
 
@@ -1341,26 +1544,40 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             unscheduleTimeout(current.operation);
             if(current.operation & SocketOperationWrite && !_writeStream.b.empty())
             {
-                if(_writeStream.i != _writeStream.b.end())
+                if(!messageWritten())
                 {
-                    if(_observer)
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+                    if(!_sendStreams.empty())
                     {
-                        _observer.startWrite(_writeStream.i);
+                        writeMessages();
+                        if(!messageWritten())
+                        {
+                            scheduleTimeout(SocketOperationWrite, _endpoint->timeout());
+                            return;
+                        }
                     }
-                    
-                    if(!_transceiver->write(_writeStream))
+                    else
+#endif
                     {
-                        assert(!_writeStream.b.empty());
-                        scheduleTimeout(SocketOperationWrite, _endpoint->timeout());
-                        return;
-                    }
+                        if(_observer)
+                        {
+                            _observer.startWrite(_writeStream.i);
+                        }
                     
-                    if(_observer)
-                    {
-                        _observer.finishWrite(_writeStream.i);
+                        if(!_transceiver->write(_writeStream))
+                        {
+                            assert(!_writeStream.b.empty());
+                            scheduleTimeout(SocketOperationWrite, _endpoint->timeout());
+                            return;
+                        }
+                    
+                        if(_observer)
+                        {
+                            _observer.finishWrite(_writeStream.i);
+                        }
                     }
                 }
-                assert(_writeStream.i == _writeStream.b.end());
+                assert(messageWritten());
             }
             if(current.operation & SocketOperationRead && !_readStream.b.empty())
             {
@@ -1378,50 +1595,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                         _observer->receivedBytes(static_cast<int>(headerSize));
                     }
                 
-                    ptrdiff_t pos = _readStream.i - _readStream.b.begin();
-                    if(pos < headerSize)
-                    {
-                        //
-                        // This situation is possible for small UDP packets.
-                        //
-                        throw IllegalMessageSizeException(__FILE__, __LINE__);
-                    }
-                
-                    _readStream.i = _readStream.b.begin();
-                    const Byte* m;
-                    _readStream.readBlob(m, static_cast<Int>(sizeof(magic)));
-                    if(m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
-                    {
-                        BadMagicException ex(__FILE__, __LINE__);
-                        ex.badMagic = Ice::ByteSeq(&m[0], &m[0] + sizeof(magic));
-                        throw ex;
-                    }
-                    ProtocolVersion pv;
-                    _readStream.read(pv);
-                    checkSupportedProtocol(pv);
-                    EncodingVersion ev;
-                    _readStream.read(ev);
-                    checkSupportedProtocolEncoding(ev);
-
-                    Byte messageType;
-                    _readStream.read(messageType);
-                    Byte compress;
-                    _readStream.read(compress);
-                    Int size;
-                    _readStream.read(size);
-                    if(size < headerSize)
-                    {
-                        throw IllegalMessageSizeException(__FILE__, __LINE__);
-                    }
-                    if(size > static_cast<Int>(_instance->messageSizeMax()))
-                    {
-                        throw MemoryLimitException(__FILE__, __LINE__);
-                    }
-                    if(size > static_cast<Int>(_readStream.b.size()))
-                    {
-                        _readStream.b.resize(size);
-                    }
-                    _readStream.i = _readStream.b.begin() + pos;
+                    parseHeader();
                 }
 
                 if(_readStream.i != _readStream.b.end())
@@ -1485,6 +1659,12 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 if(current.operation & SocketOperationRead)
                 {
                     parseMessage(current.stream, invokeNum, requestId, compress, servantManager, adapter, outAsync);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+                    if(_endpoint->datagram())
+                    {
+                        parseDatagrams(datagramBatch, datagrams);
+                    }
+#endif
                 }
 
                 if(current.operation & SocketOperationWrite)
@@ -1512,7 +1692,13 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             _readStream.resize(headerSize);
             _readStream.i = _readStream.b.begin();
             _readHeader = true;
-            return;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+            parseDatagrams(datagramBatch, datagrams);
+            if(datagrams.empty())
+#endif
+            {
+                return;
+            }
         }
         catch(const SocketException& ex)
         {
@@ -1531,12 +1717,20 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 _readStream.resize(headerSize);
                 _readStream.i = _readStream.b.begin();
                 _readHeader = true;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+                parseDatagrams(datagramBatch, datagrams);
+#endif
             }
             else
             {
                 setState(StateClosed, ex);
             }
-            return;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+            if(datagrams.empty())
+#endif
+            {
+                return;
+            }
         }
 
         if(_acmTimeout > 0)
@@ -1553,6 +1747,12 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         {
             _dispatcher->dispatch(new DispatchDispatcherCall(this, startCB, sentCBs, compress, requestId, invokeNum,
                                                              servantManager, adapter, outAsync, current.stream), this);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+            if(!datagrams.empty())
+            {
+                _dispatcher->dispatch(new DatagramDispatcherCall(this, datagramBatch, datagrams), this);
+            }
+#endif
         }
         catch(const std::exception& ex)
         {
@@ -1574,6 +1774,12 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
     else
     {
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, current.stream);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+        if(!datagrams.empty())
+        {
+            dispatchDatagrams(datagramBatch, datagrams);
+        }
+#endif
     }
 }
 
@@ -1663,6 +1869,20 @@ ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<SentCallback
     }
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+void
+ConnectionI::dispatchDatagrams(BasicStream& batch, const vector<DatagramRequest>& requests)
+{
+    for(vector<DatagramRequest>::const_iterator p = requests.begin(); p != requests.end(); ++p)
+    {
+        BasicStream stream(_instance.get(), currentProtocolEncoding, batch.b.begin() + p->start,
+                           batch.b.begin() + p->end);
+        stream.i = stream.b.begin() + p->pos;
+        invokeAll(stream, p->invokeNum, 0, p->compress, p->servantManager, p->adapter);
+    }
+}
+#endif
+
 void
 Ice::ConnectionI::finished(ThreadPoolCurrent& current)
 {
@@ -1724,6 +1944,12 @@ Ice::ConnectionI::finish()
 
     if(!_sendStreams.empty())
     {
+        if(_observer && _sendQueueSize > 0)
+        {
+            _observer->queuedBytes(-static_cast<Int>(_sendQueueSize));
+        }
+        _sendQueueSize = 0;
+
         if(!_writeStream.b.empty())
         {
             //
@@ -1740,8 +1966,8 @@ Ice::ConnectionI::finish()
             // _sendStreams to not call finished on a message which is already done.
             //
             if(message->requestId > 0 &&
-               ((message->out && _requests.find(message->requestId) == _requests.end()) ||
-                (message->outAsync && _asyncRequests.find(message->requestId) == _asyncRequests.end())))
+               ((message->out && !_requests.contains(message->requestId)) ||
+                (message->outAsync && !_asyncRequests.contains(message->requestId))))
             {
                 if(message->sent(this, true))
                 {
@@ -1771,13 +1997,13 @@ Ice::ConnectionI::finish()
         _sendStreams.clear(); // Must be cleared before _requests because of Outgoing* references in OutgoingMessage
     }
 
-    for(map<Int, Outgoing*>::const_iterator p = _requests.begin(); p != _requests.end(); ++p)
+    for(RequestTable<Outgoing*>::const_iterator p = _requests.begin(); p != _requests.end(); ++p)
     {
         p->second->finished(*_exception.get(), true);
     }
     _requests.clear();
 
-    for(map<Int, OutgoingAsyncPtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+    for(RequestTable<OutgoingAsyncPtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
     {
         q->second->__finished(*_exception.get(), true);
     }
@@ -1827,6 +2053,18 @@ Ice::ConnectionI::timedOut()
     }
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+void
+Ice::ConnectionI::coalesceTimedOut()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    if(_coalescing)
+    {
+        flushCoalescedMessages();
+    }
+}
+#endif
+
 string
 Ice::ConnectionI::type() const
 {
@@ -1850,6 +2088,20 @@ Ice::ConnectionI::getInfo() const
     return initConnectionInfo();
 }
 
+void
+Ice::ConnectionI::setWritableCallback(const ConnectionWritableCallbackPtr& callback)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    _writableCallback = callback;
+}
+
+bool
+Ice::ConnectionI::isWritable() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    return !_sendQueueFull;
+}
+
 void
 Ice::ConnectionI::exception(const LocalException& ex)
 {
@@ -1912,9 +2164,11 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
     _acmTimeout(0),
     _compressionLevel(1),
+    _compressionMinSize(100),
+    _compressionMaxRatio(100),
+    _compressionCodec(0),
+    _negotiatedCodec(0),
     _nextRequestId(1),
-    _requestsHint(_requests.end()),
-    _asyncRequestsHint(_asyncRequests.end()),
     _batchAutoFlush(
         _instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.BatchAutoFlush", 1) > 0),
     _batchStream(_instance.get(), Ice::currentProtocolEncoding, _batchAutoFlush),
@@ -1922,9 +2176,25 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _batchRequestNum(0),
     _batchRequestCompress(false),
     _batchMarker(0),
+    _sendQueueMaxSize(static_cast<size_t>(max(0,
+        _instance->initializationData().properties->getPropertyAsInt("Ice.SendQueue.MaxSize")))),
+    _sendQueueMaxMessages(static_cast<size_t>(max(0,
+        _instance->initializationData().properties->getPropertyAsInt("Ice.SendQueue.MaxMessages")))),
+    _sendQueuePolicy(SendQueuePolicyBlock),
+    _sendQueueSize(0),
+    _sendQueueFull(false),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    _coalesceWindow(IceUtil::Time::microSeconds(
+        _instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.Coalesce.Window", 100))),
+    _coalesceMaxSize(static_cast<size_t>(max(0,
+        _instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.Coalesce.MaxSize", 16384)))),
+    _coalesceTimeout(new CoalesceTimeoutCallback(this)),
+    _coalescing(false),
+    _coalescedSize(0),
+#endif
     _dispatchCount(0),
     _state(StateNotInitialized),
     _shutdownInitiated(false),
@@ -1942,6 +2212,48 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
         compressionLevel = 9;
     }
 
+    PropertiesPtr properties = _instance->initializationData().properties;
+    const_cast<size_t&>(_compressionMinSize) =
+        static_cast<size_t>(max(0, properties->getPropertyAsIntWithDefault("Ice.Compression.MinSize", 100)));
+    const_cast<int&>(_compressionMaxRatio) =
+        max(1, properties->getPropertyAsIntWithDefault("Ice.Compression.MaxRatio", 100));
+
+    string policy = properties->getPropertyWithDefault("Ice.SendQueue.Policy", "Block");
+    if(policy == "Fail")
+    {
+        const_cast<SendQueuePolicy&>(_sendQueuePolicy) = SendQueuePolicyFail;
+    }
+    else if(policy == "DropOldest")
+    {
+        const_cast<SendQueuePolicy&>(_sendQueuePolicy) = SendQueuePolicyDropOldest;
+    }
+    else if(policy != "Block")
+    {
+        Warning out(_logger);
+        out << "invalid value for Ice.SendQueue.Policy: `" << policy << "'; using Block";
+    }
+
+    //
+    // bzip2 is supported by all peers and doesn't need to be
+    // negotiated, the other codecs are used for requests once the
+    // peer has shown that it supports them.
+    //
+    string codecName = properties->getPropertyWithDefault("Ice.Compression.Codec", "bzip2");
+    _compressionCodec = findCompressionCodec(codecName);
+    if(!_compressionCodec)
+    {
+        _compressionCodec = findCompressionCodec(compressionBZip2);
+        if(_warn && _compressionCodec)
+        {
+            Warning out(_logger);
+            out << "unsupported compression codec `" << codecName << "', using bzip2 instead";
+        }
+    }
+    if(_compressionCodec && _compressionCodec->id() == compressionBZip2)
+    {
+        _negotiatedCodec = _compressionCodec;
+    }
+
     ObjectAdapterI* adapterImpl = _adapter ? dynamic_cast<ObjectAdapterI*>(_adapter.get()) : 0;
     if(adapterImpl)
     {
@@ -1968,13 +2280,19 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     __setNoDelete(true);
     try
     {
+        //
+        // If the thread pool has reactors, the connection is bound to
+        // one of them for its lifetime. The socket of an incoming
+        // connection is given to pick the reactor of its NUMA node.
+        //
         if(adapterImpl)
         {
-            const_cast<ThreadPoolPtr&>(_threadPool) = adapterImpl->getThreadPool();
+            SOCKET fd = connector ? INVALID_SOCKET : _transceiver->getNativeInfo()->fd();
+            const_cast<ThreadPoolPtr&>(_threadPool) = adapterImpl->getThreadPool()->reactor(fd);
         }
         else
         {
-            const_cast<ThreadPoolPtr&>(_threadPool) = _instance->clientThreadPool();
+            const_cast<ThreadPoolPtr&>(_threadPool) = _instance->clientThreadPool()->reactor();
         }
         _threadPool->initialize(this);
     }
@@ -2149,6 +2467,12 @@ Ice::ConnectionI::setState(State state)
             _threadPool->finish(this);
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
             _transceiver->close();
+#else
+            if(_coalescing)
+            {
+                _timer->cancel(_coalesceTimeout);
+                _coalescing = false;
+            }
 #endif
             break;
         }
@@ -2194,10 +2518,22 @@ Ice::ConnectionI::setState(State state)
         ConnectionState newState = toConnectionState(state);
         if(oldState != newState)
         {
+            //
+            // Move the queued bytes to the observer of the new state.
+            //
+            Int queued = static_cast<Int>(_sendQueueSize);
+            if(_observer && queued > 0)
+            {
+                _observer->queuedBytes(-queued);
+            }
             _observer.attach(_instance->getObserver()->getConnectionObserver(initConnectionInfo(),
                                                                              _endpoint, 
                                                                              newState,
                                                                              _observer.get()));
+            if(_observer && queued > 0)
+            {
+                _observer->queuedBytes(queued);
+            }
         }
         if(_observer && state == StateClosed && _exception.get())
         {
@@ -2414,7 +2750,10 @@ void
 Ice::ConnectionI::sendNextMessage(vector<SentCallback>& callbacks)
 {
     assert(!_sendStreams.empty());    
-    assert(!_writeStream.b.empty() && _writeStream.i == _writeStream.b.end());
+    assert(!_writeStream.b.empty() && messageWritten());
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    bool blocked = false;
+#endif
     try
     {
         while(true)
@@ -2443,7 +2782,9 @@ Ice::ConnectionI::sendNextMessage(vector<SentCallback>& callbacks)
                 callbacks.push_back(SentCallback(message->outAsync));
             }
 #endif
+            size_t size = message->size;
             _sendStreams.pop_front();
+            messageDequeued(size);
 
             //
             // If there's nothing left to send, we're done.
@@ -2465,70 +2806,13 @@ Ice::ConnectionI::sendNextMessage(vector<SentCallback>& callbacks)
                 return;
             }
 
-            //
+            message = &_sendStreams.front();
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
+            //
             // Otherwise, prepare the next message stream for writing.
             //
-            message = &_sendStreams.front();
             assert(!message->stream->i);
-#ifndef ICE_OS_WINRT
-            if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
-            {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = 2;
-
-                //
-                // Do compression.
-                //
-                BasicStream stream(_instance.get(), Ice::currentProtocolEncoding);
-                doCompress(*message->stream, stream);
-
-                if(message->outAsync)
-                {
-                    trace("sending asynchronous request", *message->stream, _logger, _traceLevels);
-                }
-                else
-                {
-                    traceSend(*message->stream, _logger, _traceLevels);
-                }
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
-            }
-            else
-            {
-#endif
-                if(message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#endif
-                message->stream->i = message->stream->b.begin();
-                if(message->outAsync)
-                {
-                    trace("sending asynchronous request", *message->stream, _logger, _traceLevels);
-                }
-                else
-                {
-                    traceSend(*message->stream, _logger, _traceLevels);
-                }
-#ifndef ICE_OS_WINRT
-            }
-#endif
+            prepareMessage(*message);
             _writeStream.swap(*message->stream);
 
             //
@@ -2549,6 +2833,37 @@ Ice::ConnectionI::sendNextMessage(vector<SentCallback>& callbacks)
             {
                 _observer.finishWrite(_writeStream.i);
             }
+#else
+            //
+            // Otherwise, prepare the next message stream for writing if
+            // it wasn't already prepared and possibly (partially) sent by
+            // the gather write of a previous message.
+            //
+            if(!message->stream->i)
+            {
+                prepareMessage(*message);
+            }
+            _writeStream.swap(*message->stream);
+
+            //
+            // Send the message along with the queued messages which
+            // follow it. If a previous write would have blocked, there's
+            // no point in trying again before the next write event.
+            //
+            if(!messageWritten())
+            {
+                if(!blocked)
+                {
+                    blocked = !writeMessages();
+                }
+                if(!messageWritten())
+                {
+                    assert(blocked);
+                    scheduleTimeout(SocketOperationWrite, _endpoint->timeout());
+                    return;
+                }
+            }
+#endif
         }
     }
     catch(const Ice::LocalException& ex)
@@ -2570,236 +2885,530 @@ Ice::ConnectionI::sendNextMessage(vector<SentCallback>& callbacks)
     }
 }
 
-AsyncStatus
-Ice::ConnectionI::sendMessage(OutgoingMessage& message)
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message)
 {
-    assert(_state < StateClosed);
+    BasicStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    bool compressed = compressMessage(message, stream);
 
-    message.stream->i = 0; // Reset the message stream iterator before starting sending the message.
+    if(message.outAsync)
+    {
+        trace("sending asynchronous request", *message.stream, _logger, _traceLevels);
+    }
+    else
+    {
+        traceSend(*message.stream, _logger, _traceLevels);
+    }
 
-    if(!_sendStreams.empty())
+    if(compressed)
     {
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0);
-        return AsyncStatusQueued;
+        message.adopt(&stream); // Adopt the compressed stream.
     }
+    message.stream->i = message.stream->b.begin();
+}
 
+bool
+Ice::ConnectionI::messageWritten() const
+{
     //
-    // Attempt to send the message without blocking. If the send blocks, we register
-    // the connection with the selector thread.
+    // The stream of the message at the front of the send queue is
+    // swapped with the write stream, its tail is written after it.
     //
-
-    message.stream->i = message.stream->b.begin();
-#ifndef ICE_OS_WINRT
-    if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    if(_writeStream.i != _writeStream.b.end())
     {
-        //
-        // Message compressed. Request compressed response, if any.
-        //
-        message.stream->b[9] = 2;
+        return false;
+    }
+    if(!_sendStreams.empty())
+    {
+        const Buffer* tail = _sendStreams.front().tail;
+        return !tail || tail->i == tail->b.end();
+    }
+    return true;
+}
 
-        //
-        // Do compression.
-        //
-        BasicStream stream(_instance.get(), Ice::currentProtocolEncoding);
-        doCompress(*message.stream, stream);
-        stream.i = stream.b.begin();
+void
+Ice::ConnectionI::checkSendQueue(size_t size, bool block)
+{
+    if(!sendQueueFull(size))
+    {
+        return;
+    }
 
-        if(message.outAsync)
+    _sendQueueFull = true;
+    switch(_sendQueuePolicy)
+    {
+        case SendQueuePolicyBlock:
         {
-            trace("sending asynchronous request", *message.stream, _logger, _traceLevels);
+            if(!block)
+            {
+                throw SendQueueFullException(__FILE__, __LINE__);
+            }
+
+            //
+            // The queue is drained by the thread pool of the
+            // connection, a thread of this thread pool can't wait for
+            // it. Even if the thread pool has other threads, they
+            // might all be waiting for the queue to drain.
+            //
+            if(_threadPool->isPoolThread())
+            {
+                throw SendQueueFullException(__FILE__, __LINE__);
+            }
+
+            while(sendQueueFull(size) && !_exception.get())
+            {
+                _sendQueueFull = true;
+                wait();
+            }
+            if(_exception.get())
+            {
+                //
+                // The request wasn't sent, it can be retried.
+                //
+                throw LocalExceptionWrapper(*_exception.get(), true);
+            }
+            break;
         }
-        else
+
+        case SendQueuePolicyDropOldest:
         {
-            traceSend(*message.stream, _logger, _traceLevels);
+            while(sendQueueFull(size) && dropOldestOneway())
+            {
+            }
+            if(sendQueueFull(size))
+            {
+                throw SendQueueFullException(__FILE__, __LINE__);
+            }
+            break;
         }
 
-        //
-        // Send the message without blocking.
-        //
-        if(_observer)
+        case SendQueuePolicyFail:
         {
-            _observer.startWrite(stream.i);
+            throw SendQueueFullException(__FILE__, __LINE__);
         }
-        if(_transceiver->write(stream))
-        {
-            if(_observer)
-            {
-                _observer.finishWrite(stream.i);
-            }
+    }
+}
 
-            AsyncStatus status = AsyncStatusSent;
-            if(message.sent(this, false))
+bool
+Ice::ConnectionI::sendQueueFull(size_t size) const
+{
+    //
+    // A message is always accepted by an empty queue, even if it's
+    // larger than the limit.
+    //
+    if(_sendStreams.empty())
+    {
+        return false;
+    }
+    return (_sendQueueMaxSize > 0 && _sendQueueSize + size > _sendQueueMaxSize) ||
+           (_sendQueueMaxMessages > 0 && _sendStreams.size() >= _sendQueueMaxMessages);
+}
+
+bool
+Ice::ConnectionI::dropOldestOneway()
+{
+    //
+    // The first message is being sent and messages which are already
+    // prepared might be partially written by a gather write, only
+    // oneway requests which aren't prepared yet can be dropped. Batch
+    // request flushes are never dropped.
+    //
+    deque<OutgoingMessage>::iterator p = _sendStreams.begin();
+    for(++p; p != _sendStreams.end(); ++p)
+    {
+        if(p->oneway && !p->stream->i)
+        {
+            OutgoingMessage message = *p;
+            _sendStreams.erase(p);
+            messageDequeued(message.size);
+            if(message.outAsync)
             {
-                status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
+                if(message.adopted)
+                {
+                    delete message.stream;
+                }
+                try
+                {
+                    _threadPool->execute(new DroppedRequestCall(_instance, message.outAsync));
+                }
+                catch(const CommunicatorDestroyedException&)
+                {
+                }
             }
-            if(_acmTimeout > 0)
+            else
             {
-                _acmAbsoluteTimeout =
-                    IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::seconds(_acmTimeout);
+                message.finished(SendQueueFullException(__FILE__, __LINE__));
             }
-            return status;
+            return true;
         }
+    }
+    return false;
+}
 
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(&stream);
+void
+Ice::ConnectionI::messageQueued(size_t size)
+{
+    _sendQueueSize += size;
+    if(_observer)
+    {
+        _observer->queuedBytes(static_cast<Int>(size));
     }
-    else
+}
+
+void
+Ice::ConnectionI::messageDequeued(size_t size)
+{
+    assert(_sendQueueSize >= size);
+    _sendQueueSize -= size;
+    if(_observer)
     {
-#endif
-        if(message.compress)
+        _observer->queuedBytes(-static_cast<Int>(size));
+    }
+
+    if(_sendQueueFull &&
+       (_sendQueueMaxSize == 0 || _sendQueueSize <= _sendQueueMaxSize / 2) &&
+       (_sendQueueMaxMessages == 0 || _sendStreams.size() <= _sendQueueMaxMessages / 2))
+    {
+        _sendQueueFull = false;
+        notifyAll(); // Notify the threads waiting for the queue to drain.
+        if(_writableCallback)
         {
-            //
-            // Message not compressed. Request compressed response, if any.
-            //
-            message.stream->b[9] = 1;
+            try
+            {
+                _threadPool->execute(new WritableCallbackCall(_instance, _writableCallback, this));
+            }
+            catch(const CommunicatorDestroyedException&)
+            {
+            }
         }
+    }
+}
+
+bool
+Ice::ConnectionI::compressMessage(OutgoingMessage& message, BasicStream& compressed)
+{
+    if(message.compress)
+    {
+        assert(!message.tail); // The tail is merged into the stream of compressed messages.
 
         //
-        // No compression, just fill in the message size.
+        // Replies are compressed with the codec requested by the
+        // client, requests with the codec negotiated for this
+        // connection.
         //
-        Int sz = static_cast<Int>(message.stream->b.size());
-        const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
-#else
-        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
-#endif
-        message.stream->i = message.stream->b.begin();
-
-        if(message.outAsync)
-        {
-            trace("sending asynchronous request", *message.stream, _logger, _traceLevels);
-        }
-        else
+        const CompressionCodec* codec = message.codec ? message.codec : _negotiatedCodec;
+        if(codec && message.stream->b.size() >= _compressionMinSize && doCompress(*message.stream, compressed, codec))
         {
-            traceSend(*message.stream, _logger, _traceLevels);
+            return true;
         }
 
         //
-        // Send the message without blocking.
+        // Message not compressed. Request compressed response, if
+        // any. If the codec isn't negotiated yet, we request a
+        // response compressed with the configured codec: a peer which
+        // doesn't support it replies with bzip2.
         //
-        if(_observer)
+        if(!codec)
         {
-            _observer.startWrite(message.stream->i);
+            codec = _compressionCodec;
         }
-        if(_transceiver->write(*message.stream))
+        if(codec && codec->id() != compressionBZip2)
         {
-            if(_observer)
-            {
-                _observer.finishWrite(message.stream->i);
-            }
-            AsyncStatus status = AsyncStatusSent;
-            if(message.sent(this, false))
-            {
-                status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
-            }
-            if(_acmTimeout > 0)
-            {
-                _acmAbsoluteTimeout =
-                    IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::seconds(_acmTimeout);
-            }
-            return status;
+            message.stream->b[9] = compressionCodecRequest | codec->id();
+        }
+        else
+        {
+            message.stream->b[9] = compressionSupported;
         }
-
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0); // Adopt the stream.
-#ifndef ICE_OS_WINRT
     }
-#endif
 
-    _writeStream.swap(*_sendStreams.back().stream);
-    scheduleTimeout(SocketOperationWrite, _endpoint->timeout());
-    _threadPool->_register(this, SocketOperationWrite);
-    return AsyncStatusQueued;
+    //
+    // No compression, just fill in the message size.
+    //
+    Int sz = static_cast<Int>(message.stream->b.size() + (message.tail ? message.tail->b.size() : 0));
+    const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+    reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#else
+    copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#endif
+    return false;
 }
 
-#ifndef ICE_OS_WINRT
-static string
-getBZ2Error(int bzError)
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+bool
+Ice::ConnectionI::writeMessages()
 {
-    if(bzError == BZ_RUN_OK)
+    assert(!_sendStreams.empty());
+    assert(!_writeStream.b.empty() && !messageWritten());
+
+    //
+    // Gather the current message with the queued messages which
+    // follow it to send them with a single write, each message is
+    // followed by its tail if it has one. The queued messages are
+    // prepared here and sendNextMessage() notifies them once they
+    // reach the front of the queue.
+    //
+    _writeBuffers.clear();
+    _writeBuffers.push_back(&_writeStream);
+    if(_sendStreams.front().tail)
     {
-        return ": BZ_RUN_OK";
+        _writeBuffers.push_back(_sendStreams.front().tail);
     }
-    else if(bzError == BZ_FLUSH_OK)
+    deque<OutgoingMessage>::iterator p = _sendStreams.begin();
+    for(++p; p != _sendStreams.end() && _writeBuffers.size() < maxGatherMessages; ++p)
     {
-        return ": BZ_FLUSH_OK";
+        if(!p->stream->i)
+        {
+            prepareMessage(*p);
+        }
+        _writeBuffers.push_back(p->stream);
+        if(p->tail)
+        {
+            _writeBuffers.push_back(p->tail);
+        }
     }
-    else if(bzError == BZ_FINISH_OK)
+
+    Int queued = 0;
+    vector<Buffer*>::const_iterator q;
+    for(q = _writeBuffers.begin() + 1; q != _writeBuffers.end(); ++q)
     {
-        return ": BZ_FINISH_OK";
+        queued += static_cast<Int>((*q)->b.end() - (*q)->i);
     }
-    else if(bzError == BZ_STREAM_END)
+
+    if(_observer)
     {
-        return ": BZ_STREAM_END";
+        _observer.startWrite(_writeStream.i);
     }
-    else if(bzError == BZ_CONFIG_ERROR)
+
+    bool written = _transceiver->writeBuffers(_writeBuffers);
+
+    if(_observer)
     {
-        return ": BZ_CONFIG_ERROR";
+        if(_writeStream.i == _writeStream.b.end())
+        {
+            _observer.finishWrite(_writeStream.i);
+        }
+        for(q = _writeBuffers.begin() + 1; q != _writeBuffers.end(); ++q)
+        {
+            queued -= static_cast<Int>((*q)->b.end() - (*q)->i);
+        }
+        if(queued > 0)
+        {
+            _observer->sentBytes(queued);
+        }
+
+        //
+        // Count the front message and the queued messages entirely
+        // written along with it.
+        //
+        Int sent = 0;
+        if(messageWritten())
+        {
+            sent = 1;
+            for(p = _sendStreams.begin() + 1; p != _sendStreams.end(); ++p)
+            {
+                if(p->stream->i != p->stream->b.end() || (p->tail && p->tail->i != p->tail->b.end()))
+                {
+                    break;
+                }
+                ++sent;
+            }
+        }
+        _observer.sentMessages(sent);
     }
-    else if(bzError == BZ_SEQUENCE_ERROR)
+    return written;
+}
+
+void
+Ice::ConnectionI::flushCoalescedMessages()
+{
+    assert(_coalescing && !_sendStreams.empty());
+    _coalescing = false;
+    _timer->cancel(_coalesceTimeout);
+
+    //
+    // The thread pool writes the held messages with a single gather
+    // write once the connection is writable. The messages are not
+    // written from this thread: they must be notified as sent under
+    // the same lock as the write, before their replies are read.
+    //
+    scheduleTimeout(SocketOperationWrite, _endpoint->timeout());
+    _threadPool->_register(this, SocketOperationWrite);
+}
+#endif
+
+AsyncStatus
+Ice::ConnectionI::sendMessage(OutgoingMessage& message, bool coalesce)
+{
+    assert(_state < StateClosed);
+
+    message.stream->i = 0; // Reset the message stream iterator before starting sending the message.
+    message.size = message.stream->b.size();
+    if(message.tail)
     {
-        return ": BZ_SEQUENCE_ERROR";
+        message.tail->i = message.tail->b.begin();
+        message.size += message.tail->b.size();
     }
-    else if(bzError == BZ_PARAM_ERROR)
+
+    if(!_sendStreams.empty())
     {
-        return ": BZ_PARAM_ERROR";
+        _sendStreams.push_back(message);
+        _sendStreams.back().adopt(0);
+        messageQueued(message.size);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+        if(_coalescing)
+        {
+            //
+            // Messages which aren't coalesced, such as replies or the
+            // close connection message, end the coalescing window.
+            //
+            _coalescedSize += message.size;
+            if(!coalesce || _coalescedSize >= _coalesceMaxSize || _sendStreams.size() >= maxGatherMessages)
+            {
+                flushCoalescedMessages();
+            }
+        }
+#endif
+        return AsyncStatusQueued;
     }
-    else if(bzError == BZ_MEM_ERROR)
+
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    if(coalesce && _coalesceWindow > IceUtil::Time() && message.size < _coalesceMaxSize)
     {
-        return ": BZ_MEM_ERROR";
+        //
+        // Hold the request until the end of the coalescing window. The
+        // requests sent over this connection in the meantime are queued
+        // and written along with it by a single gather write.
+        //
+        try
+        {
+            _timer->schedule(_coalesceTimeout, _coalesceWindow);
+            _coalescing = true;
+        }
+        catch(const IceUtil::Exception&)
+        {
+            // The timer is destroyed, send the request right away.
+        }
+
+        if(_coalescing)
+        {
+            _coalescedSize = message.size;
+            _sendStreams.push_back(message);
+            _sendStreams.back().adopt(0);
+            messageQueued(message.size);
+            prepareMessage(_sendStreams.back());
+            _writeStream.swap(*_sendStreams.back().stream);
+            return AsyncStatusQueued;
+        }
     }
-    else if(bzError == BZ_DATA_ERROR)
+#endif
+
+    //
+    // Attempt to send the message without blocking. If the send blocks, we register
+    // the connection with the selector thread.
+    //
+    BasicStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    bool compressed = compressMessage(message, stream);
+    message.stream->i = message.stream->b.begin();
+    stream.i = stream.b.begin();
+
+    if(message.outAsync)
     {
-        return ": BZ_DATA_ERROR";
+        trace("sending asynchronous request", *message.stream, _logger, _traceLevels);
     }
-    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    else
     {
-        return ": BZ_DATA_ERROR_MAGIC";
+        traceSend(*message.stream, _logger, _traceLevels);
     }
-    else if(bzError == BZ_IO_ERROR)
+
+    //
+    // Send the message without blocking.
+    //
+    BasicStream& str = compressed ? stream : *message.stream;
+    if(_observer)
     {
-        return ": BZ_IO_ERROR";
+        _observer.startWrite(str.i);
     }
-    else if(bzError == BZ_UNEXPECTED_EOF)
+    bool written;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    if(message.tail)
     {
-        return ": BZ_UNEXPECTED_EOF";
+        _writeBuffers.clear();
+        _writeBuffers.push_back(&str);
+        _writeBuffers.push_back(message.tail);
+        written = _transceiver->writeBuffers(_writeBuffers);
+        if(_observer && message.tail->i != message.tail->b.begin())
+        {
+            _observer->sentBytes(static_cast<Int>(message.tail->i - message.tail->b.begin()));
+        }
     }
-    else if(bzError == BZ_OUTBUFF_FULL)
+    else
+#endif
     {
-        return ": BZ_OUTBUFF_FULL";
+        written = _transceiver->write(str);
     }
-    else
+    if(written)
     {
-        return "";
+        if(_observer)
+        {
+            _observer.finishWrite(str.i);
+        }
+
+        AsyncStatus status = AsyncStatusSent;
+        if(message.sent(this, false))
+        {
+            status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
+        }
+        if(_acmTimeout > 0)
+        {
+            _acmAbsoluteTimeout = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::seconds(_acmTimeout);
+        }
+        return status;
     }
+
+    _sendStreams.push_back(message);
+    _sendStreams.back().adopt(compressed ? &stream : 0); // Adopt the stream.
+    messageQueued(message.size);
+
+    _writeStream.swap(*_sendStreams.back().stream);
+    scheduleTimeout(SocketOperationWrite, _endpoint->timeout());
+    _threadPool->_register(this, SocketOperationWrite);
+    return AsyncStatusQueued;
 }
 
-void
-Ice::ConnectionI::doCompress(BasicStream& uncompressed, BasicStream& compressed)
+bool
+Ice::ConnectionI::doCompress(BasicStream& uncompressed, BasicStream& compressed, const CompressionCodec* codec)
 {
     const Byte* p;
 
     //
     // Compress the message body, but not the header.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    size_t compressedLen = codec->compressBound(uncompressedLen);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                           &compressedLen,
-                                           reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                           uncompressedLen,
-                                           _compressionLevel, 0, 0);
-    if(bzError != BZ_OK)
-    {
-        CompressionException ex(__FILE__, __LINE__);
-        ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
-        throw ex;
-    }
+    compressedLen = codec->compress(&uncompressed.b[0] + headerSize, uncompressedLen,
+                                    &compressed.b[0] + headerSize + sizeof(Int), compressedLen, _compressionLevel);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
 
+    //
+    // Don't send the compressed message if compression doesn't
+    // reduce its size enough: the compressed message must be strictly
+    // smaller than Ice.Compression.MaxRatio percent of the
+    // uncompressed message.
+    //
+    if(compressed.b.size() * 100 >= uncompressed.b.size() * _compressionMaxRatio)
+    {
+        compressed.b.clear();
+        return false;
+    }
+
+    //
+    // Message compressed. Request compressed response, if any.
+    //
+    uncompressed.b[9] = codec->id();
+
     //
     // Write the size of the compressed stream into the header of the
     // uncompressed stream. Since the header will be copied, this size
@@ -2829,10 +3438,11 @@ Ice::ConnectionI::doCompress(BasicStream& uncompressed, BasicStream& compressed)
     // Copy the header from the uncompressed stream to the compressed one.
     //
     copy(uncompressed.b.begin(), uncompressed.b.begin() + headerSize, compressed.b.begin());
+    return true;
 }
 
 void
-Ice::ConnectionI::doUncompress(BasicStream& compressed, BasicStream& uncompressed)
+Ice::ConnectionI::doUncompress(BasicStream& compressed, BasicStream& uncompressed, const CompressionCodec* codec)
 {
     Int uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
@@ -2843,21 +3453,138 @@ Ice::ConnectionI::doUncompress(BasicStream& compressed, BasicStream& uncompresse
     }
 
     uncompressed.resize(uncompressedSize);
-    unsigned int uncompressedLen = uncompressedSize - headerSize;
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(Int));
-    int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                             &uncompressedLen,
-                                             reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                             compressedLen,
-                                             0, 0);
-    if(bzError != BZ_OK)
-    {
-        CompressionException ex(__FILE__, __LINE__);
-        ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
+    codec->uncompress(&compressed.b[0] + headerSize + sizeof(Int), compressed.b.size() - headerSize - sizeof(Int),
+                      &uncompressed.b[0] + headerSize, uncompressedSize - headerSize);
+
+    copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
+}
+
+void
+Ice::ConnectionI::parseHeader()
+{
+    ptrdiff_t pos = _readStream.i - _readStream.b.begin();
+    if(pos < headerSize)
+    {
+        //
+        // This situation is possible for small UDP packets.
+        //
+        throw IllegalMessageSizeException(__FILE__, __LINE__);
+    }
+
+    _readStream.i = _readStream.b.begin();
+    const Byte* m;
+    _readStream.readBlob(m, static_cast<Int>(sizeof(magic)));
+    if(m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
+    {
+        BadMagicException ex(__FILE__, __LINE__);
+        ex.badMagic = Ice::ByteSeq(&m[0], &m[0] + sizeof(magic));
         throw ex;
     }
+    ProtocolVersion pv;
+    _readStream.read(pv);
+    checkSupportedProtocol(pv);
+    EncodingVersion ev;
+    _readStream.read(ev);
+    checkSupportedProtocolEncoding(ev);
+
+    Byte messageType;
+    _readStream.read(messageType);
+    Byte compress;
+    _readStream.read(compress);
+    Int size;
+    _readStream.read(size);
+    if(size < headerSize)
+    {
+        throw IllegalMessageSizeException(__FILE__, __LINE__);
+    }
+    if(size > static_cast<Int>(_instance->messageSizeMax()))
+    {
+        throw MemoryLimitException(__FILE__, __LINE__);
+    }
+    if(size > static_cast<Int>(_readStream.b.size()))
+    {
+        _readStream.b.resize(size);
+    }
+    _readStream.i = _readStream.b.begin() + pos;
 
-    copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
+}
+
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+void
+Ice::ConnectionI::parseDatagrams(BasicStream& batch, vector<DatagramRequest>& requests)
+{
+    //
+    // The transceiver reads several datagrams with a single system
+    // call. The thread pool doesn't report the datagrams it buffers
+    // as ready to be read, so they are parsed here with the datagram
+    // which caused the read. The requests are copied to the batch
+    // stream and dispatched once the message is processed.
+    //
+    while(_state > StateNotValidated && _state < StateClosed && _transceiver->hasBufferedData())
+    {
+        try
+        {
+            assert(_readHeader && _readStream.i == _readStream.b.begin());
+#ifndef NDEBUG
+            bool read = _transceiver->read(_readStream);
+            assert(read);
+#else
+            _transceiver->read(_readStream);
+#endif
+            _readHeader = false;
+
+            if(_observer)
+            {
+                _observer->receivedBytes(static_cast<int>(headerSize));
+            }
+
+            parseHeader();
+            if(_readStream.i != _readStream.b.end())
+            {
+                throw DatagramLimitException(__FILE__, __LINE__); // The message was truncated.
+            }
+
+            BasicStream stream(_instance.get(), Ice::currentProtocolEncoding);
+            DatagramRequest request;
+            Int requestId = 0;
+            OutgoingAsyncPtr outAsync;
+            parseMessage(stream, request.invokeNum, requestId, request.compress, request.servantManager,
+                         request.adapter, outAsync);
+            assert(!outAsync); // Replies are never sent over datagram connections.
+
+            if(request.invokeNum > 0)
+            {
+                request.start = batch.b.size();
+                request.pos = static_cast<size_t>(stream.i - stream.b.begin());
+                batch.b.resize(request.start + stream.b.size());
+                copy(stream.b.begin(), stream.b.end(), batch.b.begin() + request.start);
+                request.end = batch.b.size();
+                requests.push_back(request);
+            }
+        }
+        catch(const DatagramLimitException&) // Expected.
+        {
+            if(_warnUdp)
+            {
+                Warning out(_instance->initializationData().logger);
+                out << "maximum datagram size of " << _readStream.i - _readStream.b.begin() << " exceeded";
+            }
+            _readStream.resize(headerSize);
+            _readStream.i = _readStream.b.begin();
+            _readHeader = true;
+        }
+        catch(const LocalException& ex)
+        {
+            if(_warn)
+            {
+                Warning out(_instance->initializationData().logger);
+                out << "datagram connection exception:\n" << ex << '\n' << _desc;
+            }
+            _readStream.resize(headerSize);
+            _readStream.i = _readStream.b.begin();
+            _readHeader = true;
+        }
+    }
 }
 #endif
 
@@ -2896,14 +3623,37 @@ Ice::ConnectionI::parseMessage(BasicStream& stream, Int& invokeNum, Int& request
         stream.read(messageType);
         stream.read(compress);
 
-#ifndef ICE_OS_WINRT
-        if(compress == 2)
+        if(compress >= compressionBZip2 && !(compress & compressionCodecRequest))
         {
+            const CompressionCodec* codec = findCompressionCodec(compress);
+            if(!codec)
+            {
+                CompressionException ex(__FILE__, __LINE__);
+                ostringstream os;
+                os << "unsupported compression status " << static_cast<int>(compress);
+                ex.reason = os.str();
+                throw ex;
+            }
             BasicStream ustream(_instance.get(), Ice::currentProtocolEncoding);
-            doUncompress(stream, ustream);
+            doUncompress(stream, ustream, codec);
             stream.b.swap(ustream.b);
         }
-#endif
+
+        //
+        // The first compressed or compression-enabled message from
+        // the peer tells whether it supports the configured codec.
+        //
+        if(!_negotiatedCodec && _compressionCodec && compress != compressionNone)
+        {
+            if((compress & ~compressionCodecRequest) == _compressionCodec->id())
+            {
+                _negotiatedCodec = _compressionCodec;
+            }
+            else
+            {
+                _negotiatedCodec = findCompressionCodec(compressionBZip2);
+            }
+        }
         stream.i = stream.b.begin() + headerSize;
 
         switch(messageType)
@@ -2974,71 +3724,16 @@ Ice::ConnectionI::parseMessage(BasicStream& stream, Int& invokeNum, Int& request
 
                 stream.read(requestId);
 
-                map<Int, Outgoing*>::iterator p = _requests.end();
-                map<Int, OutgoingAsyncPtr>::iterator q = _asyncRequests.end();
-
-                if(_requestsHint != _requests.end())
+                Outgoing* out;
+                if(_requests.take(requestId, out))
                 {
-                    if(_requestsHint->first == requestId)
-                    {
-                        p = _requestsHint;
-                    }
-                }
-
-                if(p == _requests.end())
-                {
-                    if(_asyncRequestsHint != _asyncRequests.end())
-                    {
-                        if(_asyncRequestsHint->first == requestId)
-                        {
-                            q = _asyncRequestsHint;
-                        }
-                    }
-                }
-
-                if(p == _requests.end() && q == _asyncRequests.end())
-                {
-                    p = _requests.find(requestId);
-                }
-
-                if(p == _requests.end() && q == _asyncRequests.end())
-                {
-                    q = _asyncRequests.find(requestId);
-                }
-
-                if(p == _requests.end() && q == _asyncRequests.end())
-                {
-                    throw UnknownRequestIdException(__FILE__, __LINE__);
-                }
-
-                if(p != _requests.end())
-                {
-                    p->second->finished(stream);
-
-                    if(p == _requestsHint)
-                    {
-                        _requests.erase(p++);
-                        _requestsHint = p;
-                    }
-                    else
-                    {
-                        _requests.erase(p);
-                    }
+                    out->finished(stream);
                 }
                 else
                 {
-                    assert(q != _asyncRequests.end());
-
-                    outAsync = q->second;
-
-                    if(q == _asyncRequestsHint)
-                    {
-                        _asyncRequests.erase(q++);
-                        _asyncRequestsHint = q;
-                    }
-                    else
+                    if(!_asyncRequests.take(requestId, outAsync))
                     {
-                        _asyncRequests.erase(q);
+                        throw UnknownRequestIdException(__FILE__, __LINE__);
                     }
 
                     stream.swap(*outAsync->__getIs());
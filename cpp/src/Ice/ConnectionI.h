@@ -33,6 +33,7 @@
 #include <Ice/Dispatcher.h>
 #include <Ice/ObserverHelper.h>
 #include <Ice/ConnectionAsync.h>
+#include <Ice/RequestTable.h>
 
 #include <deque>
 #include <IceUtil/UniquePtr.h>
@@ -43,6 +44,8 @@ namespace IceInternal
 class Outgoing;
 class BatchOutgoing;
 class OutgoingMessageCallback;
+class CompressionCodec;
+class ConnectionObserverI;
 
 class ConnectionReaper : public IceUtil::Mutex, public IceUtil::Shared
 {
@@ -76,6 +79,7 @@ class ICE_API ConnectionI : public Connection, public IceInternal::EventHandler,
         void finishRead(Ice::Byte*);
         void startWrite(Ice::Byte*);
         void finishWrite(Ice::Byte*);
+        void sentMessages(Ice::Int);
 
         void attach(const Ice::Instrumentation::ConnectionObserverPtr&);
 
@@ -83,6 +87,7 @@ class ICE_API ConnectionI : public Connection, public IceInternal::EventHandler,
 
         Ice::Byte* _readStreamPos;
         Ice::Byte* _writeStreamPos;
+        IceInternal::ConnectionObserverI* _metricsObserver; // The observer if it's the metrics observer.
     };
 
 public:
@@ -116,6 +121,28 @@ public:
 #endif
     };
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    //
+    // A request read from a datagram buffered by the transceiver. The
+    // request is stored in a batch stream between start and end, pos
+    // is the position of the request header.
+    //
+    struct DatagramRequest
+    {
+        DatagramRequest() : start(0), end(0), pos(0), compress(0), invokeNum(0)
+        {
+        }
+
+        size_t start;
+        size_t end;
+        size_t pos;
+        Byte compress;
+        Int invokeNum;
+        IceInternal::ServantManagerPtr servantManager;
+        ObjectAdapterPtr adapter;
+    };
+#endif
+
     enum DestructionReason
     {
         ObjectAdapterDeactivated,
@@ -138,10 +165,10 @@ public:
 
     void updateObserver();
 
-    void monitor(const IceUtil::Time&);
+    IceUtil::Time monitor(const IceUtil::Time&);
 
-    bool sendRequest(IceInternal::Outgoing*, bool, bool);
-    IceInternal::AsyncStatus sendAsyncRequest(const IceInternal::OutgoingAsyncPtr&, bool, bool);
+    bool sendRequest(IceInternal::Outgoing*, bool, bool, bool);
+    IceInternal::AsyncStatus sendAsyncRequest(const IceInternal::OutgoingAsyncPtr&, bool, bool, bool);
 
     void prepareBatchRequest(IceInternal::BasicStream*);
     void finishBatchRequest(IceInternal::BasicStream*, bool);
@@ -192,10 +219,15 @@ public:
     virtual IceInternal::NativeInfoPtr getNativeInfo();
 
     void timedOut();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    void coalesceTimedOut();
+#endif
 
     virtual std::string type() const; // From Connection.
     virtual Ice::Int timeout() const; // From Connection.
     virtual ConnectionInfoPtr getInfo() const; // From Connection
+    virtual void setWritableCallback(const ConnectionWritableCallbackPtr&); // From Connection
+    virtual bool isWritable() const; // From Connection
 
     void exception(const LocalException&);
     void invokeException(const LocalException&, int);
@@ -203,6 +235,9 @@ public:
     void dispatch(const StartCallbackPtr&, const std::vector<SentCallback>&, Byte, Int, Int,
                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&, const IceInternal::OutgoingAsyncPtr&, 
                   IceInternal::BasicStream&);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    void dispatchDatagrams(IceInternal::BasicStream&, const std::vector<DatagramRequest>&);
+#endif
     void finish();
 
 private:
@@ -223,18 +258,21 @@ private:
     struct OutgoingMessage
     {
         OutgoingMessage(IceInternal::BasicStream* str, bool comp) :
-            stream(str), out(0), compress(comp), requestId(0), adopted(false), isSent(false)
+            stream(str), out(0), compress(comp), codec(0), requestId(0), adopted(false), isSent(false), size(0),
+            oneway(false), tail(0)
         {
         }
 
         OutgoingMessage(IceInternal::OutgoingMessageCallback* o, IceInternal::BasicStream* str, bool comp, int rid) :
-            stream(str), out(o), compress(comp), requestId(rid), adopted(false), isSent(false)
+            stream(str), out(o), compress(comp), codec(0), requestId(rid), adopted(false), isSent(false), size(0),
+            oneway(false), tail(0)
         {
         }
 
         OutgoingMessage(const IceInternal::OutgoingAsyncMessageCallbackPtr& o, IceInternal::BasicStream* str,
                         bool comp, int rid) :
-            stream(str), out(0), outAsync(o), compress(comp), requestId(rid), adopted(false), isSent(false)
+            stream(str), out(0), outAsync(o), compress(comp), codec(0), requestId(rid), adopted(false), isSent(false),
+            size(0), oneway(false), tail(0)
         {
         }
 
@@ -249,9 +287,20 @@ private:
         IceInternal::OutgoingAsyncPtr replyOutAsync;
 #endif
         bool compress;
+        const IceInternal::CompressionCodec* codec; // The codec for responses, 0 for the connection codec.
         int requestId;
         bool adopted;
         bool isSent;
+        size_t size; // The size of the message in the send queue.
+        bool oneway; // True for oneway requests, they can be dropped from a full send queue.
+        IceInternal::Buffer* tail; // The encoded bytes written after the stream, see OutgoingAsync::__getTail().
+    };
+
+    enum SendQueuePolicy
+    {
+        SendQueuePolicyBlock,
+        SendQueuePolicyFail,
+        SendQueuePolicyDropOldest
     };
 
     ConnectionI(const Ice::CommunicatorPtr&, const IceInternal::InstancePtr&, const IceInternal::ConnectionReaperPtr&,
@@ -270,11 +319,26 @@ private:
     bool initialize(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     void sendNextMessage(std::vector<SentCallback>&);
-    IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
+    IceInternal::AsyncStatus sendMessage(OutgoingMessage&, bool = false);
+    void prepareMessage(OutgoingMessage&);
+    bool messageWritten() const;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    bool writeMessages();
+    void flushCoalescedMessages();
+#endif
 
-#ifndef ICE_OS_WINRT
-    void doCompress(IceInternal::BasicStream&, IceInternal::BasicStream&);
-    void doUncompress(IceInternal::BasicStream&, IceInternal::BasicStream&);
+    void checkSendQueue(size_t, bool);
+    bool sendQueueFull(size_t) const;
+    bool dropOldestOneway();
+    void messageQueued(size_t);
+    void messageDequeued(size_t);
+
+    bool compressMessage(OutgoingMessage&, IceInternal::BasicStream&);
+    bool doCompress(IceInternal::BasicStream&, IceInternal::BasicStream&, const IceInternal::CompressionCodec*);
+    void doUncompress(IceInternal::BasicStream&, IceInternal::BasicStream&, const IceInternal::CompressionCodec*);
+    void parseHeader();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    void parseDatagrams(IceInternal::BasicStream&, std::vector<DatagramRequest>&);
 #endif
     void parseMessage(IceInternal::BasicStream&, Int&, Int&, Byte&,
                       IceInternal::ServantManagerPtr&, ObjectAdapterPtr&, IceInternal::OutgoingAsyncPtr&);
@@ -363,14 +427,15 @@ private:
     IceUtil::Time _acmAbsoluteTimeout;
 
     const int _compressionLevel;
+    const size_t _compressionMinSize;
+    const int _compressionMaxRatio;
+    const IceInternal::CompressionCodec* _compressionCodec;
+    const IceInternal::CompressionCodec* _negotiatedCodec;
 
     Int _nextRequestId;
 
-    std::map<Int, IceInternal::Outgoing*> _requests;
-    std::map<Int, IceInternal::Outgoing*>::iterator _requestsHint;
-
-    std::map<Int, IceInternal::OutgoingAsyncPtr> _asyncRequests;
-    std::map<Int, IceInternal::OutgoingAsyncPtr>::iterator _asyncRequestsHint;
+    IceInternal::RequestTable<IceInternal::Outgoing*> _requests;
+    IceInternal::RequestTable<IceInternal::OutgoingAsyncPtr> _asyncRequests;
 
     IceUtil::UniquePtr<LocalException> _exception;
 
@@ -383,9 +448,25 @@ private:
 
     std::deque<OutgoingMessage> _sendStreams;
 
+    const size_t _sendQueueMaxSize; // 0 if the size of the send queue isn't limited.
+    const size_t _sendQueueMaxMessages; // 0 if the number of queued messages isn't limited.
+    const SendQueuePolicy _sendQueuePolicy;
+    size_t _sendQueueSize; // The number of bytes in _sendStreams.
+    bool _sendQueueFull; // True once the limits are reached, until the queue drains below half of the limits.
+    ConnectionWritableCallbackPtr _writableCallback;
+
     IceInternal::BasicStream _readStream;
     bool _readHeader;
     IceInternal::BasicStream _writeStream;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
+    std::vector<IceInternal::Buffer*> _writeBuffers;
+
+    const IceUtil::Time _coalesceWindow;
+    const size_t _coalesceMaxSize;
+    const IceUtil::TimerTaskPtr _coalesceTimeout;
+    bool _coalescing; // True while the queued messages wait for the end of the coalescing window.
+    size_t _coalescedSize;
+#endif
 
     Observer _observer;
 
@@ -12,13 +12,89 @@
 #include <Ice/LocalException.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/Instance.h>
+#include <Ice/Metrics.h>
 
 using namespace std;
 using namespace Ice;
+using namespace IceMX;
 using namespace IceInternal;
 
 IceUtil::Shared* IceInternal::upCast(ConnectionMonitor* p) { return p; }
 
+namespace
+{
+
+//
+// The monitor metrics are computed when they are retrieved, the maps
+// don't need to be updated.
+//
+class ConnectionMonitorUpdater : public Updater
+{
+public:
+
+    virtual void
+    update()
+    {
+    }
+};
+ConnectionMonitorUpdater connectionMonitorUpdater;
+
+class ConnectionMonitorMetricsMapI : public MetricsMapI
+{
+public:
+
+    ConnectionMonitorMetricsMapI(const string& mapPrefix, const PropertiesPtr& properties,
+                                 const ConnectionMonitorPtr& monitor) :
+        MetricsMapI(mapPrefix, properties), _monitor(monitor)
+    {
+    }
+
+    ConnectionMonitorMetricsMapI(const ConnectionMonitorMetricsMapI& map) : MetricsMapI(map), _monitor(map._monitor)
+    {
+    }
+
+    virtual void
+    destroy()
+    {
+    }
+
+    virtual MetricsFailuresSeq
+    getFailures()
+    {
+        return MetricsFailuresSeq();
+    }
+
+    virtual MetricsFailures
+    getFailures(const string& id)
+    {
+        MetricsFailures failures;
+        failures.id = id;
+        return failures;
+    }
+
+    //
+    // The map has a single entry, the GroupBy, Accept and Reject
+    // properties don't apply.
+    //
+    virtual MetricsMap
+    getMetrics() const
+    {
+        return _monitor->getMetrics();
+    }
+
+    virtual MetricsMapI*
+    clone() const
+    {
+        return new ConnectionMonitorMetricsMapI(*this);
+    }
+
+private:
+
+    const ConnectionMonitorPtr _monitor;
+};
+
+}
+
 void
 IceInternal::ConnectionMonitor::checkIntervalForACM(int acmTimeout)
 {
@@ -70,6 +146,7 @@ IceInternal::ConnectionMonitor::destroy()
     assert(_instance);
     _instance = 0;
     _connections.clear();
+    _buckets.clear();
 }
 
 void
@@ -77,7 +154,16 @@ IceInternal::ConnectionMonitor::add(const ConnectionIPtr& connection)
 {
     IceUtil::Mutex::Lock sync(*this);
     assert(_instance);
-    _connections.insert(connection);
+
+    //
+    // The connection is checked on the next run of the monitor, which
+    // moves it to the bucket of its ACM deadline.
+    //
+    Long second = IceUtil::Time::now(IceUtil::Time::Monotonic).toSeconds() + 1;
+    if(_connections.insert(make_pair(connection, second)).second)
+    {
+        _buckets[second].insert(connection);
+    }
 }
 
 void
@@ -85,13 +171,49 @@ IceInternal::ConnectionMonitor::remove(const ConnectionIPtr& connection)
 {
     IceUtil::Mutex::Lock sync(*this);
     assert(_instance);
-    _connections.erase(connection);
+    map<ConnectionIPtr, Long>::iterator p = _connections.find(connection);
+    if(p == _connections.end())
+    {
+        return;
+    }
+
+    if(p->second >= 0)
+    {
+        map<Long, set<ConnectionIPtr> >::iterator q = _buckets.find(p->second);
+        assert(q != _buckets.end());
+        q->second.erase(connection);
+        if(q->second.empty())
+        {
+            _buckets.erase(q);
+        }
+    }
+    _connections.erase(p);
+}
+
+MetricsMap
+IceInternal::ConnectionMonitor::getMetrics() const
+{
+    ConnectionMonitorMetricsPtr m = new ConnectionMonitorMetrics();
+    m->id = "ConnectionMonitor";
+
+    IceUtil::Mutex::Lock sync(*this);
+    m->total = _runs;
+    m->current = static_cast<Int>(_connections.size());
+    m->checks = _checks;
+    m->runTime = _runTime.toMicroSeconds();
+    m->maxRunTime = _maxRunTime.toMicroSeconds();
+
+    MetricsMap metrics;
+    metrics.push_back(m);
+    return metrics;
 }
 
 IceInternal::ConnectionMonitor::ConnectionMonitor(const InstancePtr& instance, int interval) :
     _instance(instance),
     _interval(interval),
-    _scheduledInterval(0)
+    _scheduledInterval(0),
+    _runs(0),
+    _checks(0)
 {
 }
 
@@ -104,7 +226,8 @@ IceInternal::ConnectionMonitor::~ConnectionMonitor()
 void
 IceInternal::ConnectionMonitor::runTimerTask()
 {
-    set<ConnectionIPtr> connections;
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<pair<ConnectionIPtr, IceUtil::Time> > connections;
     
     {
         IceUtil::Mutex::Lock sync(*this);
@@ -113,20 +236,33 @@ IceInternal::ConnectionMonitor::runTimerTask()
             return;
         }
 
-        connections = _connections;
+        //
+        // Take the connections of the buckets which are due. They stay
+        // registered while they are checked, so that they can still be
+        // removed.
+        //
+        Long second = now.toSeconds();
+        while(!_buckets.empty() && _buckets.begin()->first <= second)
+        {
+            const set<ConnectionIPtr>& bucket = _buckets.begin()->second;
+            for(set<ConnectionIPtr>::const_iterator p = bucket.begin(); p != bucket.end(); ++p)
+            {
+                connections.push_back(make_pair(*p, IceUtil::Time()));
+                _connections[*p] = -1;
+            }
+            _buckets.erase(_buckets.begin());
+        }
     }
 
-        
     //
     // Monitor connections outside the thread synchronization, so
     // that connections can be added or removed during monitoring.
     //
-    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
-    for(set<ConnectionIPtr>::const_iterator p = connections.begin(); p != connections.end(); ++p)
+    for(vector<pair<ConnectionIPtr, IceUtil::Time> >::iterator p = connections.begin(); p != connections.end(); ++p)
     {
         try
         {          
-            (*p)->monitor(now);
+            p->second = p->first->monitor(now);
         }
         catch(const exception& ex)
         {   
@@ -138,6 +274,7 @@ IceInternal::ConnectionMonitor::runTimerTask()
 
             Error out(_instance->initializationData().logger);
             out << "exception in connection monitor:\n" << ex.what();
+            p->second = now;
         }
         catch(...)
         {
@@ -149,6 +286,68 @@ IceInternal::ConnectionMonitor::runTimerTask()
 
             Error out(_instance->initializationData().logger);
             out << "unknown exception in connection monitor";
+            p->second = now;
         }
     }
+
+    IceUtil::Mutex::Lock sync(*this);
+    if(!_instance)
+    {
+        return;
+    }
+
+    for(vector<pair<ConnectionIPtr, IceUtil::Time> >::const_iterator p = connections.begin(); p != connections.end();
+        ++p)
+    {
+        schedule(p->first, p->second);
+    }
+
+    IceUtil::Time duration = IceUtil::Time::now(IceUtil::Time::Monotonic) - now;
+    ++_runs;
+    _checks += static_cast<Long>(connections.size());
+    _runTime += duration;
+    if(duration > _maxRunTime)
+    {
+        _maxRunTime = duration;
+    }
+}
+
+void
+IceInternal::ConnectionMonitor::schedule(const ConnectionIPtr& connection, const IceUtil::Time& next)
+{
+    //
+    // The connection might have been removed while it was checked, or
+    // removed and added again, in which case it's already in a bucket.
+    //
+    map<ConnectionIPtr, Long>::iterator p = _connections.find(connection);
+    if(p == _connections.end() || p->second >= 0)
+    {
+        return;
+    }
+
+    if(next == IceUtil::Time())
+    {
+        _connections.erase(p);
+        return;
+    }
+
+    //
+    // The bucket of the second following the given time is due once
+    // the time has passed.
+    //
+    p->second = next.toSeconds() + 1;
+    _buckets[p->second].insert(connection);
+}
+
+IceInternal::ConnectionMonitorMetricsMapFactory::ConnectionMonitorMetricsMapFactory(
+    const ConnectionMonitorPtr& monitor) :
+    MetricsMapFactory(&connectionMonitorUpdater),
+    _monitor(monitor)
+{
+}
+
+MetricsMapIPtr
+IceInternal::ConnectionMonitorMetricsMapFactory::create(const string& mapPrefix, const PropertiesPtr& properties)
+{
+    return new ConnectionMonitorMetricsMapI(mapPrefix, properties, _monitor);
 }
@@ -16,11 +16,21 @@
 #include <Ice/ConnectionMonitorF.h>
 #include <Ice/ConnectionIF.h>
 #include <Ice/InstanceF.h>
+#include <Ice/MetricsAdminI.h>
+#include <map>
 #include <set>
 
 namespace IceInternal
 {
 
+//
+// The connection monitor closes the connections which are idle for
+// longer than their ACM timeout. Connections are kept in buckets by
+// the second at which they must be checked next, so that a run of the
+// monitor only checks the connections of the buckets which are due
+// instead of all the connections. A connection which was active since
+// it was last checked is moved to the bucket of its new ACM deadline.
+//
 class ConnectionMonitor : public IceUtil::TimerTask, public ::IceUtil::Mutex
 {
 public:
@@ -32,6 +42,8 @@ public:
     void add(const Ice::ConnectionIPtr&);
     void remove(const Ice::ConnectionIPtr&);
 
+    IceMX::MetricsMap getMetrics() const;
+
 private:
 
     ConnectionMonitor(const InstancePtr&, Ice::Int);
@@ -40,10 +52,39 @@ private:
 
     virtual void runTimerTask();
 
+    void schedule(const Ice::ConnectionIPtr&, const IceUtil::Time&);
+
     InstancePtr _instance;
     const int _interval;
     int _scheduledInterval;
-    std::set<Ice::ConnectionIPtr> _connections;
+
+    //
+    // The bucket of each connection, or -1 if the connection is being
+    // checked, and the buckets keyed by second.
+    //
+    std::map<Ice::ConnectionIPtr, Ice::Long> _connections;
+    std::map<Ice::Long, std::set<Ice::ConnectionIPtr> > _buckets;
+
+    Ice::Long _runs;
+    Ice::Long _checks;
+    IceUtil::Time _runTime;
+    IceUtil::Time _maxRunTime;
+};
+
+//
+// Factory for the ConnectionMonitor map of the metrics admin facet.
+//
+class ConnectionMonitorMetricsMapFactory : public MetricsMapFactory
+{
+public:
+
+    ConnectionMonitorMetricsMapFactory(const ConnectionMonitorPtr&);
+
+    virtual MetricsMapIPtr create(const std::string&, const Ice::PropertiesPtr&);
+
+private:
+
+    const ConnectionMonitorPtr _monitor;
 };
 
 }
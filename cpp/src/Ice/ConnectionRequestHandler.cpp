@@ -59,7 +59,7 @@ ConnectionRequestHandler::abortBatchRequest()
 Ice::ConnectionI*
 ConnectionRequestHandler::sendRequest(Outgoing* out)
 {
-    if(!_connection->sendRequest(out, _compress, _response) || _response)
+    if(!_connection->sendRequest(out, _compress, _response, _coalesce) || _response)
     {
         return _connection.get(); // The request hasn't been sent or we're expecting a response.
     }
@@ -72,7 +72,7 @@ ConnectionRequestHandler::sendRequest(Outgoing* out)
 AsyncStatus
 ConnectionRequestHandler::sendAsyncRequest(const OutgoingAsyncPtr& out)
 {
-    return _connection->sendAsyncRequest(out, _compress, _response);
+    return _connection->sendAsyncRequest(out, _compress, _response, _coalesce);
 }
 
 bool
@@ -14,6 +14,8 @@
 #include <Ice/LoggerUtil.h>
 #include <IceUtil/MutexPtrLock.h>
 
+#include <sstream>
+
 using namespace std;
 using namespace Ice::Instrumentation;
 using namespace IceInternal;
@@ -88,26 +90,51 @@ IceInternal::EndpointI::EndpointI() :
 #ifndef ICE_OS_WINRT
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
-    IceUtil::Thread("Ice.HostResolver"),
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
+    _cache(new HostCache(
+               IceUtil::Time::seconds(
+                   instance->initializationData().properties->getPropertyAsInt("Ice.HostResolver.CacheTTL")),
+               IceUtil::Time::seconds(
+                   instance->initializationData().properties->getPropertyAsInt("Ice.HostResolver.NegativeCacheTTL")))),
     _destroyed(false)
 {
     __setNoDelete(true);
     try
     {
-        updateObserver();
-        bool hasPriority = _instance->initializationData().properties->getProperty("Ice.ThreadPriority") != "";
-        int priority = _instance->initializationData().properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
+        const Ice::PropertiesPtr& properties = _instance->initializationData().properties;
+        int size = properties->getPropertyAsIntWithDefault("Ice.HostResolver.Size", 1);
+        if(size < 1)
         {
-            start(0, priority);
+            Ice::Warning out(_instance->initializationData().logger);
+            out << "Ice.HostResolver.Size < 1; Size adjusted to 1";
+            size = 1;
         }
-        else
+
+        bool hasPriority = properties->getProperty("Ice.ThreadPriority") != "";
+        int priority = properties->getPropertyAsInt("Ice.ThreadPriority");
+        for(int i = 0; i < size; ++i)
         {
-            start();
+            ostringstream name;
+            name << "Ice.HostResolver";
+            if(size > 1)
+            {
+                name << '-' << i;
+            }
+
+            HelperThreadPtr thread = new HelperThread(this, name.str());
+            if(hasPriority)
+            {
+                thread->start(0, priority);
+            }
+            else
+            {
+                thread->start();
+            }
+            _threads.push_back(thread);
         }
+        updateObserver();
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -115,6 +142,12 @@ IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& insta
             Ice::Error out(_instance->initializationData().logger);
             out << "cannot create thread for enpoint host resolver:\n" << ex;
         }
+        {
+            Lock sync(*this);
+            _destroyed = true;
+            notifyAll();
+        }
+        joinWithAllThreads();
         throw;
     }
     __setNoDelete(false);
@@ -126,7 +159,8 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
 {
     //
     // Try to get the addresses without DNS lookup. If this doesn't
-    // work, we retry with DNS lookup (and observer).
+    // work, we look up the cache and then retry with DNS lookup (and
+    // observer).
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
@@ -138,6 +172,17 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
+    vector<Address> addrs;
+    if(_cache->get(host, port, _protocol, addrs))
+    {
+        if(networkProxy)
+        {
+            networkProxy = networkProxy->resolveHost();
+        }
+        sortAddresses(addrs, _protocol, selType, _preferIPv6);
+        return endpoint->connectors(addrs, networkProxy);
+    }
+
     ObserverHelperT<> observer;
     const CommunicatorObserverPtr& obsv = _instance->getObserver();
     if(obsv)
@@ -153,8 +198,23 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
             networkProxy = networkProxy->resolveHost();
         }
 
-        connectors = endpoint->connectors(getAddresses(host, port, _protocol, selType, _preferIPv6, true),
-                                          networkProxy);
+        _cache->lookupStarted();
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        try
+        {
+            addrs = getAddresses(host, port, _protocol, Ice::Ordered, _preferIPv6, true);
+        }
+        catch(const Ice::DNSException& ex)
+        {
+            _cache->lookupFinished(IceUtil::Time::now(IceUtil::Time::Monotonic) - start);
+            _cache->putFailure(host, port, _protocol, ex.error);
+            throw;
+        }
+        _cache->lookupFinished(IceUtil::Time::now(IceUtil::Time::Monotonic) - start);
+        _cache->put(host, port, _protocol, addrs);
+
+        sortAddresses(addrs, _protocol, selType, _preferIPv6);
+        connectors = endpoint->connectors(addrs, networkProxy);
     }
     catch(const Ice::LocalException& ex)
     {
@@ -169,8 +229,9 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
                                            const EndpointIPtr& endpoint, const EndpointI_connectorsPtr& callback)
 {
     //
-    // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // Try to get the addresses without DNS lookup or from the cache. If
+    // this doesn't work, we queue a resolve entry and a resolver thread
+    // will take care of getting the endpoint addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
@@ -191,9 +252,6 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
-    Lock sync(*this);
-    assert(!_destroyed);
-
     ResolveEntry entry;
     entry.host = host;
     entry.port = port;
@@ -201,18 +259,57 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
     entry.endpoint = endpoint;
     entry.callback = callback;
 
-    const CommunicatorObserverPtr& obsv = _instance->getObserver();
-    if(obsv)
     {
-        entry.observer = obsv->getEndpointLookupObserver(endpoint);
-        if(entry.observer)
+        Lock sync(*this);
+        assert(!_destroyed);
+
+        vector<Address> addrs;
+        bool cached;
+        try
         {
-            entry.observer->attach();
+            cached = _cache->get(host, port, _protocol, addrs);
+        }
+        catch(const Ice::DNSException& ex)
+        {
+            sync.release();
+            callback->exception(ex);
+            return;
         }
-    }
 
-    _queue.push_back(entry);
-    notify();
+        if(!cached)
+        {
+            const CommunicatorObserverPtr& obsv = _instance->getObserver();
+            if(obsv)
+            {
+                entry.observer = obsv->getEndpointLookupObserver(endpoint);
+                if(entry.observer)
+                {
+                    entry.observer->attach();
+                }
+            }
+
+            //
+            // If a lookup for this host is already pending, the entry is
+            // completed with its result.
+            //
+            pair<map<pair<string, int>, vector<ResolveEntry> >::iterator, bool> p =
+                _pending.insert(make_pair(make_pair(host, port), vector<ResolveEntry>()));
+            if(p.second)
+            {
+                _cache->lookupStarted();
+                _queue.push_back(entry);
+                notify();
+            }
+            else
+            {
+                p.first->second.push_back(entry);
+            }
+            return;
+        }
+
+        sync.release();
+        finished(entry, addrs, false, 0);
+    }
 }
 
 void
@@ -221,11 +318,57 @@ IceInternal::EndpointHostResolver::destroy()
     Lock sync(*this);
     assert(!_destroyed);
     _destroyed = true;
-    notify();
+    notifyAll();
+}
+
+void
+IceInternal::EndpointHostResolver::joinWithAllThreads()
+{
+    //
+    // _threads is immutable once the resolver is destroyed.
+    //
+    for(vector<HelperThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+    _threads.clear();
+
+    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
+    {
+        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
+        vector<ResolveEntry> entries = _pending[make_pair(p->host, p->port)];
+        entries.push_back(*p);
+        for(vector<ResolveEntry>::const_iterator q = entries.begin(); q != entries.end(); ++q)
+        {
+            if(q->observer)
+            {
+                q->observer->failed(ex.ice_name());
+                q->observer->detach();
+            }
+            q->callback->exception(ex);
+        }
+    }
+    _queue.clear();
+    _pending.clear();
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::updateObserver()
+{
+    Lock sync(*this);
+    const CommunicatorObserverPtr& obsv = _instance->getObserver();
+    if(obsv)
+    {
+        for(vector<HelperThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+        {
+            (*p)->_observer.attach(obsv->getThreadObserver("Communicator", (*p)->name(), ThreadStateIdle,
+                                                           (*p)->_observer.get()));
+        }
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::run(HelperThread* thread)
 {
     while(true)
     {
@@ -245,79 +388,116 @@ IceInternal::EndpointHostResolver::run()
 
             r = _queue.front();
             _queue.pop_front();
-            threadObserver = _observer.get();
+            threadObserver = thread->_observer.get();
         }
 
-        try
+        if(threadObserver)
         {
-            if(threadObserver)
-            {
-                threadObserver->stateChanged(ThreadStateIdle, ThreadStateInUseForOther);
-            }
-
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
-            if(networkProxy)
-            {
-                networkProxy = networkProxy->resolveHost();
-            }
-
-            r.callback->connectors(r.endpoint->connectors(getAddresses(r.host, 
-                                                                       r.port, 
-                                                                       _protocol,
-                                                                       r.selType, 
-                                                                       _preferIPv6, true),
-                                                          networkProxy));
+            threadObserver->stateChanged(ThreadStateIdle, ThreadStateInUseForOther);
+        }
 
-            if(threadObserver)
-            {
-                threadObserver->stateChanged(ThreadStateInUseForOther, ThreadStateIdle);
-            }
+        //
+        // The addresses are cached in the default order, each request
+        // sorts them according to its endpoint selection type.
+        //
+        vector<Address> addrs;
+        bool failed = false;
+        int error = 0;
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        try
+        {
+            addrs = getAddresses(r.host, r.port, _protocol, Ice::Ordered, _preferIPv6, true);
+            _cache->put(r.host, r.port, _protocol, addrs);
+        }
+        catch(const Ice::DNSException& ex)
+        {
+            failed = true;
+            error = ex.error;
+            _cache->putFailure(r.host, r.port, _protocol, error);
+        }
+        _cache->lookupFinished(IceUtil::Time::now(IceUtil::Time::Monotonic) - start);
 
-            if(r.observer)
-            {
-                r.observer->detach();
-            }
+        vector<ResolveEntry> entries;
+        {
+            Lock sync(*this);
+            map<pair<string, int>, vector<ResolveEntry> >::iterator p = _pending.find(make_pair(r.host, r.port));
+            assert(p != _pending.end());
+            entries.swap(p->second);
+            _pending.erase(p);
         }
-        catch(const Ice::LocalException& ex)
+
+        finished(r, addrs, failed, error);
+        for(vector<ResolveEntry>::const_iterator q = entries.begin(); q != entries.end(); ++q)
         {
-            if(r.observer)
-            {
-                r.observer->failed(ex.ice_name());
-                r.observer->detach();
-            }
-            r.callback->exception(ex);
+            finished(*q, addrs, failed, error);
         }
-    }
 
-    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
-    {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if(p->observer)
+        if(threadObserver)
         {
-            p->observer->failed(ex.ice_name());
-            p->observer->detach();
+            threadObserver->stateChanged(ThreadStateInUseForOther, ThreadStateIdle);
         }
-        p->callback->exception(ex);
     }
-    _queue.clear();
 
-    if(_observer)
+    Lock sync(*this);
+    if(thread->_observer)
     {
-        _observer.detach();
+        thread->_observer.detach();
     }
 }
 
 void
-IceInternal::EndpointHostResolver::updateObserver()
+IceInternal::EndpointHostResolver::finished(const ResolveEntry& r, const vector<Address>& addrs, bool failed,
+                                            int error)
 {
-    Lock sync(*this);
-    const CommunicatorObserverPtr& obsv = _instance->getObserver();
-    if(obsv)
+    try
+    {
+        if(failed)
+        {
+            Ice::DNSException ex(__FILE__, __LINE__);
+            ex.error = error;
+            ex.host = r.host;
+            throw ex;
+        }
+
+        NetworkProxyPtr networkProxy = _instance->networkProxy();
+        if(networkProxy)
+        {
+            networkProxy = networkProxy->resolveHost();
+        }
+
+        vector<Address> sorted = addrs;
+        sortAddresses(sorted, _protocol, r.selType, _preferIPv6);
+        r.callback->connectors(r.endpoint->connectors(sorted, networkProxy));
+
+        if(r.observer)
+        {
+            r.observer->detach();
+        }
+    }
+    catch(const Ice::LocalException& ex)
     {
-        _observer.attach(obsv->getThreadObserver("Communicator", name(), ThreadStateIdle, _observer.get()));
+        if(r.observer)
+        {
+            r.observer->failed(ex.ice_name());
+            r.observer->detach();
+        }
+        r.callback->exception(ex);
     }
 }
 
+IceInternal::EndpointHostResolver::HelperThread::HelperThread(const EndpointHostResolverPtr& resolver,
+                                                              const string& name) :
+    IceUtil::Thread(name),
+    _resolver(resolver)
+{
+}
+
+void
+IceInternal::EndpointHostResolver::HelperThread::run()
+{
+    _resolver->run(this);
+}
+
 #else
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
@@ -352,7 +532,7 @@ IceInternal::EndpointHostResolver::destroy()
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::joinWithAllThreads()
 {
 }
 
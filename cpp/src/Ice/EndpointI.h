@@ -26,6 +26,7 @@
 #include <Ice/ObserverHelper.h>
 
 #ifndef ICE_OS_WINRT
+#   include <Ice/HostCache.h>
 #   include <deque>
 #endif
 
@@ -182,8 +183,14 @@ inline bool operator<(const EndpointI& l, const EndpointI& r)
     return static_cast<const ::Ice::LocalObject&>(l) < static_cast<const ::Ice::LocalObject&>(r);
 }
 
+//
+// Resolves the host names of endpoints with a pool of
+// Ice.HostResolver.Size threads (1 by default). Concurrent requests
+// for the same host share a single lookup and the results are cached
+// by the resolver host cache (see HostCache.h).
+//
 #ifndef ICE_OS_WINRT
-class ICE_API EndpointHostResolver : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+class ICE_API EndpointHostResolver : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 #else
 class ICE_API EndpointHostResolver : public IceUtil::Shared
 #endif
@@ -196,10 +203,17 @@ public:
     void resolve(const std::string&, int, Ice::EndpointSelectionType, const EndpointIPtr&, 
                  const EndpointI_connectorsPtr&);
     void destroy();
+    void joinWithAllThreads();
 
-    virtual void run();
     void updateObserver();
 
+#ifndef ICE_OS_WINRT
+    const HostCachePtr& cache() const
+    {
+        return _cache;
+    }
+#endif
+
 private:
 
 #ifndef ICE_OS_WINRT
@@ -213,12 +227,35 @@ private:
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    class HelperThread : public IceUtil::Thread
+    {
+    public:
+
+        HelperThread(const EndpointHostResolverPtr&, const std::string&);
+
+        virtual void run();
+
+    private:
+
+        friend class EndpointHostResolver;
+
+        const EndpointHostResolverPtr _resolver;
+        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    };
+    typedef IceUtil::Handle<HelperThread> HelperThreadPtr;
+    friend class HelperThread;
+
+    void run(HelperThread*);
+    void finished(const ResolveEntry&, const std::vector<Address>&, bool, int);
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const HostCachePtr _cache;
     bool _destroyed;
     std::deque<ResolveEntry> _queue;
-    ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    std::map<std::pair<std::string, int>, std::vector<ResolveEntry> > _pending;
+    std::vector<HelperThreadPtr> _threads;
 #else
     const InstancePtr _instance;
 #endif
@@ -795,3 +795,10 @@ Ice::ResponseSentException::ice_print(ostream& out) const
     Exception::ice_print(out);
     out << ":\nresponse sent exception";
 }
+
+void
+Ice::SendQueueFullException::ice_print(ostream& out) const
+{
+    Exception::ice_print(out);
+    out << ":\nsend queue of the connection is full";
+}
@@ -0,0 +1,276 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/HostCache.h>
+#include <Ice/LocalException.h>
+#include <Ice/Metrics.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceMX;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Expired entries are removed when the cache grows beyond this size,
+// and then beyond twice the number of entries left.
+//
+const size_t minPruneSize = 256;
+
+//
+// The resolver metrics are computed when they are retrieved, the maps
+// don't need to be updated.
+//
+class HostResolverUpdater : public Updater
+{
+public:
+
+    virtual void
+    update()
+    {
+    }
+};
+HostResolverUpdater hostResolverUpdater;
+
+class HostResolverMetricsMapI : public MetricsMapI
+{
+public:
+
+    HostResolverMetricsMapI(const string& mapPrefix, const PropertiesPtr& properties, const HostCachePtr& cache) :
+        MetricsMapI(mapPrefix, properties), _cache(cache)
+    {
+    }
+
+    HostResolverMetricsMapI(const HostResolverMetricsMapI& map) : MetricsMapI(map), _cache(map._cache)
+    {
+    }
+
+    virtual void
+    destroy()
+    {
+    }
+
+    virtual MetricsFailuresSeq
+    getFailures()
+    {
+        return MetricsFailuresSeq();
+    }
+
+    virtual MetricsFailures
+    getFailures(const string& id)
+    {
+        MetricsFailures failures;
+        failures.id = id;
+        return failures;
+    }
+
+    //
+    // The map has a single entry, the GroupBy, Accept and Reject
+    // properties don't apply.
+    //
+    virtual MetricsMap
+    getMetrics() const
+    {
+        return _cache->getMetrics();
+    }
+
+    virtual MetricsMapI*
+    clone() const
+    {
+        return new HostResolverMetricsMapI(*this);
+    }
+
+private:
+
+    const HostCachePtr _cache;
+};
+
+}
+
+bool
+IceInternal::HostCache::Key::operator<(const Key& other) const
+{
+    if(port != other.port)
+    {
+        return port < other.port;
+    }
+    if(protocol != other.protocol)
+    {
+        return protocol < other.protocol;
+    }
+    return host < other.host;
+}
+
+IceInternal::HostCache::HostCache(const IceUtil::Time& ttl, const IceUtil::Time& negativeTTL) :
+    _ttl(ttl),
+    _negativeTTL(negativeTTL),
+    _pruneSize(minPruneSize),
+    _hits(0),
+    _misses(0),
+    _lookups(0),
+    _pending(0)
+{
+}
+
+bool
+IceInternal::HostCache::get(const string& host, int port, ProtocolSupport protocol, vector<Address>& addrs)
+{
+    Key key;
+    key.host = host;
+    key.port = port;
+    key.protocol = protocol;
+
+    Lock sync(*this);
+    map<Key, Entry>::iterator p = _entries.find(key);
+    if(p != _entries.end() && p->second.expires <= IceUtil::Time::now(IceUtil::Time::Monotonic))
+    {
+        _entries.erase(p);
+        p = _entries.end();
+    }
+
+    if(p == _entries.end())
+    {
+        ++_misses;
+        return false;
+    }
+
+    ++_hits;
+    if(p->second.failed)
+    {
+        DNSException ex(__FILE__, __LINE__);
+        ex.error = p->second.error;
+        ex.host = host;
+        throw ex;
+    }
+    addrs = p->second.addrs;
+    return true;
+}
+
+void
+IceInternal::HostCache::put(const string& host, int port, ProtocolSupport protocol, const vector<Address>& addrs)
+{
+    if(_ttl <= IceUtil::Time())
+    {
+        return;
+    }
+
+    Key key;
+    key.host = host;
+    key.port = port;
+    key.protocol = protocol;
+
+    Entry entry;
+    entry.addrs = addrs;
+    entry.failed = false;
+    entry.error = 0;
+
+    Lock sync(*this);
+    add(key, entry, _ttl);
+}
+
+void
+IceInternal::HostCache::putFailure(const string& host, int port, ProtocolSupport protocol, int error)
+{
+    if(_negativeTTL <= IceUtil::Time())
+    {
+        return;
+    }
+
+    Key key;
+    key.host = host;
+    key.port = port;
+    key.protocol = protocol;
+
+    Entry entry;
+    entry.failed = true;
+    entry.error = error;
+
+    Lock sync(*this);
+    add(key, entry, _negativeTTL);
+}
+
+void
+IceInternal::HostCache::lookupStarted()
+{
+    Lock sync(*this);
+    ++_pending;
+}
+
+void
+IceInternal::HostCache::lookupFinished(const IceUtil::Time& duration)
+{
+    Lock sync(*this);
+    --_pending;
+    ++_lookups;
+    _lookupTime += duration;
+    if(duration > _maxLookupTime)
+    {
+        _maxLookupTime = duration;
+    }
+}
+
+MetricsMap
+IceInternal::HostCache::getMetrics() const
+{
+    HostResolverMetricsPtr m = new HostResolverMetrics();
+    m->id = "HostResolver";
+
+    Lock sync(*this);
+    m->hits = _hits;
+    m->misses = _misses;
+    m->total = _hits + _misses;
+    m->current = _pending;
+    m->lookups = _lookups;
+    m->lookupTime = _lookupTime.toMicroSeconds();
+    m->maxLookupTime = _maxLookupTime.toMicroSeconds();
+
+    MetricsMap metrics;
+    metrics.push_back(m);
+    return metrics;
+}
+
+void
+IceInternal::HostCache::add(const Key& key, const Entry& entry, const IceUtil::Time& ttl)
+{
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    if(_entries.size() >= _pruneSize)
+    {
+        map<Key, Entry>::iterator p = _entries.begin();
+        while(p != _entries.end())
+        {
+            if(p->second.expires <= now)
+            {
+                _entries.erase(p++);
+            }
+            else
+            {
+                ++p;
+            }
+        }
+        _pruneSize = max(minPruneSize, _entries.size() * 2);
+    }
+
+    Entry& e = _entries[key];
+    e = entry;
+    e.expires = now + ttl;
+}
+
+IceInternal::HostResolverMetricsMapFactory::HostResolverMetricsMapFactory(const HostCachePtr& cache) :
+    MetricsMapFactory(&hostResolverUpdater),
+    _cache(cache)
+{
+}
+
+MetricsMapIPtr
+IceInternal::HostResolverMetricsMapFactory::create(const string& mapPrefix, const PropertiesPtr& properties)
+{
+    return new HostResolverMetricsMapI(mapPrefix, properties, _cache);
+}
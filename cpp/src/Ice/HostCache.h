@@ -0,0 +1,116 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_HOST_CACHE_H
+#define ICE_HOST_CACHE_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Handle.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/Network.h>
+#include <Ice/MetricsAdminI.h>
+
+#include <map>
+
+namespace IceInternal
+{
+
+class HostCache;
+typedef IceUtil::Handle<HostCache> HostCachePtr;
+
+//
+// The cache of the host name lookups of the endpoint host resolver,
+// keyed by host, port and protocol support. Successful lookups are
+// kept for Ice.HostResolver.CacheTTL seconds and failed lookups for
+// Ice.HostResolver.NegativeCacheTTL seconds, caching is disabled if
+// both are 0 (the default). The cache also keeps the counters of the
+// HostResolver map of the metrics admin facet.
+//
+class HostCache : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    HostCache(const IceUtil::Time&, const IceUtil::Time&);
+
+    //
+    // Get the addresses of a host. Returns false if the host isn't in
+    // the cache, throws DNSException if the cache holds a failed
+    // lookup for the host.
+    //
+    bool get(const std::string&, int, ProtocolSupport, std::vector<Address>&);
+
+    //
+    // Record the result of a lookup, the error is the DNSException
+    // error of a failed lookup.
+    //
+    void put(const std::string&, int, ProtocolSupport, const std::vector<Address>&);
+    void putFailure(const std::string&, int, ProtocolSupport, int);
+
+    //
+    // Lookup statistics for the metrics.
+    //
+    void lookupStarted();
+    void lookupFinished(const IceUtil::Time&);
+
+    IceMX::MetricsMap getMetrics() const;
+
+private:
+
+    struct Key
+    {
+        std::string host;
+        int port;
+        ProtocolSupport protocol;
+
+        bool operator<(const Key&) const;
+    };
+
+    struct Entry
+    {
+        std::vector<Address> addrs;
+        bool failed;
+        int error;
+        IceUtil::Time expires;
+    };
+
+    void add(const Key&, const Entry&, const IceUtil::Time&);
+
+    const IceUtil::Time _ttl;
+    const IceUtil::Time _negativeTTL;
+    std::map<Key, Entry> _entries;
+    size_t _pruneSize;
+
+    Ice::Long _hits;
+    Ice::Long _misses;
+    Ice::Long _lookups;
+    Ice::Int _pending;
+    IceUtil::Time _lookupTime;
+    IceUtil::Time _maxLookupTime;
+};
+
+//
+// Factory for the HostResolver map of the metrics admin facet.
+//
+class HostResolverMetricsMapFactory : public MetricsMapFactory
+{
+public:
+
+    HostResolverMetricsMapFactory(const HostCachePtr&);
+
+    virtual MetricsMapIPtr create(const std::string&, const Ice::PropertiesPtr&);
+
+private:
+
+    const HostCachePtr _cache;
+};
+
+}
+
+#endif
@@ -552,6 +552,12 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStre
 {
     _is = stream;
 
+    //
+    // The request buffer is alive until the dispatch returns, sequence
+    // views of the in-parameters can reference it.
+    //
+    _is->enableZeroCopyViews();
+
     BasicStream::Container::iterator start = _is->i;
 
     //
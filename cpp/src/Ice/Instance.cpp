@@ -39,6 +39,8 @@
 #include <Ice/Communicator.h>
 #include <Ice/GC.h>
 #include <Ice/MetricsAdminI.h>
+#include <Ice/BufferPool.h>
+#include <Ice/HostCache.h>
 #include <Ice/InstrumentationI.h>
  
 #include <IceUtil/UUID.h>
@@ -826,6 +828,7 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _state(StateActive),
     _initData(initData),
     _messageSizeMax(0),
+    _requestHeaderCacheSize(0),
     _clientACM(0),
     _serverACM(0),
     _implicitContext(0)
@@ -1038,6 +1041,19 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             }
         }
 
+        if(_initData.properties->getPropertyAsInt("Ice.BufferPool") > 0)
+        {
+            Int maxSize = _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.MaxSize", 64 * 1024);
+            Int maxBuffers = _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.MaxBuffers", 64);
+            const_cast<BufferPoolPtr&>(_bufferPool) = new BufferPool(static_cast<size_t>(max(maxSize, 0)),
+                                                                     static_cast<size_t>(max(maxBuffers, 0)));
+        }
+
+        {
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.RequestHeaderCacheSize", 16);
+            const_cast<size_t&>(_requestHeaderCacheSize) = static_cast<size_t>(max(num, 0));
+        }
+
         //
         // Client ACM enabled by default. Server ACM disabled by default.
         //
@@ -1144,6 +1160,11 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
         _metricsAdmin = new MetricsAdminI(_initData.properties, _initData.logger);
         _adminFacets.insert(FacetMap::value_type("Metrics", _metricsAdmin));
 
+        if(_bufferPool)
+        {
+            _metricsAdmin->registerMap("BufferPool", new BufferPoolMetricsMapFactory(_bufferPool));
+        }
+
         //
         // Setup the communicator observer only if the user didn't already set an
         // Ice observer resolver and if the admininistrative endpoints are set.
@@ -1244,13 +1265,26 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[])
     {
         bool hasPriority = _initData.properties->getProperty("Ice.ThreadPriority") != "";
         int priority = _initData.properties->getPropertyAsInt("Ice.ThreadPriority");
+
+        //
+        // With Ice.Timer.Tick set, the timer uses a timing wheel with
+        // the given tick (in milliseconds) instead of an ordered set.
+        //
+        int tick = _initData.properties->getPropertyAsIntWithDefault("Ice.Timer.Tick", 0);
+        if(tick < 0)
+        {
+            Warning out(_initData.logger);
+            out << "invalid value for Ice.Timer.Tick `" << tick << "': using an ordered timer";
+            tick = 0;
+        }
+
         if(hasPriority)
         {
-            _timer = new IceUtil::Timer(priority);
+            _timer = new IceUtil::Timer(IceUtil::Time::milliSeconds(tick), priority);
         }
         else
         {
-            _timer = new IceUtil::Timer;
+            _timer = new IceUtil::Timer(IceUtil::Time::milliSeconds(tick));
         }
     }
     catch(const IceUtil::Exception& ex)
@@ -1270,6 +1304,10 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[])
         out << "cannot create thread for endpoint host resolver:\n" << ex;
         throw;
     }
+
+#ifndef ICE_OS_WINRT
+    _metricsAdmin->registerMap("HostResolver", new HostResolverMetricsMapFactory(_endpointHostResolver->cache()));
+#endif
     
     _clientThreadPool = new ThreadPool(this, "Ice.ThreadPool.Client", 0);
 
@@ -1325,6 +1363,7 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[])
     _connectionMonitor = new ConnectionMonitor(this, _initData.properties->getPropertyAsInt("Ice.MonitorConnections"));
     _connectionMonitor->checkIntervalForACM(_clientACM);
     _connectionMonitor->checkIntervalForACM(_serverACM);
+    _metricsAdmin->registerMap("ConnectionMonitor", new ConnectionMonitorMetricsMapFactory(_connectionMonitor));
 
     //
     // Server thread pool initialization is lazy in serverThreadPool().
@@ -1516,7 +1555,7 @@ IceInternal::Instance::destroy()
 #ifndef ICE_OS_WINRT
     if(endpointHostResolver)
     {
-        endpointHostResolver->getThreadControl().join();
+        endpointHostResolver->joinWithAllThreads();
     }
 #endif
     
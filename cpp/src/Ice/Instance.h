@@ -28,6 +28,7 @@
 #include <Ice/ThreadPoolF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionMonitorF.h>
+#include <Ice/BufferPoolF.h>
 #include <Ice/ObjectFactoryManagerF.h>
 #include <Ice/ObjectAdapterFactoryF.h>
 #include <Ice/EndpointFactoryManagerF.h>
@@ -84,6 +85,8 @@ public:
     DynamicLibraryListPtr dynamicLibraryList() const;
     Ice::PluginManagerPtr pluginManager() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
+    const BufferPoolPtr& bufferPool() const { return _bufferPool; }
+    size_t requestHeaderCacheSize() const { return _requestHeaderCacheSize; }
     Ice::Int clientACM() const;
     Ice::Int serverACM() const;
     Ice::Identity stringToIdentity(const std::string&) const;
@@ -135,6 +138,8 @@ private:
     const TraceLevelsPtr _traceLevels; // Immutable, not reset by destroy().
     const DefaultsAndOverridesPtr _defaultsAndOverrides; // Immutable, not reset by destroy().
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
+    const BufferPoolPtr _bufferPool; // Immutable, not reset by destroy().
+    const size_t _requestHeaderCacheSize; // Immutable, not reset by destroy().
     const Ice::Int _clientACM; // Immutable, not reset by destroy().
     const Ice::Int _serverACM; // Immutable, not reset by destroy().
     RouterManagerPtr _routerManager;
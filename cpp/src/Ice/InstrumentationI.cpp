@@ -68,6 +68,21 @@ struct ThreadStateChanged
     ThreadState newState;
 };
 
+struct SentMessages
+{
+    SentMessages(Int num) : num(num)
+    {
+    }
+
+    void operator()(const ConnectionMetricsPtr& v)
+    {
+        Increment<IceUtil::Optional<Long> >()(v->writes);
+        Add<Int>(num)(v->sentMessages);
+    }
+
+    Int num;
+};
+
 class ConnectionHelper : public MetricsHelperT<ConnectionMetrics>
 {
 public:
@@ -710,6 +725,22 @@ ConnectionObserverI::receivedBytes(Int num)
     }
 }
 
+void 
+ConnectionObserverI::queuedBytes(Int num)
+{
+    forEach(add(&ConnectionMetrics::queuedBytes, num));
+    if(_delegate)
+    {
+        _delegate->queuedBytes(num);
+    }
+}
+
+void 
+ConnectionObserverI::sentMessages(Int num)
+{
+    forEach(SentMessages(num));
+}
+
 void
 ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 {
@@ -159,6 +159,15 @@ public:
 
     virtual void sentBytes(Ice::Int);
     virtual void receivedBytes(Ice::Int);
+    virtual void queuedBytes(Ice::Int);
+
+    //
+    // Not an operation of the ConnectionObserver local interface, this
+    // would break the observers implemented by applications. It's
+    // only called by the connections of the metrics observer and
+    // isn't forwarded to the delegate.
+    //
+    void sentMessages(Ice::Int);
 };
 
 class ThreadObserverI : public ObserverWithDelegateT<IceMX::ThreadMetrics, Ice::Instrumentation::ThreadObserver>
@@ -33,9 +33,48 @@ const string suffixes[] =
     "Accept.*",
     "Reject.*",
     "RetainDetached",
+    "Histogram",
     "Map.*",
 };
 
+//
+// Durations of 2^36 microseconds (about 19 hours) or more are counted
+// in the last bucket of histograms.
+//
+const int histogramMaxBits = 36;
+
+int
+parseHistogram(const PropertiesPtr& properties, const string& name)
+{
+    int precision = properties->getPropertyAsInt(name);
+    if(precision < 0 || precision > 3)
+    {
+        throw "invalid histogram precision `" + properties->getProperty(name) + "' for `" + name +
+            "', the precision must be between 0 and 3";
+    }
+    return precision;
+}
+
+int
+histogramBits(int precision)
+{
+    //
+    // The number of bits of the buckets for the given number of
+    // significant decimal digits: 2^(bits - 1) >= 10^precision.
+    //
+    int n = 1;
+    for(int i = 0; i < precision; ++i)
+    {
+        n *= 10;
+    }
+    int bits = 1;
+    while((1 << (bits - 1)) < n)
+    {
+        ++bits;
+    }
+    return bits;
+}
+
 void
 validateProperties(const string& prefix, const PropertiesPtr& properties)
 {
@@ -145,9 +184,104 @@ MetricsMapI::RegExp::match(const string& value)
 #endif
 }
 
+MetricsHistogram::MetricsHistogram(int precision) :
+    _bits(histogramBits(precision)),
+    _size((static_cast<size_t>(1) << _bits) + (histogramMaxBits - _bits) * (static_cast<size_t>(1) << (_bits - 1))),
+    _counts(new Ice::Long[_size])
+{
+    fill(_counts, _counts + _size, 0);
+}
+
+MetricsHistogram::~MetricsHistogram()
+{
+    delete[] _counts;
+}
+
+void
+MetricsHistogram::add(Ice::Long duration)
+{
+    Ice::Long* count = &_counts[index(duration)];
+#if defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+    __atomic_fetch_add(count, 1, __ATOMIC_RELAXED);
+#elif defined(_WIN64)
+    InterlockedIncrement64(count);
+#else
+    IceUtil::Mutex::Lock sync(_mutex);
+    ++*count;
+#endif
+}
+
+LatencyHistogram
+MetricsHistogram::get() const
+{
+#if !defined(ICE_HAS_GCC_ATOMIC_BUILTINS) && !defined(_WIN64)
+    IceUtil::Mutex::Lock sync(_mutex);
+#endif
+    LatencyHistogram histogram;
+    for(size_t i = 0; i < _size; ++i)
+    {
+#if defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+        Ice::Long count = __atomic_load_n(&_counts[i], __ATOMIC_RELAXED);
+#elif defined(_WIN64)
+        Ice::Long count = InterlockedCompareExchange64(&_counts[i], 0, 0);
+#else
+        Ice::Long count = _counts[i];
+#endif
+        if(count > 0)
+        {
+            histogram.insert(histogram.end(), make_pair(upperBound(i), count));
+        }
+    }
+    return histogram;
+}
+
+size_t
+MetricsHistogram::index(Ice::Long duration) const
+{
+    //
+    // Durations below 2^bits have their own bucket. Above, each power
+    // of two is divided in 2^(bits - 1) buckets.
+    //
+    const Ice::Long subBuckets = static_cast<Ice::Long>(1) << _bits;
+    if(duration < subBuckets)
+    {
+        return duration < 0 ? 0 : static_cast<size_t>(duration);
+    }
+    if(duration >> histogramMaxBits)
+    {
+        return _size - 1;
+    }
+
+#if defined(__GNUC__)
+    int msb = 63 - __builtin_clzll(static_cast<unsigned long long>(duration));
+#else
+    int msb = _bits;
+    while(duration >> (msb + 1))
+    {
+        ++msb;
+    }
+#endif
+    int shift = msb - _bits + 1;
+    return static_cast<size_t>(subBuckets + (shift - 1) * (subBuckets / 2) + ((duration >> shift) - subBuckets / 2));
+}
+
+Ice::Long
+MetricsHistogram::upperBound(size_t i) const
+{
+    const size_t subBuckets = static_cast<size_t>(1) << _bits;
+    if(i < subBuckets)
+    {
+        return static_cast<Ice::Long>(i);
+    }
+    int shift = static_cast<int>((i - subBuckets) / (subBuckets / 2)) + 1;
+    Ice::Long m = static_cast<Ice::Long>((i - subBuckets) % (subBuckets / 2) + subBuckets / 2);
+    return ((m + 1) << shift) - 1;
+}
+
 MetricsMapI::MetricsMapI(const std::string& mapPrefix, const PropertiesPtr& properties) :
     _properties(properties->getPropertiesForPrefix(mapPrefix)),
     _retain(properties->getPropertyAsIntWithDefault(mapPrefix + "RetainDetached", 10)),
+    _histogram(parseHistogram(properties, mapPrefix + "Histogram")),
     _accept(parseRule(properties, mapPrefix + "Accept")),
     _reject(parseRule(properties, mapPrefix + "Reject"))
 {
@@ -202,6 +336,7 @@ MetricsMapI::MetricsMapI(const MetricsMapI& map) :
     _groupByAttributes(map._groupByAttributes),
     _groupBySeparators(map._groupBySeparators),
     _retain(map._retain),
+    _histogram(map._histogram),
     _accept(map._accept),
     _reject(map._reject)
 {
@@ -478,6 +613,21 @@ MetricsAdminI::updateViews()
     }
 }
 
+void
+MetricsAdminI::registerMap(const std::string& map, const MetricsMapFactoryPtr& factory)
+{
+    bool updated;
+    {
+        Lock sync(*this);
+        _factories[map] = factory;
+        updated = addOrUpdateMap(map, factory);
+    }
+    if(updated)
+    {
+        factory->update();
+    }
+}
+
 void
 MetricsAdminI::unregisterMap(const std::string& mapName)
 {
@@ -92,28 +92,6 @@ struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
     }
 };
 
-void
-sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
-{
-    if(selType == Ice::Random)
-    {
-        RandomNumberGenerator rng;
-        random_shuffle(addrs.begin(), addrs.end(), rng);
-    }
-
-    if(protocol == EnableBoth)
-    {
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
-        }
-    }
-}
-
 void
 setTcpNoDelay(SOCKET fd)
 {
@@ -687,6 +665,31 @@ IceInternal::errorToStringDNS(int error)
 }
 #endif
 
+#ifndef ICE_OS_WINRT
+void
+IceInternal::sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
+                           bool preferIPv6)
+{
+    if(selType == Ice::Random)
+    {
+        RandomNumberGenerator rng;
+        random_shuffle(addrs.begin(), addrs.end(), rng);
+    }
+
+    if(protocol == EnableBoth)
+    {
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
+        }
+    }
+}
+#endif
+
 #ifdef ICE_OS_WINRT
 vector<Address>
 IceInternal::getAddresses(const string& host, int port, ProtocolSupport, Ice::EndpointSelectionType, bool, bool)
@@ -1629,6 +1632,44 @@ IceInternal::getRecvBufferSize(SOCKET fd)
 #endif
 }
 
+int
+IceInternal::getIncomingCPU(SOCKET fd)
+{
+    //
+    // Returns the CPU which processed the last packet received by the
+    // socket, or -1 if unknown (SO_INCOMING_CPU requires Linux 3.19).
+    //
+#if defined(SO_INCOMING_CPU)
+    int cpu;
+    socklen_t len = sizeof(cpu);
+    if(getsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, (char*)&cpu, &len) == SOCKET_ERROR ||
+       static_cast<unsigned int>(len) != sizeof(cpu))
+    {
+        return -1;
+    }
+    return cpu;
+#else
+    return -1;
+#endif
+}
+
+void
+IceInternal::setBusyPoll(SOCKET fd, int busyPoll)
+{
+    //
+    // Let the kernel busy poll the device queue for up to busyPoll
+    // microseconds on reads (SO_BUSY_POLL requires Linux 3.11). This
+    // is best effort: raising the value above the net.core.busy_read
+    // setting requires CAP_NET_ADMIN, errors are ignored.
+    //
+#if defined(SO_BUSY_POLL)
+    setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, (char*)&busyPoll, int(sizeof(int)));
+#else
+    (void)fd;
+    (void)busyPoll;
+#endif
+}
+
 #ifndef ICE_OS_WINRT
 void
 IceInternal::setMcastGroup(SOCKET fd, const Address& group, const string& intf)
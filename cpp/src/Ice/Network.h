@@ -261,6 +261,9 @@ ICE_API bool noMoreFds(int);
 ICE_API std::string errorToStringDNS(int);
 ICE_API std::vector<Address> getAddresses(const std::string&, int, ProtocolSupport, Ice::EndpointSelectionType, bool, 
                                           bool);
+#ifndef ICE_OS_WINRT
+ICE_API void sortAddresses(std::vector<Address>&, ProtocolSupport, Ice::EndpointSelectionType, bool);
+#endif
 ICE_API ProtocolSupport getProtocolSupport(const Address&);
 ICE_API Address getAddressForServer(const std::string&, int, ProtocolSupport, bool);
 ICE_API int compareAddress(const Address&, const Address&);
@@ -294,6 +297,8 @@ ICE_API void setSendBufferSize(SOCKET, int);
 ICE_API int getSendBufferSize(SOCKET);
 ICE_API void setRecvBufferSize(SOCKET, int);
 ICE_API int getRecvBufferSize(SOCKET);
+ICE_API int getIncomingCPU(SOCKET);
+ICE_API void setBusyPoll(SOCKET, int);
 
 ICE_API void setMcastGroup(SOCKET, const Address&, const std::string&);
 ICE_API void setMcastInterface(SOCKET, const std::string&, const Address&);
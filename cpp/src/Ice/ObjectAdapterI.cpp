@@ -963,12 +963,13 @@ Ice::ObjectAdapterI::initialize(const RouterPrx& router)
         int threadPoolSize = properties->getPropertyAsInt(_name + ".ThreadPool.Size");
         int threadPoolSizeMax = properties->getPropertyAsInt(_name + ".ThreadPool.SizeMax");
         bool hasPriority = properties->getProperty(_name + ".ThreadPool.ThreadPriority") != "";
+        int threadPoolReactors = properties->getPropertyAsInt(_name + ".ThreadPool.Reactors");
 
         //
         // Create the per-adapter thread pool, if necessary. This is done before the creation of the incoming
         // connection factory as the thread pool is needed during creation for the call to incFdsInUse.
         //
-        if(threadPoolSize > 0 || threadPoolSizeMax > 0 || hasPriority)
+        if(threadPoolSize > 0 || threadPoolSizeMax > 0 || hasPriority || threadPoolReactors > 0)
         {
             _threadPool = new ThreadPool(_instance, _name + ".ThreadPool", 0);
         }
@@ -94,13 +94,13 @@ IceInternal::Outgoing::Outgoing(RequestHandler* handler, const string& operation
 { 
     checkSupportedProtocol(getCompatibleProtocol(handler->getReference()->getProtocol()));
 
+    bool batch = false;
     switch(_handler->getReference()->getMode())
     {
         case Reference::ModeTwoway:
         case Reference::ModeOneway:
         case Reference::ModeDatagram:
         {
-            _os.writeBlob(requestHdr, sizeof(requestHdr));
             break;
         }
 
@@ -108,30 +108,17 @@ IceInternal::Outgoing::Outgoing(RequestHandler* handler, const string& operation
         case Reference::ModeBatchDatagram:
         {
             _handler->prepareBatchRequest(&_os);
+            batch = true;
             break;
         }
     }
 
     try
     {
-        _os.write(_handler->getReference()->getIdentity());
-
         //
-        // For compatibility with the old FacetPath.
+        // The batch request header is written by prepareBatchRequest.
         //
-        if(_handler->getReference()->getFacet().empty())
-        {
-            _os.write(static_cast<string*>(0), static_cast<string*>(0));
-        }
-        else
-        {
-            string facet = _handler->getReference()->getFacet();
-            _os.write(&facet, &facet + 1);
-        }
-
-        _os.write(operation, false);
-
-        _os.write(static_cast<Byte>(mode));
+        _handler->getReference()->writeRequestHeader(&_os, operation, mode, !batch);
 
         if(context != 0)
         {
@@ -35,6 +35,7 @@ IceUtil::Shared* Ice::upCast(AsyncResult* p) { return p; }
 
 IceUtil::Shared* IceInternal::upCast(OutgoingAsyncMessageCallback* p) { return p; }
 IceUtil::Shared* IceInternal::upCast(OutgoingAsync* p) { return p; }
+IceUtil::Shared* IceInternal::upCast(EncodedParams* p) { return p; }
 IceUtil::Shared* IceInternal::upCast(BatchOutgoingAsync* p) { return p; }
 IceUtil::Shared* IceInternal::upCast(ProxyBatchOutgoingAsync* p) { return p; }
 IceUtil::Shared* IceInternal::upCast(ConnectionBatchOutgoingAsync* p) { return p; }
@@ -93,6 +94,16 @@ private:
 
 };
 
+IceInternal::ReplyStream::ReplyStream(Instance* instance) :
+    BasicStream(instance, Ice::currentProtocolEncoding)
+{
+    //
+    // Sequence views unmarshaled from the reply reference its buffer
+    // and only keep this stream alive.
+    //
+    enableZeroCopyViews(this);
+}
+
 Ice::AsyncResult::AsyncResult(const CommunicatorPtr& communicator,
                               const IceInternal::InstancePtr& instance,
                               const string& op,
@@ -103,7 +114,8 @@ Ice::AsyncResult::AsyncResult(const CommunicatorPtr& communicator,
     _operation(op),
     _callback(del),
     _cookie(cookie),
-    _is(instance.get(), Ice::currentProtocolEncoding),
+    _replyStream(new ReplyStream(instance.get())),
+    _is(*_replyStream),
     _os(instance.get(), Ice::currentProtocolEncoding),
     _state(0),
     _sentSynchronously(false),
@@ -113,6 +125,7 @@ Ice::AsyncResult::AsyncResult(const CommunicatorPtr& communicator,
     {
         throw IceUtil::IllegalArgumentException(__FILE__, __LINE__);
     }
+
     const_cast<CallbackBasePtr&>(_callback) = _callback->__verify(const_cast<LocalObjectPtr&>(_cookie));
 }
 
@@ -421,6 +434,19 @@ Ice::AsyncResult::__warning() const
     }
 }
 
+IceInternal::EncodedParams::EncodedParams(const CommunicatorPtr& communicator, const Context& context,
+                                          const pair<const Byte*, const Byte*>& inParams) :
+    _instance(getInstance(communicator)),
+    _os(_instance.get(), Ice::currentProtocolEncoding),
+    _emptyParams(inParams.first == inParams.second)
+{
+    _os.write(context);
+    if(!_emptyParams)
+    {
+        _os.writeEncaps(inParams.first, static_cast<Int>(inParams.second - inParams.first));
+    }
+}
+
 IceInternal::OutgoingAsync::OutgoingAsync(const ObjectPrx& prx,
                                           const std::string& operation,
                                           const CallbackBasePtr& delegate,
@@ -434,45 +460,7 @@ IceInternal::OutgoingAsync::OutgoingAsync(const ObjectPrx& prx,
 void
 IceInternal::OutgoingAsync::__prepare(const std::string& operation, OperationMode mode, const Context* context)
 {
-    _delegate = 0;
-    _cnt = 0;
-    _mode = mode;
-    _sentSynchronously = false;
-
-    checkSupportedProtocol(getCompatibleProtocol(_proxy->__reference()->getProtocol()));
-
-    _observer.attach(_proxy.get(), operation, context);
-
-    //
-    // Can't call async via a batch proxy.
-    //
-    if(_proxy->ice_isBatchOneway() || _proxy->ice_isBatchDatagram())
-    {
-        throw Ice::FeatureNotSupportedException(__FILE__, __LINE__, "can't send batch requests with AMI");
-    }
-
-    _os.writeBlob(requestHdr, sizeof(requestHdr));
-
-    Reference* ref = _proxy->__reference().get();
-
-    _os.write(ref->getIdentity());
-
-    //
-    // For compatibility with the old FacetPath.
-    //
-    if(ref->getFacet().empty())
-    {
-        _os.write(static_cast<string*>(0), static_cast<string*>(0));
-    }
-    else
-    {
-        string facet = ref->getFacet();
-        _os.write(&facet, &facet + 1);
-    }
-
-    _os.write(operation, false);
-
-    _os.write(static_cast<Byte>(_mode));
+    Reference* ref = prepareRequest(operation, mode, context);
 
     if(context != 0)
     {
@@ -499,6 +487,66 @@ IceInternal::OutgoingAsync::__prepare(const std::string& operation, OperationMod
     }
 }
 
+void
+IceInternal::OutgoingAsync::__prepare(const std::string& operation, OperationMode mode, const Context& context,
+                                      const EncodedParamsPtr& params)
+{
+    prepareRequest(operation, mode, &context);
+
+    //
+    // The context is an explicit context, it's not merged with the
+    // proxy or implicit context and its encoding doesn't depend on
+    // the encoding of the proxy.
+    //
+    if(params->emptyParams())
+    {
+        _os.writeBlob(params->begin(), static_cast<size_t>(params->end() - params->begin()));
+        _os.writeEmptyEncaps(_encoding);
+    }
+    else
+    {
+        _params = params;
+        _tail.reset(new Buffer(params->begin(), params->end()));
+    }
+}
+
+void
+IceInternal::OutgoingAsync::__mergeTail()
+{
+    if(_tail.get())
+    {
+        _os.writeBlob(_tail->b.begin(), _tail->b.size());
+        _tail.reset();
+        _params = 0;
+    }
+}
+
+Reference*
+IceInternal::OutgoingAsync::prepareRequest(const std::string& operation, OperationMode mode, const Context* context)
+{
+    _delegate = 0;
+    _cnt = 0;
+    _mode = mode;
+    _sentSynchronously = false;
+
+    checkSupportedProtocol(getCompatibleProtocol(_proxy->__reference()->getProtocol()));
+
+    _observer.attach(_proxy.get(), operation, context);
+
+    //
+    // Can't call async via a batch proxy.
+    //
+    if(_proxy->ice_isBatchOneway() || _proxy->ice_isBatchDatagram())
+    {
+        throw Ice::FeatureNotSupportedException(__FILE__, __LINE__, "can't send batch requests with AMI");
+    }
+
+    Reference* ref = _proxy->__reference().get();
+
+    ref->writeRequestHeader(&_os, operation, _mode, true);
+    return ref;
+}
+
 bool
 IceInternal::OutgoingAsync::__sent(Ice::ConnectionI* connection)
 {
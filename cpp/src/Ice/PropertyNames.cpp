@@ -8,7 +8,7 @@
 // **********************************************************************
 
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Fri Jul 26 23:12:55 2013
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sun Oct 18 09:03:50 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -28,6 +28,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Router", false, 0),
     IceInternal::Property("Ice.Admin.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.Coalesce", false, 0),
     IceInternal::Property("Ice.Admin.Locator", false, 0),
     IceInternal::Property("Ice.Admin.PublishedEndpoints", false, 0),
     IceInternal::Property("Ice.Admin.ReplicaGroupId", false, 0),
@@ -38,6 +39,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Router.Router", false, 0),
     IceInternal::Property("Ice.Admin.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Admin.Router.Coalesce", false, 0),
     IceInternal::Property("Ice.Admin.Router", false, 0),
     IceInternal::Property("Ice.Admin.ProxyOptions", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.Size", false, 0),
@@ -47,15 +49,41 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Facets", false, 0),
     IceInternal::Property("Ice.Admin.InstanceName", false, 0),
     IceInternal::Property("Ice.Admin.ServerId", false, 0),
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", false, 0),
+    IceInternal::Property("Ice.BufferPool", false, 0),
+    IceInternal::Property("Ice.BufferPool.MaxBuffers", false, 0),
+    IceInternal::Property("Ice.BufferPool.MaxSize", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
+    IceInternal::Property("Ice.Coalesce.MaxSize", false, 0),
+    IceInternal::Property("Ice.Coalesce.Window", false, 0),
+    IceInternal::Property("Ice.Compression.Codec", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
+    IceInternal::Property("Ice.Compression.MaxRatio", false, 0),
+    IceInternal::Property("Ice.Compression.MinSize", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
@@ -69,6 +97,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Default.Locator.Router", false, 0),
     IceInternal::Property("Ice.Default.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.Locator.Coalesce", false, 0),
     IceInternal::Property("Ice.Default.Locator", false, 0),
     IceInternal::Property("Ice.Default.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Package", false, 0),
@@ -81,6 +110,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Router.Locator", false, 0),
     IceInternal::Property("Ice.Default.Router.Router", false, 0),
     IceInternal::Property("Ice.Default.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.Router.Coalesce", false, 0),
     IceInternal::Property("Ice.Default.Router", false, 0),
     IceInternal::Property("Ice.Default.SlicedFormat", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
@@ -88,6 +118,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.GC.Interval", false, 0),
+    IceInternal::Property("Ice.HostResolver.CacheTTL", false, 0),
+    IceInternal::Property("Ice.HostResolver.NegativeCacheTTL", false, 0),
+    IceInternal::Property("Ice.HostResolver.Size", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
     IceInternal::Property("Ice.LogFile", false, 0),
@@ -108,8 +141,12 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
+    IceInternal::Property("Ice.RequestHeaderCacheSize", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
+    IceInternal::Property("Ice.SendQueue.MaxMessages", false, 0),
+    IceInternal::Property("Ice.SendQueue.MaxSize", false, 0),
+    IceInternal::Property("Ice.SendQueue.Policy", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
     IceInternal::Property("Ice.SOCKSProxyPort", false, 0),
     IceInternal::Property("Ice.StdErr", false, 0),
@@ -122,6 +159,24 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Affinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.PinThreads", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.BusyPoll", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.BusyPollSocket", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.NUMA", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.NUMAIncoming", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactors", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.Size", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.SizeMax", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.StackSize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.Serialize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.Affinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.PinThreads", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
@@ -129,7 +184,26 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Affinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.PinThreads", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.BusyPoll", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.BusyPollSocket", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.NUMA", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.NUMAIncoming", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactors", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.Size", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.SizeMax", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.StackSize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.Serialize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.Affinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.PinThreads", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Timer.Tick", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.GC", false, 0),
     IceInternal::Property("Ice.Trace.Locator", false, 0),
@@ -138,6 +212,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Trace.Retry", false, 0),
     IceInternal::Property("Ice.Trace.Slicing", false, 0),
     IceInternal::Property("Ice.Trace.ThreadPool", false, 0),
+    IceInternal::Property("Ice.UDP.BatchSize", false, 0),
     IceInternal::Property("Ice.UDP.RcvSize", false, 0),
     IceInternal::Property("Ice.UDP.SndSize", false, 0),
     IceInternal::Property("Ice.TCP.Backlog", false, 0),
@@ -166,6 +241,7 @@ const IceInternal::Property IceMXPropsData[] =
     IceInternal::Property("IceMX.Metrics.*.RetainDetached", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Accept", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Reject", false, 0),
+    IceInternal::Property("IceMX.Metrics.*.Histogram", false, 0),
     IceInternal::Property("IceMX.Metrics.*", false, 0),
 };
 
@@ -190,6 +266,7 @@ const IceInternal::Property IceBoxPropsData[] =
     IceInternal::Property("IceBox.ServiceManager.Locator.Locator", false, 0),
     IceInternal::Property("IceBox.ServiceManager.Locator.Router", false, 0),
     IceInternal::Property("IceBox.ServiceManager.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.Locator.Coalesce", false, 0),
     IceInternal::Property("IceBox.ServiceManager.Locator", false, 0),
     IceInternal::Property("IceBox.ServiceManager.PublishedEndpoints", false, 0),
     IceInternal::Property("IceBox.ServiceManager.ReplicaGroupId", false, 0),
@@ -200,6 +277,7 @@ const IceInternal::Property IceBoxPropsData[] =
     IceInternal::Property("IceBox.ServiceManager.Router.Locator", false, 0),
     IceInternal::Property("IceBox.ServiceManager.Router.Router", false, 0),
     IceInternal::Property("IceBox.ServiceManager.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.Router.Coalesce", false, 0),
     IceInternal::Property("IceBox.ServiceManager.Router", false, 0),
     IceInternal::Property("IceBox.ServiceManager.ProxyOptions", false, 0),
     IceInternal::Property("IceBox.ServiceManager.ThreadPool.Size", false, 0),
@@ -209,6 +287,24 @@ const IceInternal::Property IceBoxPropsData[] =
     IceInternal::Property("IceBox.ServiceManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceBox.ServiceManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceBox.ServiceManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceBox.ServiceManager.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceBox.Trace.ServiceObserver", false, 0),
     IceInternal::Property("IceBox.UseSharedCommunicator.*", false, 0),
 };
@@ -226,6 +322,7 @@ const IceInternal::Property IceBoxAdminPropsData[] =
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Locator", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Router", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.CollocationOptimized", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Coalesce", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy", false, 0),
 };
 
@@ -260,6 +357,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.Coalesce", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.PublishedEndpoints", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ReplicaGroupId", false, 0),
@@ -270,6 +368,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.Coalesce", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ProxyOptions", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Size", false, 0),
@@ -279,6 +378,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM", false, 0),
     IceInternal::Property("IceGrid.Node.AdapterId", false, 0),
@@ -290,6 +407,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Node.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.PublishedEndpoints", false, 0),
     IceInternal::Property("IceGrid.Node.ReplicaGroupId", false, 0),
@@ -300,6 +418,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Node.Router", false, 0),
     IceInternal::Property("IceGrid.Node.ProxyOptions", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.Size", false, 0),
@@ -309,6 +428,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
@@ -333,6 +470,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Router", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper", false, 0),
     IceInternal::Property("IceGrid.Node.WaitTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminCryptPasswords", false, 0),
@@ -343,6 +481,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM", false, 0),
@@ -355,6 +494,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.PublishedEndpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ReplicaGroupId", false, 0),
@@ -365,6 +505,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ProxyOptions", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Size", false, 0),
@@ -374,6 +515,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
@@ -381,6 +540,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.AdapterId", false, 0),
@@ -392,6 +552,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.PublishedEndpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ReplicaGroupId", false, 0),
@@ -402,6 +563,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ProxyOptions", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Size", false, 0),
@@ -411,6 +573,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.Data", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
@@ -425,6 +605,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.PublishedEndpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ReplicaGroupId", false, 0),
@@ -435,6 +616,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ProxyOptions", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Size", false, 0),
@@ -444,6 +626,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, 0),
@@ -452,6 +652,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier", false, 0),
     IceInternal::Property("IceGrid.Registry.ReplicaName", false, 0),
     IceInternal::Property("IceGrid.Registry.ReplicaSessionTimeout", false, 0),
@@ -467,6 +668,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.PublishedEndpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ReplicaGroupId", false, 0),
@@ -477,6 +679,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ProxyOptions", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Size", false, 0),
@@ -486,6 +689,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.AdapterId", false, 0),
@@ -497,6 +718,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.PublishedEndpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ReplicaGroupId", false, 0),
@@ -507,6 +729,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ProxyOptions", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Size", false, 0),
@@ -516,6 +739,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
@@ -524,6 +765,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.CollocationOptimized", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Coalesce", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier", false, 0),
     IceInternal::Property("IceGrid.Registry.Trace.Application", false, 0),
     IceInternal::Property("IceGrid.Registry.Trace.Adapter", false, 0),
@@ -563,6 +805,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Locator.Locator", false, 0),
     IceInternal::Property("IcePatch2.Locator.Router", false, 0),
     IceInternal::Property("IcePatch2.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("IcePatch2.Locator.Coalesce", false, 0),
     IceInternal::Property("IcePatch2.Locator", false, 0),
     IceInternal::Property("IcePatch2.PublishedEndpoints", false, 0),
     IceInternal::Property("IcePatch2.ReplicaGroupId", false, 0),
@@ -573,6 +816,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.Locator", false, 0),
     IceInternal::Property("IcePatch2.Router.Router", false, 0),
     IceInternal::Property("IcePatch2.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("IcePatch2.Router.Coalesce", false, 0),
     IceInternal::Property("IcePatch2.Router", false, 0),
     IceInternal::Property("IcePatch2.ProxyOptions", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.Size", false, 0),
@@ -582,6 +826,24 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("IcePatch2.ChunkSize", true, "IcePatch2Client.ChunkSize"),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
@@ -672,6 +934,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.Coalesce", false, 0),
     IceInternal::Property("Glacier2.Client.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.PublishedEndpoints", false, 0),
     IceInternal::Property("Glacier2.Client.ReplicaGroupId", false, 0),
@@ -682,6 +945,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.Coalesce", false, 0),
     IceInternal::Property("Glacier2.Client.Router", false, 0),
     IceInternal::Property("Glacier2.Client.ProxyOptions", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.Size", false, 0),
@@ -691,6 +955,24 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
@@ -714,6 +996,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.Coalesce", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier", false, 0),
     IceInternal::Property("Glacier2.ReturnClientProxy", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.EndpointSelection", false, 0),
@@ -723,6 +1006,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.Coalesce", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier", false, 0),
     IceInternal::Property("Glacier2.RoutingTable.MaxSize", false, 0),
     IceInternal::Property("Glacier2.Server.ACM", false, 0),
@@ -735,6 +1019,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.Coalesce", false, 0),
     IceInternal::Property("Glacier2.Server.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.PublishedEndpoints", false, 0),
     IceInternal::Property("Glacier2.Server.ReplicaGroupId", false, 0),
@@ -745,6 +1030,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Router.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.Coalesce", false, 0),
     IceInternal::Property("Glacier2.Server.Router", false, 0),
     IceInternal::Property("Glacier2.Server.ProxyOptions", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.Size", false, 0),
@@ -754,6 +1040,24 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Affinity", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.PinThreads", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.BusyPollSocket", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.NUMA", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.NUMAIncoming", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.Size", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.SizeMax", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.SizeWarn", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.StackSize", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.Serialize", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.ThreadIdleTime", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.Affinity", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.PinThreads", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.BusyPoll", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactor.BusyPollSocket", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
@@ -767,6 +1071,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SessionManager.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.Coalesce", false, 0),
     IceInternal::Property("Glacier2.SessionManager", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.ConnectionCached", false, 0),
@@ -775,6 +1080,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLSessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.CollocationOptimized", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.Coalesce", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager", false, 0),
     IceInternal::Property("Glacier2.SessionTimeout", false, 0),
     IceInternal::Property("Glacier2.Trace.RoutingTable", false, 0),
@@ -8,7 +8,7 @@
 // **********************************************************************
 
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Fri Jul 26 23:12:55 2013
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sun Oct 18 09:03:50 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
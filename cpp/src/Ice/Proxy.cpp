@@ -88,6 +88,34 @@ IceInternal::Cpp11FnOnewayCallbackNC::__completed(const ::Ice::AsyncResultPtr& r
         _cb();
     }
 }
+
+void
+IceInternal::Cpp11OnewayPromiseCallback::__completed(const ::Ice::AsyncResultPtr& result) const
+{
+    try
+    {
+        result->getProxy()->__end(result, result->getOperation());
+    }
+    catch(const ::Ice::Exception& ex)
+    {
+        __exception(ex);
+        return;
+    }
+    _promise.set_value();
+}
+
+void
+IceInternal::Cpp11OnewayPromiseCallback::__sent(const ::Ice::AsyncResultPtr& result) const
+{
+    //
+    // Oneway invocations don't complete once they are sent unless
+    // they fail.
+    //
+    if(!result->getProxy()->ice_isTwoway())
+    {
+        _promise.set_value();
+    }
+}
 #endif
 
 bool
@@ -635,6 +663,27 @@ IceProxy::Ice::Object::begin_ice_invoke(const string& operation,
     return __result;
 }
 
+AsyncResultPtr
+IceProxy::Ice::Object::__begin_ice_invoke(const string& operation,
+                                          OperationMode mode,
+                                          const Context& ctx,
+                                          const EncodedParamsPtr& params,
+                                          const ::IceInternal::CallbackBasePtr& del,
+                                          const ::Ice::LocalObjectPtr& cookie)
+{
+    OutgoingAsyncPtr __result = new OutgoingAsync(this, ice_invoke_name, del, cookie);
+    try
+    {
+        __result->__prepare(operation, mode, ctx, params);
+        __result->__send(true);
+    }
+    catch(const LocalException& __ex)
+    {
+        __result->__exceptionAsync(__ex);
+    }
+    return __result;
+}
+
 bool
 IceProxy::Ice::Object::___end_ice_invoke(pair<const Byte*, const Byte*>& outEncaps, const AsyncResultPtr& __result)
 {
@@ -897,6 +946,27 @@ IceProxy::Ice::Object::ice_preferSecure(bool b) const
     }
 }
 
+bool
+IceProxy::Ice::Object::ice_isCoalesce() const
+{
+    return _reference->getCoalesce();
+}
+
+ObjectPrx
+IceProxy::Ice::Object::ice_coalesce(bool b) const
+{
+    if(b == _reference->getCoalesce())
+    {
+        return ObjectPrx(const_cast< ::IceProxy::Ice::Object*>(this));
+    }
+    else
+    {
+        ObjectPrx proxy = __newInstance();
+        proxy->setup(_reference->changeCoalesce(b));
+        return proxy;
+    }
+}
+
 RouterPrx
 IceProxy::Ice::Object::ice_getRouter() const
 {
@@ -214,6 +214,15 @@ IceInternal::ProxyFactory::checkRetryAfterException(const LocalException& ex,
         ex.ice_throw();
     }
 
+    //
+    // A request rejected because the send queue of the connection is
+    // full would be rejected again, the application must pace itself.
+    //
+    if(dynamic_cast<const SendQueueFullException*>(&ex))
+    {
+        ex.ice_throw();
+    }
+
     ++cnt;
     assert(cnt > 0);
 
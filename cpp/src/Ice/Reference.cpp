@@ -60,6 +60,52 @@ public:
 
 Init init;
 
+//
+// Read the head of a request header cache and add an entry at the
+// head. Entries are published with release semantics and read with
+// acquire semantics: a reader which sees an entry sees its contents.
+// Platforms without atomic builtins use a mutex instead.
+//
+template<typename T> inline T*
+loadHead(T* const volatile* head)
+{
+#if defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+    return __atomic_load_n(head, __ATOMIC_ACQUIRE);
+#elif defined(ICE_HAS_GCC_BUILTINS)
+    T* p = *head;
+    __sync_synchronize();
+    return p;
+#elif defined(_WIN32)
+    return static_cast<T*>(InterlockedCompareExchangePointer(const_cast<void* volatile*>(
+                                                                 reinterpret_cast<void* const volatile*>(head)), 0, 0));
+#else
+    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(hashMutex);
+    return *head;
+#endif
+}
+
+template<typename T> inline bool
+compareAndSwapHead(T* volatile* head, T* expected, T* desired)
+{
+#if defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+    return __atomic_compare_exchange_n(head, &expected, desired, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+#elif defined(ICE_HAS_GCC_BUILTINS)
+    return __sync_bool_compare_and_swap(head, expected, desired);
+#elif defined(_WIN32)
+    return InterlockedCompareExchangePointer(reinterpret_cast<void* volatile*>(head),
+                                             const_cast<void*>(static_cast<const void*>(desired)),
+                                             const_cast<void*>(static_cast<const void*>(expected))) == expected;
+#else
+    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(hashMutex);
+    if(*head != expected)
+    {
+        return false;
+    }
+    *head = desired;
+    return true;
+#endif
+}
+
 struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
 {
     ptrdiff_t operator()(ptrdiff_t d)
@@ -169,6 +215,93 @@ Reference::hash() const
     return _hashValue;
 }
 
+void
+IceInternal::Reference::writeRequestHeader(BasicStream* s, const string& operation, OperationMode mode,
+                                           bool header) const
+{
+    if(header)
+    {
+        s->writeBlob(requestHdr, sizeof(requestHdr));
+    }
+
+    const size_t cacheSize = _instance->requestHeaderCacheSize();
+    const CachedRequestHeader* head = 0;
+    if(cacheSize > 0)
+    {
+        head = loadHead(&_requestHeaders);
+        for(const CachedRequestHeader* p = head; p; p = p->next)
+        {
+            if(p->mode == mode && p->operation == operation)
+            {
+                s->writeBlob(&p->bytes[0], p->bytes.size());
+                return;
+            }
+        }
+    }
+
+    //
+    // Not cached, marshal the identity, facet, operation and mode.
+    //
+    const size_t start = s->b.size();
+    s->write(_identity);
+
+    //
+    // For compatibility with the old FacetPath.
+    //
+    if(_facet.empty())
+    {
+        s->write(static_cast<string*>(0), static_cast<string*>(0));
+    }
+    else
+    {
+        s->write(&_facet, &_facet + 1);
+    }
+
+    s->write(operation, false);
+    s->write(static_cast<Byte>(mode));
+
+    if(cacheSize == 0 || (head && head->count >= cacheSize))
+    {
+        return;
+    }
+
+    //
+    // The encoding of the identity, the facet and the operation
+    // doesn't depend on the encoding of the reference, the request is
+    // always marshaled with the protocol encoding.
+    //
+    CachedRequestHeader* entry = new CachedRequestHeader;
+    entry->operation = operation;
+    entry->mode = mode;
+    entry->bytes.assign(s->b.begin() + start, s->b.end());
+    entry->next = head;
+    entry->count = head ? head->count + 1 : 1;
+    while(!compareAndSwapHead(&_requestHeaders, head, static_cast<const CachedRequestHeader*>(entry)))
+    {
+        //
+        // Another thread added an entry, give up if it's for the same
+        // operation or if the cache is full.
+        //
+        const CachedRequestHeader* newHead = loadHead(&_requestHeaders);
+        for(const CachedRequestHeader* p = newHead; p != head; p = p->next)
+        {
+            if(p->mode == mode && p->operation == operation)
+            {
+                delete entry;
+                return;
+            }
+        }
+        if(newHead->count >= cacheSize)
+        {
+            delete entry;
+            return;
+        }
+        head = newHead;
+        entry->next = head;
+        entry->count = head->count + 1;
+    }
+}
+
 void
 IceInternal::Reference::streamWrite(BasicStream* s) const
 {
@@ -500,6 +633,7 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
     _facet(facet),
     _protocol(protocol),
     _encoding(encoding),
+    _requestHeaders(0),
     _overrideCompress(false),
     _compress(false)
 {
@@ -516,11 +650,23 @@ IceInternal::Reference::Reference(const Reference& r) :
     _facet(r._facet),
     _protocol(r._protocol),
     _encoding(r._encoding),
+    _requestHeaders(0),
     _overrideCompress(r._overrideCompress),
     _compress(r._compress)
 {
 }
 
+IceInternal::Reference::~Reference()
+{
+    const CachedRequestHeader* p = _requestHeaders;
+    while(p)
+    {
+        const CachedRequestHeader* next = p->next;
+        delete p;
+        p = next;
+    }
+}
+
 int
 IceInternal::Reference::hashInit() const
 {
@@ -588,6 +734,12 @@ IceInternal::FixedReference::getPreferSecure() const
     return false;
 }
 
+bool
+IceInternal::FixedReference::getCoalesce() const
+{
+    return false;
+}
+
 Ice::EndpointSelectionType
 IceInternal::FixedReference::getEndpointSelection() const
 {
@@ -655,6 +807,13 @@ IceInternal::FixedReference::changePreferSecure(bool) const
     return 0; // Keep the compiler happy.
 }
 
+ReferencePtr
+IceInternal::FixedReference::changeCoalesce(bool) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+    return 0; // Keep the compiler happy.
+}
+
 ReferencePtr
 IceInternal::FixedReference::changeEndpointSelection(EndpointSelectionType) const
 {
@@ -872,6 +1031,7 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   bool collocationOptimized,
                                                   bool cacheConnection,
                                                   bool preferSecure, 
+                                                  bool coalesce,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout) :
     Reference(instance, communicator, id, facet, mode, secure, protocol, encoding),
@@ -882,6 +1042,7 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
     _collocationOptimized(collocationOptimized),
     _cacheConnection(cacheConnection),
     _preferSecure(preferSecure),
+    _coalesce(coalesce),
     _endpointSelection(endpointSelection),
     _locatorCacheTimeout(locatorCacheTimeout),
     _overrideTimeout(false),
@@ -932,6 +1093,12 @@ IceInternal::RoutableReference::getPreferSecure() const
     return _preferSecure;
 }
 
+bool
+IceInternal::RoutableReference::getCoalesce() const
+{
+    return _coalesce;
+}
+
 Ice::EndpointSelectionType
 IceInternal::RoutableReference::getEndpointSelection() const
 {
@@ -1071,6 +1238,18 @@ IceInternal::RoutableReference::changePreferSecure(bool newPreferSecure) const
     return r;
 }
 
+ReferencePtr
+IceInternal::RoutableReference::changeCoalesce(bool newCoalesce) const
+{
+    if(newCoalesce == _coalesce)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_coalesce = newCoalesce;
+    return r;
+}
+
 ReferencePtr
 IceInternal::RoutableReference::changeEndpointSelection(EndpointSelectionType newType) const
 {
@@ -1233,6 +1412,14 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
+    if(_coalesce)
+    {
+        //
+        // Only written when set, so that existing proxy properties
+        // are unchanged for proxies which don't coalesce requests.
+        //
+        properties[prefix + ".Coalesce"] = "1";
+    }
     properties[prefix + ".EndpointSelection"] = _endpointSelection == Random ? "Random" : "Ordered";
 
     ostringstream s;
@@ -1288,6 +1475,10 @@ IceInternal::RoutableReference::operator==(const Reference& r) const
     {
         return false;
     }
+    if(_coalesce != rhs->_coalesce)
+    {
+        return false;
+    }
     if(_collocationOptimized != rhs->_collocationOptimized)
     {
         return false;
@@ -1369,6 +1560,14 @@ IceInternal::RoutableReference::operator<(const Reference& r) const
     {
         return false;
     }
+    if(!_coalesce && rhs->_coalesce)
+    {
+        return true;
+    }
+    else if(rhs->_coalesce < _coalesce)
+    {
+        return false;
+    }
     if(!_collocationOptimized && rhs->_collocationOptimized)
     {
         return true;
@@ -1935,6 +2134,7 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     _collocationOptimized(r._collocationOptimized),
     _cacheConnection(r._cacheConnection),
     _preferSecure(r._preferSecure),
+    _coalesce(r._coalesce),
     _endpointSelection(r._endpointSelection),
     _locatorCacheTimeout(r._locatorCacheTimeout),
     _overrideTimeout(r._overrideTimeout),
@@ -11,6 +11,7 @@
 #define ICE_REFERENCE_H
 
 #include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
 #include <Ice/ReferenceF.h>
 #include <Ice/ReferenceFactoryF.h>
 #include <Ice/EndpointIF.h>
@@ -22,6 +23,7 @@
 #include <Ice/ConnectionIF.h>
 #include <Ice/SharedContext.h>
 #include <Ice/Identity.h>
+#include <Ice/Current.h>
 #include <Ice/Protocol.h>
 #include <Ice/Properties.h>
 
@@ -72,6 +74,7 @@ public:
     virtual bool getCollocationOptimized() const = 0;
     virtual bool getCacheConnection() const = 0;
     virtual bool getPreferSecure() const = 0;
+    virtual bool getCoalesce() const = 0;
     virtual Ice::EndpointSelectionType getEndpointSelection() const = 0;
     virtual int getLocatorCacheTimeout() const = 0;
     virtual std::string getConnectionId() const = 0;
@@ -97,6 +100,7 @@ public:
     virtual ReferencePtr changeLocatorCacheTimeout(int) const = 0;
     virtual ReferencePtr changeCacheConnection(bool) const = 0;
     virtual ReferencePtr changePreferSecure(bool) const = 0;
+    virtual ReferencePtr changeCoalesce(bool) const = 0;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const = 0;
 
     virtual ReferencePtr changeTimeout(int) const = 0;
@@ -115,6 +119,16 @@ public:
     //
     virtual void streamWrite(BasicStream*) const;
 
+    //
+    // Marshal the start of a request with this reference: the request
+    // header (unless the header is false, for batch requests), the
+    // identity, the facet, the operation and the operation mode. The
+    // encoded bytes are cached by operation and mode, up to
+    // Ice.RequestHeaderCacheSize entries per reference. With a cache
+    // size of 0, the request is marshaled directly as before.
+    //
+    void writeRequestHeader(BasicStream*, const std::string&, Ice::OperationMode, bool) const;
+
     //
     // Convert the reference to its string form.
     //
@@ -142,6 +156,7 @@ protected:
     Reference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode, bool,
               const Ice::ProtocolVersion&, const Ice::EncodingVersion&);
     Reference(const Reference&);
+    virtual ~Reference();
 
     virtual Ice::Int hashInit() const;
 
@@ -150,6 +165,27 @@ protected:
 
 private:
 
+    //
+    // The cached request headers form a list of immutable entries.
+    // Entries are only added at the head of the list with a
+    // compare-and-swap and are never modified or removed before the
+    // reference is destroyed, so the cache is read without locking.
+    //
+    struct CachedRequestHeader
+    {
+        std::string operation;
+        Ice::OperationMode mode;
+        std::vector<Ice::Byte> bytes; // The identity, facet, operation and mode.
+        const CachedRequestHeader* next;
+        size_t count; // The number of entries in the list starting with this one.
+    };
+
+    //
+    // The request header cache isn't copied by the copy constructor,
+    // the change* methods modify the copy.
+    //
+    mutable const CachedRequestHeader* volatile _requestHeaders;
+
     const InstancePtr _instance;
     const Ice::CommunicatorPtr _communicator;
 
@@ -179,6 +215,7 @@ public:
     virtual bool getCollocationOptimized() const;
     virtual bool getCacheConnection() const;
     virtual bool getPreferSecure() const;
+    virtual bool getCoalesce() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
     virtual std::string getConnectionId() const;
@@ -190,6 +227,7 @@ public:
     virtual ReferencePtr changeCollocationOptimized(bool) const;
     virtual ReferencePtr changeCacheConnection(bool) const;
     virtual ReferencePtr changePreferSecure(bool) const;
+    virtual ReferencePtr changeCoalesce(bool) const;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const;
 
@@ -225,7 +263,7 @@ public:
 
     RoutableReference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode,
                       bool, const Ice::ProtocolVersion&, const Ice::EncodingVersion&, const std::vector<EndpointIPtr>&,
-                      const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool, 
+                      const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool, bool,
                       Ice::EndpointSelectionType, int);
 
     virtual std::vector<EndpointIPtr> getEndpoints() const;
@@ -235,6 +273,7 @@ public:
     virtual bool getCollocationOptimized() const;
     virtual bool getCacheConnection() const;
     virtual bool getPreferSecure() const;
+    virtual bool getCoalesce() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
     virtual std::string getConnectionId() const;
@@ -248,6 +287,7 @@ public:
     virtual ReferencePtr changeCollocationOptimized(bool) const;
     virtual ReferencePtr changeCacheConnection(bool) const;
     virtual ReferencePtr changePreferSecure(bool) const;
+    virtual ReferencePtr changeCoalesce(bool) const;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const;
 
@@ -293,6 +333,7 @@ private:
     bool _collocationOptimized;
     bool _cacheConnection;
     bool _preferSecure;
+    bool _coalesce;
     Ice::EndpointSelectionType _endpointSelection;
     int _locatorCacheTimeout;
 
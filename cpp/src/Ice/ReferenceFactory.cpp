@@ -716,7 +716,8 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
         "LocatorCacheTimeout",
         "Locator",
         "Router",
-        "CollocationOptimized"
+        "CollocationOptimized",
+        "Coalesce"
     };
 
     //
@@ -794,6 +795,7 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     bool collocationOptimized = defaultsAndOverrides->defaultCollocationOptimization;
     bool cacheConnection = true;
     bool preferSecure = defaultsAndOverrides->defaultPreferSecure;
+    bool coalesce = false;
     Ice::EndpointSelectionType endpointSelection = defaultsAndOverrides->defaultEndpointSelection;
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
 
@@ -849,6 +851,9 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
         property = propertyPrefix + ".PreferSecure";
         preferSecure = properties->getPropertyAsIntWithDefault(property, preferSecure) > 0;
 
+        property = propertyPrefix + ".Coalesce";
+        coalesce = properties->getPropertyAsIntWithDefault(property, coalesce) > 0;
+
         property = propertyPrefix + ".EndpointSelection";
         if(!properties->getProperty(property).empty())
         {
@@ -891,6 +896,7 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
                                  collocationOptimized,
                                  cacheConnection,
                                  preferSecure,
+                                 coalesce,
                                  endpointSelection,
                                  locatorCacheTimeout);
 }
@@ -21,6 +21,7 @@ RequestHandler::~RequestHandler()
 
 RequestHandler::RequestHandler(const ReferencePtr& reference) : 
     _reference(reference),
-    _response(reference->getMode() == Reference::ModeTwoway)
+    _response(reference->getMode() == Reference::ModeTwoway),
+    _coalesce(_response && reference->getCoalesce())
 {
 }
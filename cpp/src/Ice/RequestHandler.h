@@ -50,6 +50,7 @@ protected:
     RequestHandler(const ReferencePtr&);
     const ReferencePtr _reference;
     const bool _response;
+    const bool _coalesce;
 };
 
 }
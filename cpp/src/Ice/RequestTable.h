@@ -0,0 +1,267 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_REQUEST_TABLE_H
+#define ICE_REQUEST_TABLE_H
+
+#include <Ice/Config.h>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The table of the pending requests of a connection, indexed by
+// request ID. It's an open addressing hash table with linear probing
+// and Robin Hood insertion, stored in a single array. Request IDs are
+// allocated sequentially, so using the low bits of the ID as the slot
+// index puts consecutive requests in consecutive slots and lookups
+// rarely probe more than one slot.
+//
+// Request IDs must be strictly positive, 0 marks an empty slot. The
+// table grows when it's half full and shrinks when it's less than one
+// eighth full.
+//
+template<typename T>
+class RequestTable
+{
+    typedef std::pair<Ice::Int, T> Slot;
+
+public:
+
+    class const_iterator
+    {
+    public:
+
+        const_iterator(const Slot* p, const Slot* end) :
+            _p(p), _end(end)
+        {
+            skip();
+        }
+
+        const Slot& operator*() const
+        {
+            return *_p;
+        }
+
+        const Slot* operator->() const
+        {
+            return _p;
+        }
+
+        const_iterator& operator++()
+        {
+            ++_p;
+            skip();
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return _p == other._p;
+        }
+
+        bool operator!=(const const_iterator& other) const
+        {
+            return _p != other._p;
+        }
+
+    private:
+
+        void skip()
+        {
+            while(_p != _end && _p->first == 0)
+            {
+                ++_p;
+            }
+        }
+
+        const Slot* _p;
+        const Slot* _end;
+    };
+
+    RequestTable() :
+        _slots(MinCapacity),
+        _size(0)
+    {
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(&_slots[0], &_slots[0] + _slots.size());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(&_slots[0] + _slots.size(), &_slots[0] + _slots.size());
+    }
+
+    //
+    // Add a request, the request ID must not be in the table already.
+    //
+    void insert(Ice::Int requestId, const T& value)
+    {
+        assert(requestId > 0);
+        if((_size + 1) * 2 > _slots.size())
+        {
+            resize(_slots.size() * 2);
+        }
+        place(Slot(requestId, value));
+        ++_size;
+    }
+
+    bool contains(Ice::Int requestId) const
+    {
+        return find(requestId) != _slots.size();
+    }
+
+    //
+    // Remove a request and return its value. Returns false if the
+    // request isn't in the table.
+    //
+    bool take(Ice::Int requestId, T& value)
+    {
+        size_t i = find(requestId);
+        if(i == _slots.size())
+        {
+            return false;
+        }
+        value = _slots[i].second;
+        erase(i);
+        return true;
+    }
+
+    bool erase(Ice::Int requestId)
+    {
+        size_t i = find(requestId);
+        if(i == _slots.size())
+        {
+            return false;
+        }
+        erase(i);
+        return true;
+    }
+
+    void clear()
+    {
+        std::vector<Slot>(MinCapacity).swap(_slots);
+        _size = 0;
+    }
+
+private:
+
+    enum { MinCapacity = 16 };
+
+    size_t index(Ice::Int requestId) const
+    {
+        return static_cast<size_t>(requestId) & (_slots.size() - 1);
+    }
+
+    size_t distance(size_t i) const
+    {
+        return (i - index(_slots[i].first)) & (_slots.size() - 1);
+    }
+
+    size_t find(Ice::Int requestId) const
+    {
+        if(requestId <= 0)
+        {
+            return _slots.size();
+        }
+        size_t i = index(requestId);
+        for(size_t d = 0; _slots[i].first != 0 && d <= distance(i); ++d)
+        {
+            if(_slots[i].first == requestId)
+            {
+                return i;
+            }
+            i = (i + 1) & (_slots.size() - 1);
+        }
+        return _slots.size();
+    }
+
+    void place(Slot slot)
+    {
+        //
+        // Robin Hood insertion: an entry takes the slot of any entry
+        // closer to its own home slot. Entries of a probe sequence are
+        // sorted by distance to their home slot, which bounds lookups
+        // and removals even when many consecutive slots are in use.
+        //
+        size_t i = index(slot.first);
+        size_t d = 0;
+        while(_slots[i].first != 0)
+        {
+            size_t other = distance(i);
+            if(other < d)
+            {
+                std::swap(slot, _slots[i]);
+                d = other;
+            }
+            i = (i + 1) & (_slots.size() - 1);
+            ++d;
+        }
+        _slots[i] = slot;
+    }
+
+    void erase(size_t i)
+    {
+        //
+        // Shift back the following entries which aren't in their home
+        // slot, so that lookups never need to skip deleted slots.
+        //
+        size_t j = (i + 1) & (_slots.size() - 1);
+        while(_slots[j].first != 0 && distance(j) != 0)
+        {
+            _slots[i] = _slots[j];
+            i = j;
+            j = (j + 1) & (_slots.size() - 1);
+        }
+        _slots[i] = Slot();
+        --_size;
+
+        if(_slots.size() > MinCapacity && _size * 8 < _slots.size())
+        {
+            resize(_slots.size() / 2);
+        }
+    }
+
+    void resize(size_t capacity)
+    {
+        std::vector<Slot> slots(capacity);
+        _slots.swap(slots);
+        for(typename std::vector<Slot>::const_iterator p = slots.begin(); p != slots.end(); ++p)
+        {
+            if(p->first != 0)
+            {
+                place(*p);
+            }
+        }
+    }
+
+    std::vector<Slot> _slots;
+    size_t _size;
+};
+
+}
+
+#endif
@@ -220,7 +220,7 @@ Selector::getNextHandler(SocketOperation& status, int timeout)
 
 #elif defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
 
-Selector::Selector(const InstancePtr& instance) : _instance(instance)
+Selector::Selector(const InstancePtr& instance) : _instance(instance), _busyPoll(0)
 {
     _events.resize(256);
 #if defined(ICE_USE_EPOLL)
@@ -437,21 +437,25 @@ Selector::updateSelector()
 }
 #endif
 
-void 
-Selector::select(vector<pair<EventHandler*, SocketOperation> >& handlers, int timeout)
+int
+Selector::poll(int timeout)
 {
-    int ret = 0;
+    //
+    // Wait for events, timeout is in milliseconds, 0 returns right
+    // away and -1 waits until there are events.
+    //
     while(true)
     {
 #if defined(ICE_USE_EPOLL)
-        ret = epoll_wait(_queueFd, &_events[0], _events.size(), timeout > 0 ? timeout * 1000 : -1);
+        int ret = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
 #else
         assert(!_events.empty());
-        if(timeout > 0)
+        int ret;
+        if(timeout >= 0)
         {
             struct timespec ts;
-            ts.tv_sec = timeout;
-            ts.tv_nsec = 0;
+            ts.tv_sec = timeout / 1000;
+            ts.tv_nsec = (timeout % 1000) * 1000000;
             ret = kevent(_queueFd, 0, 0, &_events[0], _events.size(), &ts);
         }
         else
@@ -473,7 +477,33 @@ Selector::select(vector<pair<EventHandler*, SocketOperation> >& handlers, int ti
             }
             abort();
         }
-        break;
+        return ret;
+    }
+}
+
+void 
+Selector::select(vector<pair<EventHandler*, SocketOperation> >& handlers, int timeout)
+{
+    int ret = 0;
+
+    //
+    // With busy polling, the selector first spins on non-blocking
+    // polls to avoid the cost of the thread going to sleep and being
+    // woken up by the kernel when events arrive shortly.
+    //
+    if(_busyPoll > 0)
+    {
+        IceUtil::Time end = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::microSeconds(_busyPoll);
+        do
+        {
+            ret = poll(0);
+        }
+        while(ret == 0 && IceUtil::Time::now(IceUtil::Time::Monotonic) < end);
+    }
+
+    if(ret == 0)
+    {
+        ret = poll(timeout > 0 ? timeout * 1000 : -1);
     }
 
     if(ret == 0)
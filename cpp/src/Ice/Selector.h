@@ -148,9 +148,22 @@ public:
 
     void select(std::vector<std::pair<EventHandler*, SocketOperation> >&, int);
 
+    //
+    // Poll without blocking for the given number of microseconds
+    // before blocking in select(), 0 disables busy polling.
+    //
+    void
+    setBusyPoll(int busyPoll)
+    {
+        _busyPoll = busyPoll;
+    }
+
 private:
 
+    int poll(int);
+
     const InstancePtr _instance;
+    int _busyPoll;
 #if defined(ICE_USE_EPOLL)
     std::vector<struct epoll_event> _events;
 #else
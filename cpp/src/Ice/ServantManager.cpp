@@ -12,6 +12,7 @@
 #include <Ice/LocalException.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/Instance.h>
+#include <Ice/HashUtil.h>
 #include <IceUtil/StringUtil.h>
 
 using namespace std;
@@ -27,16 +28,14 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
     
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
 
-    if(p == _servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        p = s.servantMapMap.insert(pair<const Identity, FacetMap>(ident, FacetMap())).first;
     }
     else
     {
@@ -54,8 +53,6 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
         }
     }
 
-    _servantMapMapHint = p;
-
     p->second.insert(pair<const string, ObjectPtr>(facet, object));
 }
 
@@ -92,15 +89,13 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
     
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
+    FacetMap::iterator q;
     
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(p == s.servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -118,15 +113,7 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     if(p->second.empty())
     {
-        if(p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        s.servantMapMap.erase(p);
     }
     return servant;
 }
@@ -167,14 +154,12 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
     
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
     
-    if(p == _servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -183,57 +168,46 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
     }
 
     FacetMap result = p->second;
-
-    if(p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
-
+    s.servantMapMap.erase(p);
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-    
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method is called for each dispatch: only the shard of the
+    // identity is locked to find the servant, the manager mutex is
+    // only locked to find a default servant.
+    //
+    // We don't assert that _instance is set, this method might be
+    // called if the adapter dispatch incoming requests from bidir
+    // connections after the adapter was deactivated.
     //
-    //assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-    
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        const Shard& s = shard(ident);
+        IceUtil::Mutex::Lock sync(s);
+
+        ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
+        if(p != s.servantMapMap.end())
+        {
+            FacetMap::const_iterator q = p->second.find(facet);
+            if(q != p->second.end())
+            {
+                return q->second;
+            }
+        }
     }
-    
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+
+    IceUtil::Mutex::Lock sync(*this);
+
+    DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+    if(p == _defaultServantMap.end())
     {
-        DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+        p = _defaultServantMap.find("");
         if(p == _defaultServantMap.end())
         {
-            p = _defaultServantMap.find("");
-            if(p == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return p->second;
-            }
+            return 0;
         }
         else
         {
@@ -242,8 +216,7 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return p->second;
     }
 }
 
@@ -266,26 +239,17 @@ IceInternal::ServantManager::findDefaultServant(const string& category) const
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-    
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-    
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    const Shard& s = shard(ident);
+    IceUtil::Mutex::Lock sync(s);
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
     
-    if(p == servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
         return p->second;
     }
 }
@@ -293,8 +257,6 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-    
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -303,21 +265,17 @@ IceInternal::ServantManager::hasServant(const Identity& ident) const
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    const Shard& s = shard(ident);
+    IceUtil::Mutex::Lock sync(s);
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
     
-    if(p == servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
         assert(!p->second.empty());
         return true;
     }
@@ -421,7 +379,6 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
       _locatorMapHint(_locatorMap.end())
 {
 }
@@ -439,7 +396,7 @@ IceInternal::ServantManager::~ServantManager()
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    vector<ServantMapMap> servantMapMaps(shardCount);
     map<string, ServantLocatorPtr> locatorMap;
     Ice::LoggerPtr logger;
 
@@ -449,8 +406,11 @@ IceInternal::ServantManager::destroy()
         assert(_instance); // Must not be called after destruction.
         
         logger = _instance->initializationData().logger;
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        for(int i = 0; i < shardCount; ++i)
+        {
+            IceUtil::Mutex::Lock shardSync(_shards[i]);
+            servantMapMaps[i].swap(_shards[i].servantMapMap);
+        }
         
         locatorMap.swap(_locatorMap);
         _locatorMapHint = _locatorMap.end();
@@ -485,6 +445,15 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors). 
     //
-    servantMapMap.clear();
+    servantMapMaps.clear();
     locatorMap.clear();
 }
+
+IceInternal::ServantManager::Shard&
+IceInternal::ServantManager::shard(const Identity& ident) const
+{
+    Int h = 5381;
+    hashAdd(h, ident.name);
+    hashAdd(h, ident.category);
+    return _shards[static_cast<unsigned int>(h) % shardCount];
+}
@@ -60,8 +60,23 @@ private:
     typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
     typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
 
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    //
+    // The servants are spread over shards by identity hash, each shard
+    // with its own mutex, so that concurrent dispatches on different
+    // identities don't serialize on the servant manager mutex and each
+    // lookup searches a smaller map. The manager mutex must be locked
+    // before a shard mutex. Lookups only lock the shard.
+    //
+    enum { shardCount = 32 };
+
+    struct Shard : public IceUtil::Mutex
+    {
+        ServantMapMap servantMapMap;
+    };
+
+    Shard& shard(const Ice::Identity&) const;
+
+    mutable Shard _shards[shardCount];
 
     DefaultServantMap _defaultServantMap;
 
@@ -267,6 +267,102 @@ IceInternal::TcpTransceiver::write(Buffer& buf)
     return true;
 }
 
+bool
+IceInternal::TcpTransceiver::writeBuffers(vector<Buffer*>& buffers)
+{
+#ifdef _WIN32
+    return Transceiver::writeBuffers(buffers);
+#else
+    vector<Buffer*>::iterator first = buffers.begin();
+    while(true)
+    {
+        while(first != buffers.end() && (*first)->i == (*first)->b.end())
+        {
+            ++first;
+        }
+        if(first == buffers.end())
+        {
+            return true;
+        }
+
+        _iov.clear();
+        size_t packetSize = 0;
+        for(vector<Buffer*>::const_iterator p = first; p != buffers.end(); ++p)
+        {
+            struct iovec iov;
+            iov.iov_base = &*(*p)->i;
+            iov.iov_len = static_cast<size_t>((*p)->b.end() - (*p)->i);
+            packetSize += iov.iov_len;
+            _iov.push_back(iov);
+        }
+
+        assert(_fd != INVALID_SOCKET);
+        ssize_t ret = ::writev(_fd, &_iov[0], static_cast<int>(_iov.size()));
+        if(ret == 0)
+        {
+            ConnectionLostException ex(__FILE__, __LINE__);
+            ex.error = 0;
+            throw ex;
+        }
+
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(noBuffers())
+            {
+                //
+                // Let write() reduce the packet size.
+                //
+                vector<Buffer*> remaining(first, buffers.end());
+                return Transceiver::writeBuffers(remaining);
+            }
+
+            if(wouldBlock())
+            {
+                return false;
+            }
+
+            if(connectionLost())
+            {
+                ConnectionLostException ex(__FILE__, __LINE__);
+                ex.error = getSocketErrno();
+                throw ex;
+            }
+            else
+            {
+                SocketException ex(__FILE__, __LINE__);
+                ex.error = getSocketErrno();
+                throw ex;
+            }
+        }
+
+        if(_traceLevels->network >= 3)
+        {
+            Trace out(_logger, _traceLevels->networkCat);
+            out << "sent " << ret << " of " << packetSize << " bytes in " << _iov.size() << " buffers via tcp\n"
+                << toString();
+        }
+
+        if(_stats)
+        {
+            _stats->bytesSent(type(), static_cast<Int>(ret));
+        }
+
+        size_t sent = static_cast<size_t>(ret);
+        for(vector<Buffer*>::const_iterator p = first; sent > 0; ++p)
+        {
+            size_t n = min(sent, static_cast<size_t>((*p)->b.end() - (*p)->i));
+            (*p)->i += n;
+            sent -= n;
+        }
+    }
+#endif
+}
+
 bool
 IceInternal::TcpTransceiver::read(Buffer& buf)
 {
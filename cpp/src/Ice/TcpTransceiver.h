@@ -17,6 +17,10 @@
 #include <Ice/Transceiver.h>
 #include <Ice/Network.h>
 
+#ifndef _WIN32
+#   include <sys/uio.h>
+#endif
+
 namespace IceInternal
 {
 
@@ -45,6 +49,7 @@ public:
     virtual void close();
     virtual bool write(Buffer&);
     virtual bool read(Buffer&);
+    virtual bool writeBuffers(std::vector<Buffer*>&);
 #ifdef ICE_USE_IOCP
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
@@ -76,6 +81,10 @@ private:
     State _state;
     std::string _desc;
 
+#ifndef _WIN32
+    std::vector<struct iovec> _iov;
+#endif
+
 #ifdef ICE_USE_IOCP
     AsyncInfo _read;
     AsyncInfo _write;
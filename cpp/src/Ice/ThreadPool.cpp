@@ -17,6 +17,7 @@
 
 #include <Ice/ThreadPool.h>
 #include <IceUtil/DisableWarnings.h>
+#include <Ice/Affinity.h>
 #include <Ice/EventHandler.h>
 #include <Ice/Network.h>
 #include <Ice/LocalException.h>
@@ -364,10 +365,12 @@ IceInternal::ThreadPoolWorkQueue::postMessage()
 #endif
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout) :
+IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout, int reactor,
+                                    const vector<int>& affinity) :
     _instance(instance),
     _destroyed(false),
     _prefix(prefix),
+    _reactor(reactor),
     _selector(instance),
     _nextThreadId(0),
     _size(0),
@@ -380,12 +383,19 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _serverIdleTime(timeout),
     _threadIdleTime(0),
     _stackSize(0),
+    _pinThreads(false),
+    _numaIncoming(false),
+    _busyPoll(0),
+    _busyPollSocket(0),
+    _nextAffinity(0),
     _inUse(0),
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_WINRT)
     _inUseIO(0),
     _nextHandler(_handlers.end()),
 #endif
-    _promote(true)
+    _promote(true),
+    _nextReactor(0),
+    _idle(false)
 {
     PropertiesPtr properties = _instance->initializationData().properties;
 #ifndef ICE_OS_WINRT
@@ -477,14 +487,140 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
         const_cast<bool&>(_hasPriority) = properties->getProperty("Ice.ThreadPriority") != "";
         const_cast<int&>(_priority) = properties->getPropertyAsInt("Ice.ThreadPriority");
     }
+
+    //
+    // <prefix>.Affinity restricts the threads to a list of CPUs and
+    // <prefix>.PinThreads binds each thread to a single CPU of the
+    // list (or of all the CPUs), in round-robin order. The reactors
+    // created for NUMA nodes use the CPUs of their node instead of
+    // the Affinity property.
+    //
+    vector<int> cpus = affinity;
+    if(cpus.empty())
+    {
+        string value = properties->getProperty(_prefix + ".Affinity");
+        if(!parseCPUList(value, cpus))
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "invalid value for " << _prefix << ".Affinity: `" << value << "'; Affinity ignored";
+            cpus.clear();
+        }
+    }
+    const_cast<bool&>(_pinThreads) = properties->getPropertyAsInt(_prefix + ".PinThreads") > 0;
+#ifndef ICE_OS_WINRT
+    if(_pinThreads && cpus.empty())
+    {
+        for(int i = 0; i < nProcessors; ++i)
+        {
+            cpus.push_back(i);
+        }
+    }
+#endif
+    const_cast<vector<int>&>(_affinity) = cpus;
+
+    //
+    // <prefix>.BusyPoll is the number of microseconds the thread
+    // waiting for events polls the selector before blocking, the
+    // thread uses CPU time while it polls. <prefix>.BusyPollSocket
+    // also sets the SO_BUSY_POLL option of the sockets to let the
+    // kernel poll the network device (Linux only).
+    //
+    int busyPoll = properties->getPropertyAsInt(_prefix + ".BusyPoll");
+    if(busyPoll < 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".BusyPoll < 0; BusyPoll adjusted to 0";
+        busyPoll = 0;
+    }
+#if defined(ICE_USE_EPOLL) || defined(ICE_USE_KQUEUE)
+    const_cast<int&>(_busyPoll) = busyPoll;
+    _selector.setBusyPoll(_busyPoll);
+#else
+    if(busyPoll > 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".BusyPoll isn't supported on this platform; BusyPoll ignored";
+    }
+#endif
+    int busyPollSocket = properties->getPropertyAsInt(_prefix + ".BusyPollSocket");
+    if(busyPollSocket < 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".BusyPollSocket < 0; BusyPollSocket adjusted to 0";
+        busyPollSocket = 0;
+    }
+    const_cast<int&>(_busyPollSocket) = busyPollSocket;
     
+    //
+    // If reactors are enabled, each reactor is a thread pool with its
+    // own selector and threads configured with the <prefix>.Reactor.*
+    // properties. New connections are spread over the reactors (see
+    // reactor()) while this thread pool keeps handling the acceptors
+    // and work items. Reactors can't have reactors.
+    //
+    // With <prefix>.NUMA, there's one reactor per NUMA node and the
+    // threads of each reactor are restricted to the CPUs of its node.
+    //
+    int reactors = 0;
+    vector<vector<int> > nodes;
+    if(_reactor < 0)
+    {
+        reactors = properties->getPropertyAsInt(_prefix + ".Reactors");
+        if(reactors < 0)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".Reactors < 0; Reactors adjusted to 0";
+            reactors = 0;
+        }
+
+        if(properties->getPropertyAsInt(_prefix + ".NUMA") > 0)
+        {
+            nodes = getNUMANodes();
+            if(nodes.empty())
+            {
+                Warning out(_instance->initializationData().logger);
+                out << _prefix << ".NUMA is set but the NUMA topology isn't available; NUMA ignored";
+            }
+            else
+            {
+                reactors = static_cast<int>(nodes.size());
+            }
+        }
+        const_cast<bool&>(_numaIncoming) = !nodes.empty() &&
+            properties->getPropertyAsInt(_prefix + ".NUMAIncoming") > 0;
+    }
+
     _workQueue = new ThreadPoolWorkQueue(_instance, _selector);
 
     if(_instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
-        out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = "
-            << _sizeWarn;
+        out << "creating " << _prefix;
+        if(_reactor >= 0)
+        {
+            out << " (reactor " << _reactor << ")";
+        }
+        out << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = " << _sizeWarn;
+        if(reactors > 0)
+        {
+            out << ", Reactors = " << reactors;
+        }
+        if(!_affinity.empty())
+        {
+            out << ", Affinity = " << cpuListToString(_affinity);
+        }
+        if(_pinThreads)
+        {
+            out << ", PinThreads = 1";
+        }
+        if(_busyPoll > 0)
+        {
+            out << ", BusyPoll = " << _busyPoll;
+        }
+        if(_busyPollSocket > 0)
+        {
+            out << ", BusyPollSocket = " << _busyPollSocket;
+        }
     }
 
     __setNoDelete(true);
@@ -492,7 +628,7 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     {
         for(int i = 0 ; i < _size ; ++i)
         {
-            EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId());
+            EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId(), nextThreadAffinity());
             if(_hasPriority)
             {
                 thread->start(_stackSize, _priority);
@@ -503,6 +639,12 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
             }
             _threads.insert(thread);
         }
+
+        for(int i = 0; i < reactors; ++i)
+        {
+            _reactors.push_back(new ThreadPool(_instance, _prefix + ".Reactor", _serverIdleTime, i,
+                                               nodes.empty() ? vector<int>() : nodes[i]));
+        }
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -536,6 +678,10 @@ IceInternal::ThreadPool::destroy()
     assert(!_destroyed);
     _destroyed = true;
     _workQueue->destroy();
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->destroy();
+    }
 }
 
 void
@@ -546,6 +692,10 @@ IceInternal::ThreadPool::updateObservers()
     {
         (*p)->updateObserver();
     }
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->updateObservers();
+    }
 }
 
 void
@@ -553,6 +703,14 @@ IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 {
     Lock sync(*this);
     assert(!_destroyed);
+    if(_busyPollSocket > 0)
+    {
+        NativeInfoPtr info = handler->getNativeInfo();
+        if(info && info->fd() != INVALID_SOCKET)
+        {
+            setBusyPoll(info->fd(), _busyPollSocket);
+        }
+    }
     _selector.initialize(handler.get());
 }
 
@@ -619,6 +777,11 @@ IceInternal::ThreadPool::joinWithAllThreads()
     _selector.finish(_workQueue.get());
 #endif
     _selector.destroy();
+
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->joinWithAllThreads();
+    }
 }
 
 string
@@ -627,6 +790,82 @@ IceInternal::ThreadPool::prefix() const
     return _prefix;
 }
 
+bool
+IceInternal::ThreadPool::isPoolThread() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    IceUtil::ThreadControl current;
+    for(set<EventHandlerThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        if((*p)->getThreadControl() == current)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+ThreadPoolPtr
+IceInternal::ThreadPool::reactor(SOCKET fd)
+{
+    //
+    // _reactors is immutable after creation, no synchronization is
+    // needed unless we need to pick the next reactor.
+    //
+    if(_reactors.empty())
+    {
+        return this;
+    }
+
+    //
+    // The CPU which received the packets of the connection is usually
+    // on the NUMA node of the network interface, if the interrupts of
+    // the interface are bound to this node.
+    //
+    if(_numaIncoming && fd != INVALID_SOCKET)
+    {
+        int cpu = getIncomingCPU(fd);
+        if(cpu >= 0)
+        {
+            for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+            {
+                if(binary_search((*p)->_affinity.begin(), (*p)->_affinity.end(), cpu))
+                {
+                    return *p;
+                }
+            }
+        }
+    }
+
+    Lock sync(*this);
+    return _reactors[_nextReactor++ % _reactors.size()];
+}
+
+bool
+IceInternal::ThreadPool::idle()
+{
+    Lock sync(*this);
+    return _idle;
+}
+
+bool
+IceInternal::ThreadPool::reactorsIdle()
+{
+    //
+    // Must be called with the thread pool mutex locked. The reactor
+    // selectors wait with the same timeout as this thread pool so the
+    // idle shutdown is at most delayed by another timeout period.
+    //
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        if(!(*p)->idle())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void
 IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
 {
@@ -667,7 +906,11 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             catch(SelectorTimeoutException&)
             {
                 Lock sync(*this);
-                if(!_destroyed && _inUse == 0)
+                if(_reactor >= 0)
+                {
+                    _idle = _inUse == 0; // The parent thread pool checks if all its reactors are idle.
+                }
+                else if(!_destroyed && _inUse == 0 && reactorsIdle())
                 {
                     _workQueue->queue(new ShutdownWorkItem(_instance)); // Select timed-out.
                 }
@@ -685,6 +928,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                     _nextHandler = _handlers.begin();
                     _selector.finishSelect();
                     select = false;
+                    _idle = false;
                 }
                 else if(!current._leader && followerWait(current))
                 {
@@ -824,7 +1068,11 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             catch(const SelectorTimeoutException&)
             {
                 Lock sync(*this);
-                if(!_destroyed)
+                if(_reactor >= 0)
+                {
+                    _idle = _inUse == 0; // The parent thread pool checks if all its reactors are idle.
+                }
+                else if(!_destroyed && reactorsIdle())
                 {
                     _workQueue->queue(new ShutdownWorkItem(_instance));
                 }
@@ -835,6 +1083,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
         {
             IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
             thread->setState(ThreadStateInUseForIO);
+            _idle = false;
         }
 
         try
@@ -933,7 +1182,8 @@ IceInternal::ThreadPool::ioCompleted(ThreadPoolCurrent& current)
             
                 try
                 {
-                    EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId());
+                    EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId(),
+                                                                          nextThreadAffinity());
                     if(_hasPriority)
                     {
                         thread->start(_stackSize, _priority);
@@ -1108,17 +1358,35 @@ IceInternal::ThreadPool::followerWait(ThreadPoolCurrent& current)
 }
 #endif
 
+vector<int>
+IceInternal::ThreadPool::nextThreadAffinity()
+{
+    // Must be called with the thread pool mutex locked or from the constructor.
+    if(!_pinThreads || _affinity.empty())
+    {
+        return _affinity;
+    }
+    return vector<int>(1, _affinity[_nextAffinity++ % _affinity.size()]);
+}
+
 string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++; 
+    os << _prefix << "-";
+    if(_reactor >= 0)
+    {
+        os << _reactor << "-";
+    }
+    os << _nextThreadId++; 
     return os.str();
 }
 
-IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPoolPtr& pool, const string& name) :
+IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPoolPtr& pool, const string& name,
+                                                                const vector<int>& affinity) :
     IceUtil::Thread(name),
     _pool(pool),
+    _affinity(affinity),
     _state(Ice::Instrumentation::ThreadStateIdle)
 {
     updateObserver();
@@ -1152,6 +1420,20 @@ IceInternal::ThreadPool::EventHandlerThread::setState(Ice::Instrumentation::Thre
 void
 IceInternal::ThreadPool::EventHandlerThread::run()
 {
+    if(!_affinity.empty())
+    {
+        try
+        {
+            setThreadAffinity(_affinity);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            Warning out(_pool->_instance->initializationData().logger);
+            out << "couldn't set the CPU affinity of thread `" << name() << "' to " << cpuListToString(_affinity)
+                << ":\n" << ex;
+        }
+    }
+
     if(_pool->_instance->initializationData().threadHook)
     {
         try
@@ -43,7 +43,7 @@ class ThreadPool : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mute
     {
     public:
         
-        EventHandlerThread(const ThreadPoolPtr&, const std::string&);
+        EventHandlerThread(const ThreadPoolPtr&, const std::string&, const std::vector<int>&);
         virtual void run();
 
         void updateObserver();
@@ -52,6 +52,7 @@ class ThreadPool : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mute
     private:
 
         ThreadPoolPtr _pool;
+        const std::vector<int> _affinity; // The CPUs of the thread, all CPUs if empty.
         ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
         Ice::Instrumentation::ThreadState _state;
     };
@@ -59,7 +60,7 @@ class ThreadPool : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mute
 
 public:
 
-    ThreadPool(const InstancePtr&, const std::string&, int);
+    ThreadPool(const InstancePtr&, const std::string&, int, int = -1, const std::vector<int>& = std::vector<int>());
     virtual ~ThreadPool();
 
     void destroy();
@@ -83,10 +84,30 @@ public:
 
     std::string prefix() const;
 
+    //
+    // Returns true if the calling thread is a thread of this thread
+    // pool. Such a thread can't wait for an event handled by this
+    // thread pool: all the threads of the thread pool might be
+    // waiting.
+    //
+    bool isPoolThread() const;
+
+    //
+    // Returns the thread pool which should be used to register a new
+    // event handler: the next reactor in round-robin order if
+    // reactors are enabled, this thread pool otherwise. The socket of
+    // an incoming connection can be given to pick the reactor of the
+    // NUMA node which received the connection (see NUMAIncoming).
+    //
+    ThreadPoolPtr reactor(SOCKET = INVALID_SOCKET);
+
 private:
 
     void run(const EventHandlerThreadPtr&);
 
+    bool idle();
+    bool reactorsIdle();
+
     bool ioCompleted(ThreadPoolCurrent&);
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
@@ -98,11 +119,13 @@ private:
 #endif
 
     std::string nextThreadId();
+    std::vector<int> nextThreadAffinity();
 
     const InstancePtr _instance;
     ThreadPoolWorkQueuePtr _workQueue;
     bool _destroyed;
     const std::string _prefix;
+    const int _reactor; // The index of this reactor in its parent thread pool, -1 if this isn't a reactor.
     Selector _selector;
     int _nextThreadId;
 
@@ -119,6 +142,12 @@ private:
     const int _serverIdleTime;
     const int _threadIdleTime;
     const size_t _stackSize;
+    const std::vector<int> _affinity; // The CPUs of the threads, sorted, all CPUs if empty.
+    const bool _pinThreads; // True if each thread is bound to a single CPU of _affinity.
+    const bool _numaIncoming; // True if incoming connections use the reactor of their NUMA node.
+    const int _busyPoll; // Microseconds spent polling before blocking in select().
+    const int _busyPollSocket; // SO_BUSY_POLL value of the sockets, in microseconds.
+    size_t _nextAffinity;
 
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
     int _inUse; // Number of threads that are currently in use.
@@ -129,6 +158,10 @@ private:
 #endif
 
     bool _promote;
+
+    std::vector<ThreadPoolPtr> _reactors; // Immutable after creation.
+    size_t _nextReactor;
+    bool _idle; // True if the reactor selector timed out without events and no threads are in use.
 };
 
 class ThreadPoolCurrent
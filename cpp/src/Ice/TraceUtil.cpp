@@ -174,7 +174,15 @@ printHeader(ostream& s, BasicStream& stream)
 
         default:
         {
-            s << "(unknown)";
+            if(compress & compressionCodecRequest)
+            {
+                s << "(not compressed; compress response with codec "
+                  << static_cast<int>(compress & ~compressionCodecRequest) << ", if any)";
+            }
+            else
+            {
+                s << "(compressed with codec " << static_cast<int>(compress) << "; compress response, if any)";
+            }
             break;
         }
     }
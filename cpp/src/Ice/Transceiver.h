@@ -29,6 +29,22 @@ public:
     virtual void close() = 0;
     virtual bool write(Buffer&) = 0;
     virtual bool read(Buffer&) = 0;
+
+    //
+    // Write the given buffers in order, returns false if the write
+    // would block before all the buffers are written. The default
+    // implementation calls write() for each buffer, transceivers which
+    // support gather writes should override it.
+    //
+    virtual bool writeBuffers(std::vector<Buffer*>&);
+
+    //
+    // Returns true if the transceiver read data from the socket which
+    // wasn't returned by read() yet. The thread pool doesn't report
+    // the socket as readable for such data, the caller must read it
+    // before waiting for the next read event.
+    //
+    virtual bool hasBufferedData() const;
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
     virtual bool startWrite(Buffer&) = 0;
     virtual void finishWrite(Buffer&) = 0;
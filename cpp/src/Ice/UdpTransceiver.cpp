@@ -149,6 +149,9 @@ IceInternal::UdpTransceiver::close()
     assert(_fd != INVALID_SOCKET);
     closeSocket(_fd);
     _fd = INVALID_SOCKET;
+#ifdef ICE_USE_MMSG
+    _readCount = _readNext = 0;
+#endif
 }
 
 
@@ -255,6 +258,49 @@ IceInternal::UdpTransceiver::read(Buffer& buf)
     assert(_fd != INVALID_SOCKET);
 
     const int packetSize = min(_maxPacketSize, _rcvSize - _udpOverhead);
+
+#   ifdef ICE_USE_MMSG
+    //
+    // Return the next datagram of the batch read by recvmmsg(), or
+    // read a new batch. An incoming transceiver which must connect to
+    // its first peer reads the first datagram with recvfrom(), other
+    // peers could send datagrams before the socket is connected.
+    //
+    if(_readNext < _readCount || (_batchSize > 1 && _state != StateNeedConnect))
+    {
+        if(_readNext == _readCount && !readBatch(packetSize))
+        {
+            return false;
+        }
+
+        const size_t size = _readMsgs[_readNext].msg_len;
+        buf.b.resize(size);
+        if(size > 0)
+        {
+            memcpy(&buf.b[0], _readIov[_readNext].iov_base, size);
+        }
+        if(_state == StateNotConnected)
+        {
+            _peerAddr = _readAddrs[_readNext];
+        }
+        ++_readNext;
+
+        if(_traceLevels->network >= 3)
+        {
+            Trace out(_logger, _traceLevels->networkCat);
+            out << "received " << size << " bytes via udp\n" << toString();
+        }
+
+        if(_stats)
+        {
+            _stats->bytesReceived(type(), static_cast<Int>(size));
+        }
+
+        buf.i = buf.b.end();
+        return true;
+    }
+#   endif
+
     buf.b.resize(packetSize);
     buf.i = buf.b.begin();
 
@@ -357,6 +403,174 @@ repeat:
 }
 #endif
 
+#ifdef ICE_USE_MMSG
+bool
+IceInternal::UdpTransceiver::writeBuffers(vector<Buffer*>& buffers)
+{
+    //
+    // Datagrams sent to the last peer of an unconnected socket are
+    // rare (validation and close connection messages), they are sent
+    // one by one.
+    //
+    if(_batchSize <= 1 || _state != StateConnected)
+    {
+        return Transceiver::writeBuffers(buffers);
+    }
+
+    assert(_fd != INVALID_SOCKET);
+    vector<Buffer*>::iterator first = buffers.begin();
+    while(true)
+    {
+        while(first != buffers.end() && (*first)->i == (*first)->b.end())
+        {
+            ++first;
+        }
+        if(first == buffers.end())
+        {
+            return true;
+        }
+
+        //
+        // Each buffer is sent as a datagram. The iovec vector is filled
+        // before the headers since they point to its elements.
+        //
+        _writeIov.clear();
+        for(vector<Buffer*>::const_iterator p = first; 
+            p != buffers.end() && _writeIov.size() < static_cast<size_t>(_batchSize); ++p)
+        {
+            assert((*p)->i == (*p)->b.begin());
+
+            // The caller is supposed to check the send size before by calling checkSendSize
+            assert(min(_maxPacketSize, _sndSize - _udpOverhead) >= static_cast<int>((*p)->b.size()));
+
+            struct iovec iov;
+            iov.iov_base = &*(*p)->i;
+            iov.iov_len = (*p)->b.size();
+            _writeIov.push_back(iov);
+        }
+        _writeMsgs.resize(_writeIov.size());
+        for(size_t i = 0; i < _writeIov.size(); ++i)
+        {
+            memset(&_writeMsgs[i], 0, sizeof(struct mmsghdr));
+            _writeMsgs[i].msg_hdr.msg_iov = &_writeIov[i];
+            _writeMsgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int ret = ::sendmmsg(_fd, &_writeMsgs[0], static_cast<unsigned int>(_writeMsgs.size()), 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return false;
+            }
+
+            SocketException ex(__FILE__, __LINE__);
+            ex.error = getSocketErrno();
+            throw ex;
+        }
+
+        for(int i = 0; i < ret; ++i, ++first)
+        {
+            if(_traceLevels->network >= 3)
+            {
+                Trace out(_logger, _traceLevels->networkCat);
+                out << "sent " << _writeMsgs[i].msg_len << " bytes via udp\n" << toString();
+            }
+
+            if(_stats)
+            {
+                _stats->bytesSent(type(), static_cast<Int>(_writeMsgs[i].msg_len));
+            }
+
+            assert(_writeMsgs[i].msg_len == (*first)->b.size());
+            (*first)->i = (*first)->b.end();
+        }
+    }
+}
+
+bool
+IceInternal::UdpTransceiver::hasBufferedData() const
+{
+    return _readNext < _readCount;
+}
+
+bool
+IceInternal::UdpTransceiver::readBatch(int packetSize)
+{
+    assert(_readNext == _readCount);
+
+    //
+    // The slots are allocated on the first read, outgoing connections
+    // usually never read anything.
+    //
+    if(_readData.size() != static_cast<size_t>(packetSize) * _batchSize)
+    {
+        _readData.resize(static_cast<size_t>(packetSize) * _batchSize);
+        _readMsgs.resize(_batchSize);
+        _readIov.resize(_batchSize);
+        _readAddrs.resize(_batchSize);
+    }
+
+    for(int i = 0; i < _batchSize; ++i)
+    {
+        _readIov[i].iov_base = &_readData[static_cast<size_t>(i) * packetSize];
+        _readIov[i].iov_len = packetSize;
+        memset(&_readMsgs[i], 0, sizeof(struct mmsghdr));
+        _readMsgs[i].msg_hdr.msg_iov = &_readIov[i];
+        _readMsgs[i].msg_hdr.msg_iovlen = 1;
+        if(_state == StateNotConnected)
+        {
+            _readMsgs[i].msg_hdr.msg_name = &_readAddrs[i].saStorage;
+            _readMsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sizeof(sockaddr_storage));
+        }
+    }
+
+repeat:
+
+    //
+    // A truncated datagram fills its slot, this is detected at the
+    // connection level when the Ice message size is checked against
+    // the buffer size.
+    //
+    int ret = ::recvmmsg(_fd, &_readMsgs[0], static_cast<unsigned int>(_batchSize), 0, 0);
+    if(ret == SOCKET_ERROR)
+    {
+        if(interrupted())
+        {
+            goto repeat;
+        }
+
+        if(wouldBlock())
+        {
+            return false;
+        }
+
+        if(connectionLost())
+        {
+            ConnectionLostException ex(__FILE__, __LINE__);
+            ex.error = getSocketErrno();
+            throw ex;
+        }
+        else
+        {
+            SocketException ex(__FILE__, __LINE__);
+            ex.error = getSocketErrno();
+            throw ex;
+        }
+    }
+
+    assert(ret > 0);
+    _readCount = ret;
+    _readNext = 0;
+    return true;
+}
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
 bool
 IceInternal::UdpTransceiver::startWrite(Buffer& buf)
@@ -896,7 +1110,12 @@ IceInternal::UdpTransceiver::UdpTransceiver(const InstancePtr& instance,
     _incoming(false),
     _addr(addr),
     _state(StateNeedConnect)
-#if defined(ICE_USE_IOCP)
+#if defined(ICE_USE_MMSG)
+    , _batchSize(max(1, instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.UDP.BatchSize", 
+                                                                                               16))),
+    _readCount(0),
+    _readNext(0)
+#elif defined(ICE_USE_IOCP)
     , _read(SocketOperationRead), 
     _write(SocketOperationWrite)
 #elif defined(ICE_OS_WINRT)
@@ -967,7 +1186,12 @@ IceInternal::UdpTransceiver::UdpTransceiver(const InstancePtr& instance, const s
     _incoming(true),
     _addr(getAddressForServer(host, port, instance->protocolSupport(), instance->preferIPv6())),
     _state(connect ? StateNeedConnect : StateNotConnected)
-#ifdef ICE_OS_WINRT
+#if defined(ICE_USE_MMSG)
+    , _batchSize(max(1, instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.UDP.BatchSize", 
+                                                                                               16))),
+    _readCount(0),
+    _readNext(0)
+#elif defined(ICE_OS_WINRT)
     , _readPending(false)
 #elif defined(ICE_USE_IOCP)
     , _read(SocketOperationRead), 
@@ -23,6 +23,15 @@
 #   include <deque>
 #endif
 
+//
+// Use recvmmsg() and sendmmsg() to read and write several datagrams
+// with a single system call.
+//
+#if defined(__linux) && !defined(ICE_NO_MMSG)
+#   define ICE_USE_MMSG
+#   include <sys/uio.h>
+#endif
+
 namespace IceInternal
 {
 
@@ -51,6 +60,10 @@ public:
     virtual void close();
     virtual bool write(Buffer&);
     virtual bool read(Buffer&);
+#ifdef ICE_USE_MMSG
+    virtual bool writeBuffers(std::vector<Buffer*>&);
+    virtual bool hasBufferedData() const;
+#endif
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
@@ -72,6 +85,9 @@ private:
     virtual ~UdpTransceiver();
 
     void setBufSize(const InstancePtr&);
+#ifdef ICE_USE_MMSG
+    bool readBatch(int);
+#endif
 
 #ifdef ICE_OS_WINRT
     bool checkIfErrorOrCompleted(SocketOperation, Windows::Foundation::IAsyncInfo^);
@@ -97,6 +113,25 @@ private:
     static const int _udpOverhead;
     static const int _maxPacketSize;
 
+#ifdef ICE_USE_MMSG
+    const int _batchSize;
+
+    //
+    // The datagrams read by the last recvmmsg() call, each in its own
+    // packet-sized slot of _readData. _readNext is the next datagram
+    // returned by read().
+    //
+    std::vector<Ice::Byte> _readData;
+    std::vector<struct mmsghdr> _readMsgs;
+    std::vector<struct iovec> _readIov;
+    std::vector<Address> _readAddrs;
+    int _readCount;
+    int _readNext;
+
+    std::vector<struct mmsghdr> _writeMsgs;
+    std::vector<struct iovec> _writeIov;
+#endif
+
 #if defined(ICE_USE_IOCP)
     AsyncInfo _read;
     AsyncInfo _write;
@@ -0,0 +1,400 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceStorm/EventFilter.h>
+
+#include <cctype>
+#include <cstring>
+#include <sstream>
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+
+//
+// The operands of a chain of && or || operators are kept in a single
+// node, a long chain doesn't nest the evaluation.
+//
+class AndFilter : public EventFilter
+{
+public:
+
+    AndFilter(const vector<EventFilterPtr>& filters) :
+        _filters(filters)
+    {
+    }
+
+    virtual bool
+    match(const EventData& event) const
+    {
+        for(vector<EventFilterPtr>::const_iterator p = _filters.begin(); p != _filters.end(); ++p)
+        {
+            if(!(*p)->match(event))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+
+    const vector<EventFilterPtr> _filters;
+};
+
+class OrFilter : public EventFilter
+{
+public:
+
+    OrFilter(const vector<EventFilterPtr>& filters) :
+        _filters(filters)
+    {
+    }
+
+    virtual bool
+    match(const EventData& event) const
+    {
+        for(vector<EventFilterPtr>::const_iterator p = _filters.begin(); p != _filters.end(); ++p)
+        {
+            if((*p)->match(event))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+
+    const vector<EventFilterPtr> _filters;
+};
+
+class NotFilter : public EventFilter
+{
+public:
+
+    NotFilter(const EventFilterPtr& filter) :
+        _filter(filter)
+    {
+    }
+
+    virtual bool
+    match(const EventData& event) const
+    {
+        return !_filter->match(event);
+    }
+
+private:
+
+    const EventFilterPtr _filter;
+};
+
+class OperationFilter : public EventFilter
+{
+public:
+
+    OperationFilter(const string& value, bool equal) :
+        _value(value), _equal(equal)
+    {
+    }
+
+    virtual bool
+    match(const EventData& event) const
+    {
+        return (event.op == _value) == _equal;
+    }
+
+private:
+
+    const string _value;
+    const bool _equal;
+};
+
+//
+// Compare the value of a context entry, an entry which isn't set
+// never compares equal.
+//
+class ContextFilter : public EventFilter
+{
+public:
+
+    ContextFilter(const string& key, const string& value, bool equal) :
+        _key(key), _value(value), _equal(equal)
+    {
+    }
+
+    virtual bool
+    match(const EventData& event) const
+    {
+        Ice::Context::const_iterator p = event.context.find(_key);
+        return (p != event.context.end() && p->second == _value) == _equal;
+    }
+
+private:
+
+    const string _key;
+    const string _value;
+    const bool _equal;
+};
+
+class ContextSetFilter : public EventFilter
+{
+public:
+
+    ContextSetFilter(const string& key) :
+        _key(key)
+    {
+    }
+
+    virtual bool
+    match(const EventData& event) const
+    {
+        return event.context.find(_key) != event.context.end();
+    }
+
+private:
+
+    const string _key;
+};
+
+//
+// A recursive descent parser for the filter expressions:
+//
+// expr := and ('||' and)*
+// and := unary ('&&' unary)*
+// unary := '!' unary | '(' expr ')' | 'op' cmp string | ctx (cmp string)?
+// ctx := 'ctx' '[' string ']'
+// cmp := '==' | '!='
+//
+// The parenthesis and ! operators can't be nested more than maxDepth
+// levels, this bounds the recursion of the parser and of the
+// evaluation of the filter.
+//
+const int maxDepth = 100;
+
+class Parser
+{
+public:
+
+    Parser(const string& expr) :
+        _expr(expr), _pos(0), _depth(0)
+    {
+    }
+
+    EventFilterPtr
+    parse()
+    {
+        EventFilterPtr filter = parseOr();
+        skipWhitespace();
+        if(_pos != _expr.size())
+        {
+            error("unexpected `" + _expr.substr(_pos) + "'");
+        }
+        return filter;
+    }
+
+private:
+
+    EventFilterPtr
+    parseOr()
+    {
+        vector<EventFilterPtr> filters;
+        filters.push_back(parseAnd());
+        while(accept("||"))
+        {
+            filters.push_back(parseAnd());
+        }
+        return filters.size() == 1 ? filters.front() : new OrFilter(filters);
+    }
+
+    EventFilterPtr
+    parseAnd()
+    {
+        vector<EventFilterPtr> filters;
+        filters.push_back(parseUnary());
+        while(accept("&&"))
+        {
+            filters.push_back(parseUnary());
+        }
+        return filters.size() == 1 ? filters.front() : new AndFilter(filters);
+    }
+
+    EventFilterPtr
+    parseUnary()
+    {
+        if(accept("!="))
+        {
+            error("unexpected `!='");
+        }
+        if(accept("!"))
+        {
+            enter();
+            EventFilterPtr filter = new NotFilter(parseUnary());
+            --_depth;
+            return filter;
+        }
+        if(accept("("))
+        {
+            enter();
+            EventFilterPtr filter = parseOr();
+            expect(")");
+            --_depth;
+            return filter;
+        }
+
+        string name = parseIdentifier();
+        if(name == "op")
+        {
+            bool equal = parseComparison();
+            return new OperationFilter(parseString(), equal);
+        }
+        else if(name == "ctx")
+        {
+            expect("[");
+            string key = parseString();
+            expect("]");
+            if(lookahead("==") || lookahead("!="))
+            {
+                bool equal = parseComparison();
+                return new ContextFilter(key, parseString(), equal);
+            }
+            return new ContextSetFilter(key);
+        }
+        else if(name.empty())
+        {
+            error(_pos < _expr.size() ? "unexpected `" + _expr.substr(_pos) + "'" : "unexpected end of expression");
+        }
+        else
+        {
+            error("unknown identifier `" + name + "', expected `op' or `ctx'");
+        }
+        return 0; // Keep the compiler happy.
+    }
+
+    bool
+    parseComparison()
+    {
+        if(accept("=="))
+        {
+            return true;
+        }
+        if(accept("!="))
+        {
+            return false;
+        }
+        error("expected `==' or `!='");
+        return false; // Keep the compiler happy.
+    }
+
+    string
+    parseIdentifier()
+    {
+        skipWhitespace();
+        string::size_type start = _pos;
+        while(_pos < _expr.size() && (isalnum(static_cast<unsigned char>(_expr[_pos])) || _expr[_pos] == '_'))
+        {
+            ++_pos;
+        }
+        return _expr.substr(start, _pos - start);
+    }
+
+    string
+    parseString()
+    {
+        skipWhitespace();
+        if(_pos == _expr.size() || (_expr[_pos] != '\'' && _expr[_pos] != '"'))
+        {
+            error("expected a quoted string");
+        }
+
+        char quote = _expr[_pos++];
+        string value;
+        while(_pos < _expr.size() && _expr[_pos] != quote)
+        {
+            if(_expr[_pos] == '\\' && _pos + 1 < _expr.size())
+            {
+                ++_pos;
+            }
+            value += _expr[_pos++];
+        }
+        if(_pos == _expr.size())
+        {
+            error("unterminated string");
+        }
+        ++_pos;
+        return value;
+    }
+
+    bool
+    lookahead(const char* token)
+    {
+        skipWhitespace();
+        return _expr.compare(_pos, strlen(token), token) == 0;
+    }
+
+    bool
+    accept(const char* token)
+    {
+        if(lookahead(token))
+        {
+            _pos += strlen(token);
+            return true;
+        }
+        return false;
+    }
+
+    void
+    expect(const char* token)
+    {
+        if(!accept(token))
+        {
+            error(string("expected `") + token + "'");
+        }
+    }
+
+    void
+    enter()
+    {
+        if(++_depth > maxDepth)
+        {
+            ostringstream os;
+            os << "expression nested more than " << maxDepth << " levels";
+            error(os.str());
+        }
+    }
+
+    void
+    skipWhitespace()
+    {
+        while(_pos < _expr.size() && isspace(static_cast<unsigned char>(_expr[_pos])))
+        {
+            ++_pos;
+        }
+    }
+
+    void
+    error(const string& reason)
+    {
+        throw BadQoS("invalid filter `" + _expr + "': " + reason);
+    }
+
+    const string _expr;
+    string::size_type _pos;
+    int _depth; // The nesting level of parenthesis and ! operators.
+};
+
+}
+
+EventFilterPtr
+EventFilter::compile(const string& expr)
+{
+    return Parser(expr).parse();
+}
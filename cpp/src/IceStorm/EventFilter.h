@@ -0,0 +1,50 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef EVENT_FILTER_H
+#define EVENT_FILTER_H
+
+#include <IceStorm/IceStormInternal.h>
+
+namespace IceStorm
+{
+
+class EventFilter;
+typedef IceUtil::Handle<EventFilter> EventFilterPtr;
+
+//
+// The filter of a subscriber, set with the "filter" QoS. A filter is
+// a boolean expression on the operation name and the request context
+// of the events, for example:
+//
+// op == 'tick' && (ctx['symbol'] == 'ZRC' || ctx['symbol'] == 'ICE')
+//
+// The expression can use the operation name (op), the value of a
+// context entry (ctx['key']), string literals in single or double
+// quotes, the == and != comparisons, the &&, || and ! operators and
+// parenthesis. A context entry used outside a comparison tests
+// whether the entry is set. Parenthesis and ! operators can be nested
+// up to 100 levels.
+//
+class EventFilter : public IceUtil::Shared
+{
+public:
+
+    //
+    // Compile a filter expression, raises BadQoS if the expression
+    // is invalid.
+    //
+    static EventFilterPtr compile(const std::string&);
+
+    virtual bool match(const EventData&) const = 0;
+};
+
+} // End namespace IceStorm
+
+#endif
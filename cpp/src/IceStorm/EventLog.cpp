@@ -0,0 +1,748 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceStorm/EventLog.h>
+#include <IceStorm/TraceLevels.h>
+#include <IceStorm/Util.h>
+#include <IceUtil/FileUtil.h>
+#include <Ice/Communicator.h>
+#include <Ice/LocalException.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Stream.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+using namespace IceStorm;
+
+const string EventLog::sequenceKey = "IceStorm.Sequence";
+
+namespace
+{
+
+//
+// A segment file starts with a header holding the magic number, the
+// version of the file format and the sequence number of its first
+// event. Each event is stored in a record made of:
+//
+// - the size of the encoded event (the end of the records is marked
+//   with a zero size)
+// - the checksum of the remainder of the record
+// - the sequence number of the event
+// - the time the event was appended in milliseconds
+// - the encoded event: operation, mode, context and data
+//
+// The sizes and numbers are stored in little endian. The file is
+// allocated with the size of a segment when it's created and the size
+// of a record is written last, a record torn by a crash is ignored and
+// overwritten by the next event when the log is opened again.
+//
+const Ice::Byte segmentMagic[] = { 0x49, 0x53, 0x4c, 0x47 }; // 'I', 'S', 'L', 'G'
+const Ice::Int segmentVersion = 1;
+const size_t segmentHeaderSize = 16;
+const size_t recordHeaderSize = 24;
+const char* segmentSuffix = ".log";
+
+void
+writeInt(Ice::Byte* p, Ice::Int v)
+{
+    for(int i = 0; i < 4; ++i)
+    {
+        p[i] = static_cast<Ice::Byte>(v >> (i * 8));
+    }
+}
+
+Ice::Int
+readInt(const Ice::Byte* p)
+{
+    unsigned int v = 0;
+    for(int i = 3; i >= 0; --i)
+    {
+        v = (v << 8) | p[i];
+    }
+    return static_cast<Ice::Int>(v);
+}
+
+void
+writeLong(Ice::Byte* p, Ice::Long v)
+{
+    for(int i = 0; i < 8; ++i)
+    {
+        p[i] = static_cast<Ice::Byte>(v >> (i * 8));
+    }
+}
+
+Ice::Long
+readLong(const Ice::Byte* p)
+{
+    unsigned long long v = 0;
+    for(int i = 7; i >= 0; --i)
+    {
+        v = (v << 8) | p[i];
+    }
+    return static_cast<Ice::Long>(v);
+}
+
+Ice::Int
+checksum(const Ice::Byte* p, size_t sz)
+{
+    unsigned int h = 2166136261U;
+    for(const Ice::Byte* q = p; q != p + sz; ++q)
+    {
+        h = (h ^ *q) * 16777619U;
+    }
+    return static_cast<Ice::Int>(h);
+}
+
+//
+// Allocate the disk space of a new file, returns 0 or the error
+// number. The disk space of a segment must be allocated before it's
+// mapped: writing to the mapping of a sparse file raises SIGBUS when
+// the disk is full.
+//
+int
+allocateFile(int fd, size_t size)
+{
+#if defined(__APPLE__)
+    fstore_t store = { F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<off_t>(size), 0 };
+    if(fcntl(fd, F_PREALLOCATE, &store) == -1)
+    {
+        return errno;
+    }
+    return ftruncate(fd, static_cast<off_t>(size)) == 0 ? 0 : errno;
+#else
+    return posix_fallocate(fd, 0, static_cast<off_t>(size));
+#endif
+}
+
+void
+throwFileException(const char* file, int line, const string& path)
+{
+    Ice::FileException ex(file, line);
+    ex.error = errno;
+    ex.path = path;
+    throw ex;
+}
+
+//
+// Topic names can contain characters which aren't valid in file
+// names, all the characters except letters, digits, '.', '-' and '_'
+// are escaped with their hexadecimal value.
+//
+string
+topicDirectory(const string& directory, const string& topic)
+{
+    ostringstream os;
+    os << directory << '/';
+    for(string::const_iterator p = topic.begin(); p != topic.end(); ++p)
+    {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if(isalnum(c) || c == '.' || c == '-' || c == '_')
+        {
+            os << *p;
+        }
+        else
+        {
+            os << '%' << hex << uppercase << setw(2) << setfill('0') << static_cast<int>(c) << dec;
+        }
+    }
+    return os.str();
+}
+
+}
+
+namespace IceStorm
+{
+
+//
+// A segment of the log, mapped in memory while the log is open.
+//
+class EventLogSegment : public IceUtil::Shared
+{
+public:
+
+    //
+    // Create a new segment file.
+    //
+    EventLogSegment(const string& path, Ice::Long first, size_t size) :
+        _path(path),
+        _fd(-1),
+        _base(0),
+        _size(size),
+        _end(segmentHeaderSize),
+        _flushed(0),
+        _first(first),
+        _last(first - 1),
+        _lastTime(0)
+    {
+        _fd = IceUtilInternal::open(_path, O_RDWR | O_CREAT | O_TRUNC);
+        if(_fd < 0)
+        {
+            throwFileException(__FILE__, __LINE__, _path);
+        }
+        int error = allocateFile(_fd, _size);
+        if(error != 0)
+        {
+            IceUtilInternal::close(_fd);
+            IceUtilInternal::unlink(_path);
+            errno = error;
+            throwFileException(__FILE__, __LINE__, _path);
+        }
+        try
+        {
+            mapFile();
+        }
+        catch(const Ice::FileException&)
+        {
+            IceUtilInternal::unlink(_path);
+            throw;
+        }
+
+        memcpy(_base, segmentMagic, sizeof(segmentMagic));
+        writeInt(_base + 4, segmentVersion);
+        writeLong(_base + 8, _first);
+    }
+
+    //
+    // Open an existing segment file and find the end of its records.
+    //
+    EventLogSegment(const string& path) :
+        _path(path),
+        _fd(-1),
+        _base(0),
+        _size(0),
+        _end(segmentHeaderSize),
+        _flushed(0),
+        _first(0),
+        _last(0),
+        _lastTime(0)
+    {
+        _fd = IceUtilInternal::open(_path, O_RDWR);
+        if(_fd < 0)
+        {
+            throwFileException(__FILE__, __LINE__, _path);
+        }
+        struct stat st;
+        if(fstat(_fd, &st) != 0)
+        {
+            int error = errno;
+            IceUtilInternal::close(_fd);
+            errno = error;
+            throwFileException(__FILE__, __LINE__, _path);
+        }
+        _size = static_cast<size_t>(st.st_size);
+        if(_size < segmentHeaderSize)
+        {
+            IceUtilInternal::close(_fd);
+            throw Ice::FileException(__FILE__, __LINE__, 0, _path);
+        }
+        mapFile();
+
+        if(memcmp(_base, segmentMagic, sizeof(segmentMagic)) != 0 || readInt(_base + 4) != segmentVersion)
+        {
+            unmapFile();
+            throw Ice::FileException(__FILE__, __LINE__, 0, _path);
+        }
+        _first = readLong(_base + 8);
+        _last = _first - 1;
+
+        size_t pos = segmentHeaderSize;
+        Ice::Long seq;
+        Ice::Long time;
+        pair<const Ice::Byte*, const Ice::Byte*> event;
+        while(next(pos, seq, time, event) && seq == _last + 1)
+        {
+            _end = pos;
+            _last = seq;
+            _lastTime = time;
+        }
+        _flushed = _end;
+    }
+
+    ~EventLogSegment()
+    {
+        unmapFile();
+    }
+
+    bool
+    append(Ice::Long seq, Ice::Long time, const vector<Ice::Byte>& event)
+    {
+        assert(seq == _last + 1 && !event.empty());
+        if(_size - _end < recordHeaderSize + event.size())
+        {
+            return false;
+        }
+
+        Ice::Byte* p = _base + _end;
+        writeLong(p + 8, seq);
+        writeLong(p + 16, time);
+        memcpy(p + recordHeaderSize, &event[0], event.size());
+        writeInt(p + 4, checksum(p + 8, recordHeaderSize - 8 + event.size()));
+        writeInt(p, static_cast<Ice::Int>(event.size()));
+
+        _end += recordHeaderSize + event.size();
+        _last = seq;
+        _lastTime = time;
+        return true;
+    }
+
+    //
+    // Get the record at the given position and move the position to
+    // the next record. Returns false if there's no valid record at
+    // the given position.
+    //
+    bool
+    next(size_t& pos, Ice::Long& seq, Ice::Long& time, pair<const Ice::Byte*, const Ice::Byte*>& event) const
+    {
+        if(pos + recordHeaderSize > _size)
+        {
+            return false;
+        }
+        const Ice::Byte* p = _base + pos;
+        Ice::Int sz = readInt(p);
+        if(sz <= 0 || static_cast<size_t>(sz) > _size - pos - recordHeaderSize)
+        {
+            return false;
+        }
+        if(readInt(p + 4) != checksum(p + 8, recordHeaderSize - 8 + sz))
+        {
+            return false;
+        }
+        seq = readLong(p + 8);
+        time = readLong(p + 16);
+        event.first = p + recordHeaderSize;
+        event.second = event.first + sz;
+        pos += recordHeaderSize + sz;
+        return true;
+    }
+
+    //
+    // Sync the records appended since the last flush to the file.
+    //
+    void
+    flush()
+    {
+        if(_flushed == _end)
+        {
+            return;
+        }
+        size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t start = _flushed - _flushed % pageSize;
+        if(msync(_base + start, _end - start, MS_SYNC) != 0)
+        {
+            throwFileException(__FILE__, __LINE__, _path);
+        }
+        _flushed = _end;
+    }
+
+    void
+    remove()
+    {
+        unmapFile();
+        IceUtilInternal::unlink(_path);
+    }
+
+    const string& path() const
+    {
+        return _path;
+    }
+
+    Ice::Long first() const
+    {
+        return _first;
+    }
+
+    Ice::Long last() const
+    {
+        return _last;
+    }
+
+    Ice::Long lastTime() const
+    {
+        return _lastTime;
+    }
+
+    //
+    // The number of bytes used by the events of the segment, it
+    // doesn't include the free space of the file.
+    //
+    Ice::Long eventsSize() const
+    {
+        return static_cast<Ice::Long>(_end - segmentHeaderSize);
+    }
+
+    size_t end() const
+    {
+        return _end;
+    }
+
+private:
+
+    void
+    mapFile()
+    {
+        void* base = mmap(0, _size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if(base == MAP_FAILED)
+        {
+            int error = errno;
+            IceUtilInternal::close(_fd);
+            _fd = -1;
+            errno = error;
+            throwFileException(__FILE__, __LINE__, _path);
+        }
+        _base = static_cast<Ice::Byte*>(base);
+    }
+
+    void
+    unmapFile()
+    {
+        if(_base)
+        {
+            munmap(_base, _size);
+            _base = 0;
+        }
+        if(_fd >= 0)
+        {
+            IceUtilInternal::close(_fd);
+            _fd = -1;
+        }
+    }
+
+    const string _path;
+    int _fd;
+    Ice::Byte* _base;
+    size_t _size;
+    size_t _end;
+    size_t _flushed; // The end of the records synced to the file.
+    Ice::Long _first;
+    Ice::Long _last;
+    Ice::Long _lastTime;
+};
+
+}
+
+EventLog::EventLog(const Ice::CommunicatorPtr& communicator,
+                   const TraceLevelsPtr& traceLevels,
+                   const string& directory,
+                   const string& topic,
+                   size_t segmentSize,
+                   Ice::Long retentionSize,
+                   const IceUtil::Time& retentionTime,
+                   int flushEvents) :
+    _communicator(communicator),
+    _traceLevels(traceLevels),
+    _topic(topic),
+    _directory(topicDirectory(directory, topic)),
+    _segmentSize(segmentSize),
+    _retentionSize(retentionSize),
+    _retentionTime(retentionTime),
+    _flushEvents(flushEvents),
+    _size(0),
+    _last(0),
+    _unflushed(0)
+{
+    if(!IceUtilInternal::directoryExists(_directory) && IceUtilInternal::mkdir(_directory, 0777) != 0)
+    {
+        throwFileException(__FILE__, __LINE__, _directory);
+    }
+    open();
+}
+
+EventLog::~EventLog()
+{
+}
+
+Ice::Long
+EventLog::append(const EventDataPtr& event)
+{
+    Lock sync(*this);
+
+    Ice::Long seq = _last + 1;
+
+    //
+    // The logged event has the sequence number in its context, the
+    // context of the event is only updated once the event is
+    // appended.
+    //
+    ostringstream os;
+    os << seq;
+    Ice::Context context = event->context;
+    context[sequenceKey] = os.str();
+
+    Ice::OutputStreamPtr out = Ice::createOutputStream(_communicator, Ice::Encoding_1_1);
+    out->write(event->op);
+    out->write(static_cast<Ice::Byte>(event->mode));
+    out->write(context);
+    out->write(event->data);
+    vector<Ice::Byte> bytes;
+    out->finished(bytes);
+
+    Ice::Long now = IceUtil::Time::now().toMilliSeconds();
+    if(_segments.empty() || !_segments.back()->append(seq, now, bytes))
+    {
+        ostringstream name;
+        name << _directory << '/' << setw(20) << setfill('0') << seq << segmentSuffix;
+        size_t size = max(_segmentSize, segmentHeaderSize + recordHeaderSize + bytes.size());
+        EventLogSegmentPtr segment = new EventLogSegment(name.str(), seq, size);
+        if(!_segments.empty())
+        {
+            flush(_segments.back()); // The previous segment is full.
+        }
+        _segments.push_back(segment);
+        segment->append(seq, now, bytes);
+        _unflushed = 0;
+
+        if(_traceLevels->topic > 0)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->topicCat);
+            out << _topic << ": created log segment `" << segment->path() << "'";
+        }
+    }
+    _size += static_cast<Ice::Long>(recordHeaderSize + bytes.size());
+    _last = seq;
+
+    event->context.swap(context);
+    IceStormInternal::EncodedEventDataPtr encoded = IceStormInternal::EncodedEventDataPtr::dynamicCast(event);
+    if(encoded)
+    {
+        encoded->encode(_communicator);
+    }
+
+    if(_flushEvents > 0 && ++_unflushed >= _flushEvents)
+    {
+        flush(_segments.back());
+        _unflushed = 0;
+    }
+
+    if(_segments.size() > 1 && _segments.back()->first() == seq)
+    {
+        prune();
+    }
+    return seq;
+}
+
+EventDataSeq
+EventLog::read(EventLogCursor& cursor, size_t max) const
+{
+    Lock sync(*this);
+
+    //
+    // Continue in the segment of the cursor if it's still retained,
+    // otherwise find the first segment with events to read.
+    //
+    deque<EventLogSegmentPtr>::const_iterator p = _segments.begin();
+    while(p != _segments.end() && (*p)->first() != cursor._segment)
+    {
+        ++p;
+    }
+    if(p == _segments.end())
+    {
+        p = _segments.begin();
+        while(p != _segments.end() && (*p)->last() < cursor._next)
+        {
+            ++p;
+        }
+        cursor._pos = segmentHeaderSize;
+    }
+
+    EventDataSeq events;
+    for(; p != _segments.end() && events.size() < max; ++p)
+    {
+        if(cursor._segment != (*p)->first())
+        {
+            cursor._segment = (*p)->first();
+            cursor._pos = segmentHeaderSize;
+        }
+
+        Ice::Long seq;
+        Ice::Long time;
+        pair<const Ice::Byte*, const Ice::Byte*> bytes;
+        size_t pos = cursor._pos;
+        while(events.size() < max && pos < (*p)->end() && (*p)->next(pos, seq, time, bytes))
+        {
+            cursor._pos = pos;
+            if(seq < cursor._next)
+            {
+                continue;
+            }
+
+            Ice::InputStreamPtr in = Ice::wrapInputStream(_communicator, bytes, Ice::Encoding_1_1);
+            string op;
+            Ice::Byte mode;
+            Ice::Context context;
+            in->read(op);
+            in->read(mode);
+            in->read(context);
+
+            IceStormInternal::EncodedEventDataPtr event =
+                new IceStormInternal::EncodedEventData(op, static_cast<Ice::OperationMode>(mode), context);
+            in->read(event->data);
+            event->encode(_communicator);
+            events.push_back(event);
+            cursor._next = seq + 1;
+        }
+    }
+    return events;
+}
+
+Ice::Long
+EventLog::first() const
+{
+    Lock sync(*this);
+    return _segments.empty() ? _last + 1 : _segments.front()->first();
+}
+
+Ice::Long
+EventLog::last() const
+{
+    Lock sync(*this);
+    return _last;
+}
+
+void
+EventLog::close()
+{
+    Lock sync(*this);
+    if(!_segments.empty())
+    {
+        flush(_segments.back());
+    }
+    _segments.clear();
+}
+
+void
+EventLog::destroy()
+{
+    Lock sync(*this);
+    for(deque<EventLogSegmentPtr>::const_iterator p = _segments.begin(); p != _segments.end(); ++p)
+    {
+        (*p)->remove();
+    }
+    _segments.clear();
+    _size = 0;
+    IceUtilInternal::rmdir(_directory);
+}
+
+void
+EventLog::open()
+{
+    vector<string> names;
+    DIR* dir = opendir(_directory.c_str());
+    if(dir == 0)
+    {
+        throwFileException(__FILE__, __LINE__, _directory);
+    }
+    struct dirent* entry;
+    while((entry = readdir(dir)) != 0)
+    {
+        string name = entry->d_name;
+        string::size_type sz = strlen(segmentSuffix);
+        if(name.size() > sz && name.compare(name.size() - sz, sz, segmentSuffix) == 0)
+        {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+
+    //
+    // The names of the segments are the zero-padded sequence numbers
+    // of their first event, sorting the names sorts the segments.
+    //
+    sort(names.begin(), names.end());
+    for(vector<string>::const_iterator p = names.begin(); p != names.end(); ++p)
+    {
+        EventLogSegmentPtr segment;
+        try
+        {
+            segment = new EventLogSegment(_directory + '/' + *p);
+        }
+        catch(const Ice::FileException& ex)
+        {
+            Ice::Warning out(_traceLevels->logger);
+            out << _topic << ": ignoring invalid log segment `" << ex.path << "'";
+            continue;
+        }
+
+        if(segment->first() <= _last)
+        {
+            Ice::Warning out(_traceLevels->logger);
+            out << _topic << ": ignoring log segment `" << segment->path() << "' overlapping a previous segment";
+            continue;
+        }
+
+        _segments.push_back(segment);
+        _size += segment->eventsSize();
+        _last = max(_last, segment->last());
+    }
+
+    if(_traceLevels->topic > 0)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->topicCat);
+        out << _topic << ": opened log `" << _directory << "' with " << _segments.size() << " segments, last event "
+            << _last;
+    }
+
+    prune();
+}
+
+void
+EventLog::flush(const EventLogSegmentPtr& segment)
+{
+    //
+    // The events are already appended, a failure to sync them to the
+    // file is only reported.
+    //
+    try
+    {
+        segment->flush();
+    }
+    catch(const Ice::FileException& ex)
+    {
+        Ice::Warning out(_traceLevels->logger);
+        out << _topic << ": failed to flush log segment `" << segment->path() << "':\n" << ex;
+    }
+}
+
+void
+EventLog::prune()
+{
+    Ice::Long now = IceUtil::Time::now().toMilliSeconds();
+    while(_segments.size() > 1)
+    {
+        EventLogSegmentPtr segment = _segments.front();
+        bool expired = _retentionTime > IceUtil::Time() &&
+            segment->lastTime() < now - _retentionTime.toMilliSeconds();
+        if(!expired && (_retentionSize <= 0 || _size <= _retentionSize))
+        {
+            break;
+        }
+
+        if(_traceLevels->topic > 0)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->topicCat);
+            out << _topic << ": removing log segment `" << segment->path() << "'";
+        }
+
+        _size -= segment->eventsSize();
+        segment->remove();
+        _segments.pop_front();
+    }
+}
@@ -0,0 +1,131 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <IceStorm/IceStormInternal.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <deque>
+
+namespace IceStorm
+{
+
+class TraceLevels;
+typedef IceUtil::Handle<TraceLevels> TraceLevelsPtr;
+
+class EventLogSegment;
+typedef IceUtil::Handle<EventLogSegment> EventLogSegmentPtr;
+
+//
+// The position of a reader of the log, see EventLog::read().
+//
+class EventLogCursor
+{
+public:
+
+    EventLogCursor(Ice::Long next = 0) :
+        _next(next),
+        _segment(-1),
+        _pos(0)
+    {
+    }
+
+    //
+    // The sequence number of the next event to read.
+    //
+    Ice::Long next() const
+    {
+        return _next;
+    }
+
+private:
+
+    friend class EventLog;
+
+    Ice::Long _next;
+    Ice::Long _segment; // The first sequence number of the segment of the next event, -1 if unknown.
+    size_t _pos; // The position of the next event in its segment.
+};
+
+//
+// The append-only log of the events published on a durable topic.
+// Events are appended to memory-mapped segment files in the directory
+// of the topic, each segment is named after the sequence number of its
+// first event. A new segment is created when the last one is full,
+// the oldest segments are then removed if the log is larger than its
+// retention size or if their events are older than the retention
+// time.
+//
+// The segment files are allocated when they're created. The mapped
+// memory of a segment is synced to its file when the segment is full,
+// when the log is closed and, unless the number of events between
+// flushes is 0, each time this number of events are appended.
+//
+class EventLog : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    EventLog(const Ice::CommunicatorPtr&, const TraceLevelsPtr&, const std::string&, const std::string&, size_t,
+             Ice::Long, const IceUtil::Time&, int);
+    ~EventLog();
+
+    //
+    // Append an event to the log and return its sequence number. Once
+    // the event is appended, the sequence number is also added to the
+    // context of the event with the sequenceKey key.
+    //
+    Ice::Long append(const EventDataPtr&);
+
+    //
+    // Read up to the given number of events starting at the cursor
+    // and move the cursor after them. The first event returned is the
+    // oldest event still retained if older events were already
+    // removed. Fewer events are returned once the end of the log is
+    // reached.
+    //
+    EventDataSeq read(EventLogCursor&, size_t) const;
+
+    Ice::Long first() const;
+    Ice::Long last() const;
+
+    //
+    // Close the log, destroy() also removes its files.
+    //
+    void close();
+    void destroy();
+
+    static const std::string sequenceKey;
+
+private:
+
+    void open();
+    void flush(const EventLogSegmentPtr&);
+    void prune();
+
+    const Ice::CommunicatorPtr _communicator;
+    const TraceLevelsPtr _traceLevels;
+    const std::string _topic;
+    const std::string _directory;
+    const size_t _segmentSize;
+    const Ice::Long _retentionSize;
+    const IceUtil::Time _retentionTime;
+    const int _flushEvents; // The number of events appended between flushes, 0 to flush full segments only.
+
+    std::deque<EventLogSegmentPtr> _segments;
+    Ice::Long _size; // The size of the events of all the segments.
+    Ice::Long _last; // The sequence number of the last event.
+    int _unflushed; // The number of events appended since the last flush.
+};
+typedef IceUtil::Handle<EventLog> EventLogPtr;
+
+} // End namespace IceStorm
+
+#endif
@@ -0,0 +1,156 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceStorm/EventQueue.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+
+//
+// The initial size of the ring, it grows as needed up to the maximum
+// size of the queue.
+//
+const size_t initialRingSize = 16;
+
+}
+
+EventQueue::EventQueue(size_t maxSize, const string& conflateKey) :
+    _maxSize(maxSize),
+    _conflateKey(conflateKey),
+    _head(0),
+    _size(0),
+    _first(0)
+{
+}
+
+void
+EventQueue::pop_front()
+{
+    assert(_size > 0);
+
+    string value;
+    if(!_conflated.empty() && conflationKey(_ring[_head], value))
+    {
+        map<string, Ice::Long>::iterator p = _conflated.find(value);
+        if(p != _conflated.end() && p->second == _first)
+        {
+            _conflated.erase(p);
+        }
+    }
+
+    _ring[_head] = 0;
+    _head = (_head + 1) % _ring.size();
+    --_size;
+    ++_first;
+}
+
+void
+EventQueue::push_back(const EventDataPtr& event)
+{
+    assert(!full());
+    if(_size == _ring.size())
+    {
+        grow();
+    }
+
+    _ring[(_head + _size) % _ring.size()] = event;
+
+    string value;
+    if(conflationKey(event, value))
+    {
+        _conflated[value] = _first + static_cast<Ice::Long>(_size);
+    }
+    ++_size;
+}
+
+bool
+EventQueue::conflate(const EventDataPtr& event)
+{
+    string value;
+    if(!conflationKey(event, value))
+    {
+        return false;
+    }
+
+    map<string, Ice::Long>::const_iterator p = _conflated.find(value);
+    if(p == _conflated.end())
+    {
+        return false;
+    }
+    assert(p->second >= _first && p->second < _first + static_cast<Ice::Long>(_size));
+    _ring[(_head + static_cast<size_t>(p->second - _first)) % _ring.size()] = event;
+    return true;
+}
+
+void
+EventQueue::clear()
+{
+    while(_size > 0)
+    {
+        _ring[_head] = 0;
+        _head = (_head + 1) % _ring.size();
+        --_size;
+        ++_first;
+    }
+    _conflated.clear();
+}
+
+void
+EventQueue::drain(EventDataSeq& events)
+{
+    while(_size > 0)
+    {
+        events.push_back(_ring[_head]);
+        _ring[_head] = 0;
+        _head = (_head + 1) % _ring.size();
+        --_size;
+        ++_first;
+    }
+    _conflated.clear();
+}
+
+void
+EventQueue::grow()
+{
+    size_t size = _ring.empty() ? initialRingSize : _ring.size() * 2;
+    if(_maxSize > 0)
+    {
+        size = min(size, _maxSize);
+    }
+    assert(size > _size);
+
+    vector<EventDataPtr> ring(size);
+    for(size_t i = 0; i < _size; ++i)
+    {
+        ring[i] = _ring[(_head + i) % _ring.size()];
+    }
+    _ring.swap(ring);
+    _head = 0;
+}
+
+bool
+EventQueue::conflationKey(const EventDataPtr& event, string& value) const
+{
+    if(_conflateKey.empty())
+    {
+        return false;
+    }
+    Ice::Context::const_iterator p = event->context.find(_conflateKey);
+    if(p == event->context.end())
+    {
+        return false;
+    }
+    value = p->second;
+    return true;
+}
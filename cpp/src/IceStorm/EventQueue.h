@@ -0,0 +1,106 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <IceStorm/IceStormInternal.h>
+#include <map>
+
+namespace IceStorm
+{
+
+//
+// The queue of the events waiting to be sent to a subscriber. The
+// events are stored in a ring buffer which grows up to the maximum
+// size of the queue, a maximum size of 0 means the queue isn't
+// bounded.
+//
+// If a conflation key is set, an event queued with the same value
+// for this context key as a pending event replaces the pending event,
+// see conflate().
+//
+class EventQueue
+{
+public:
+
+    EventQueue(size_t = 0, const std::string& = std::string());
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    size_t maxSize() const
+    {
+        return _maxSize;
+    }
+
+    bool full() const
+    {
+        return _maxSize > 0 && _size >= _maxSize;
+    }
+
+    const EventDataPtr& front() const
+    {
+        assert(_size > 0);
+        return _ring[_head];
+    }
+
+    void pop_front();
+
+    //
+    // Add an event at the end of the queue, the queue must not be
+    // full.
+    //
+    void push_back(const EventDataPtr&);
+
+    //
+    // Replace the pending event with the same conflation key value as
+    // the given event. Returns false if there's no such event.
+    //
+    bool conflate(const EventDataPtr&);
+
+    //
+    // Remove all the events, drain() appends them to the given
+    // sequence.
+    //
+    void clear();
+    void drain(EventDataSeq&);
+
+private:
+
+    void grow();
+    bool conflationKey(const EventDataPtr&, std::string&) const;
+
+    size_t _maxSize;
+    std::string _conflateKey;
+
+    std::vector<EventDataPtr> _ring;
+    size_t _head; // The position of the first event in the ring.
+    size_t _size;
+
+    //
+    // The events are numbered in the order they are queued, _first is
+    // the number of the first event of the queue. The conflation map
+    // holds the number of the last pending event for each value of
+    // the conflation key.
+    //
+    Ice::Long _first;
+    std::map<std::string, Ice::Long> _conflated;
+};
+
+} // End namespace IceStorm
+
+#endif
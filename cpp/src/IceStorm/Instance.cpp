@@ -13,11 +13,16 @@
 #include <IceStorm/Observers.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/InstrumentationI.h>
+#include <IceStorm/EventLog.h>
 #include <IceUtil/Timer.h>
+#include <IceUtil/FileUtil.h>
 
 #include <Ice/InstrumentationI.h>
 #include <Ice/Communicator.h>
 #include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+
+#include <algorithm>
 
 using namespace std;
 using namespace IceStorm;
@@ -46,7 +51,10 @@ Instance::Instance(
                                                    name + ".Flush.Timeout", 1000))), // default one second.
     // default one minute.
     _sendTimeout(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.Timeout", 60 * 1000)),
-    _connectionPool(connectionPool)
+    _connectionPool(connectionPool),
+    _durableSegmentSize(0),
+    _durableRetentionSize(0),
+    _durableFlushEvents(0)
 {
     try
     {
@@ -66,6 +74,62 @@ Instance::Instance(
                 const_cast<Ice::ObjectPrx&>(_publisherReplicaProxy) = communicator->stringToProxy("dummy:" + p);
             }
         }
+        string durableDirectory = properties->getProperty(name + ".Durable.Directory");
+        if(!durableDirectory.empty())
+        {
+#ifdef _WIN32
+            Ice::Warning out(_traceLevels->logger);
+            out << "durable topics are not supported on this platform, ignoring " << name << ".Durable.Directory";
+            durableDirectory.clear();
+#else
+            if(_nodeAdapter)
+            {
+                Ice::Warning out(_traceLevels->logger);
+                out << "durable topics are not supported with replication, ignoring " << name
+                    << ".Durable.Directory";
+                durableDirectory.clear();
+            }
+            else if(!IceUtilInternal::directoryExists(durableDirectory))
+            {
+                Ice::Warning out(_traceLevels->logger);
+                out << "durable topics are disabled, " << name << ".Durable.Directory `" << durableDirectory
+                    << "' is not a directory";
+                durableDirectory.clear();
+            }
+#endif
+        }
+        if(!durableDirectory.empty())
+        {
+            const_cast<string&>(_durableDirectory) = durableDirectory;
+            const_cast<vector<string>&>(_durableTopics) = properties->getPropertyAsList(name + ".Durable.Topics");
+
+            //
+            // The default segment size is 16MB and the log of a topic
+            // is limited to 1GB by default, there's no time limit. The
+            // segments are only flushed when full by default.
+            //
+            Ice::Int segmentSize = properties->getPropertyAsIntWithDefault(name + ".Durable.SegmentSize", 16 * 1024);
+            if(segmentSize <= 0)
+            {
+                Ice::Warning out(_traceLevels->logger);
+                out << name << ".Durable.SegmentSize must be positive, using the default of 16MB";
+                segmentSize = 16 * 1024;
+            }
+            const_cast<size_t&>(_durableSegmentSize) = static_cast<size_t>(segmentSize) * 1024;
+            const_cast<Ice::Long&>(_durableRetentionSize) = static_cast<Ice::Long>(
+                properties->getPropertyAsIntWithDefault(name + ".Durable.RetentionSize", 1024 * 1024)) * 1024;
+            const_cast<IceUtil::Time&>(_durableRetentionTime) = IceUtil::Time::seconds(
+                properties->getPropertyAsIntWithDefault(name + ".Durable.RetentionTime", 0));
+            Ice::Int flushEvents = properties->getPropertyAsIntWithDefault(name + ".Durable.FlushEvents", 0);
+            if(flushEvents < 0)
+            {
+                Ice::Warning out(_traceLevels->logger);
+                out << name << ".Durable.FlushEvents can't be negative, flushing full segments only";
+                flushEvents = 0;
+            }
+            const_cast<int&>(_durableFlushEvents) = flushEvents;
+        }
+
         _observers = new Observers(this);
         _batchFlusher = new IceUtil::Timer();
         _timer = new IceUtil::Timer();
@@ -223,6 +287,18 @@ Instance::sendTimeout() const
     return _sendTimeout;
 }
 
+EventLogPtr
+Instance::createEventLog(const string& topic) const
+{
+    if(_durableDirectory.empty() ||
+       (!_durableTopics.empty() && find(_durableTopics.begin(), _durableTopics.end(), topic) == _durableTopics.end()))
+    {
+        return 0;
+    }
+    return new EventLog(_communicator, _traceLevels, _durableDirectory, topic, _durableSegmentSize,
+                        _durableRetentionSize, _durableRetentionTime, _durableFlushEvents);
+}
+
 void
 Instance::shutdown()
 {
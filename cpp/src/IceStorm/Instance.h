@@ -46,6 +46,9 @@ typedef IceUtil::Handle<TraceLevels> TraceLevelsPtr;
 class ConnectionPool;
 typedef IceUtil::Handle<ConnectionPool> ConnectionPoolPtr;
 
+class EventLog;
+typedef IceUtil::Handle<EventLog> EventLogPtr;
+
 class Instance : public IceUtil::Shared
 {
 public:
@@ -79,6 +82,12 @@ public:
     IceUtil::Time flushInterval() const;
     int sendTimeout() const;
 
+    //
+    // Create the event log of a topic, returns null if the topic
+    // isn't durable.
+    //
+    EventLogPtr createEventLog(const std::string&) const;
+
     void shutdown();
     void destroy();
 
@@ -98,6 +107,12 @@ private:
     const Ice::ObjectPrx _topicReplicaProxy;
     const Ice::ObjectPrx _publisherReplicaProxy;
     const ConnectionPoolPtr _connectionPool;
+    const std::string _durableDirectory;
+    const std::vector<std::string> _durableTopics;
+    const size_t _durableSegmentSize;
+    const Ice::Long _durableRetentionSize;
+    const IceUtil::Time _durableRetentionTime;
+    const int _durableFlushEvents;
     IceStormElection::NodeIPtr _node;
     IceStormElection::ObserversPtr _observers;
     IceUtil::TimerPtr _batchFlusher;
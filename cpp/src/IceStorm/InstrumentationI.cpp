@@ -318,6 +318,62 @@ SubscriberObserverI::delivered(int count)
     forEach(DeliveredUpdate(count));
 }
 
+namespace
+{
+
+struct FilteredUpdate
+{
+    FilteredUpdate(int matched, int unmatched) : matched(matched), unmatched(unmatched)
+    {
+    }
+
+    void operator()(const SubscriberMetricsPtr& v)
+    {
+        Add<int>(matched)(v->matched);
+        Add<int>(unmatched)(v->unmatched);
+    }
+
+    int matched;
+    int unmatched;
+};
+
+}
+
+void
+SubscriberObserverI::filtered(int matched, int unmatched)
+{
+    forEach(FilteredUpdate(matched, unmatched));
+}
+
+namespace
+{
+
+struct DroppedUpdate
+{
+    DroppedUpdate(int count) : count(count)
+    {
+    }
+
+    void operator()(const SubscriberMetricsPtr& v)
+    {
+        if(v->queued > 0)
+        {
+            v->queued -= count;
+        }
+        Add<int>(count)(v->dropped);
+    }
+
+    int count;
+};
+
+}
+
+void
+SubscriberObserverI::dropped(int count)
+{
+    forEach(DroppedUpdate(count));
+}
+
 TopicManagerObserverI::TopicManagerObserverI(const IceInternal::MetricsAdminIPtr& metrics) : 
     _metrics(metrics),
     _topics(metrics, "Topic"),
@@ -12,8 +12,11 @@
 #include <IceStorm/TraceLevels.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/Util.h>
+#include <IceStorm/EventFilter.h>
 #include <Ice/LoggerUtil.h>
-#include <iterator>
+#include <IceUtil/StringUtil.h>
+
+#include <climits>
 
 using namespace std;
 using namespace IceStorm;
@@ -52,18 +55,7 @@ public:
         // Use cached reads.
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
 
-        EventDataPtr event = new EventData(
-            current.operation,
-            current.mode,
-            Ice::ByteSeq(),
-            current.ctx);
-
-        //
-        // COMPILERBUG: gcc 4.0.1 doesn't like this.
-        //
-        //event->data.swap(Ice::ByteSeq(inParams.first, inParams.second));
-        Ice::ByteSeq data(inParams.first, inParams.second);
-        event->data.swap(data);
+        EventDataPtr event = IceStormInternal::createEvent(current, inParams);
 
         EventDataSeq e;
         e.push_back(event);
@@ -96,6 +88,12 @@ toSubscriberState(Subscriber::SubscriberState s)
     }
 }
 
+//
+// The maximum number of events read from the log at once when
+// replaying events to a subscriber.
+//
+const size_t replayChunkSize = 100;
+
 }
 
 // Each of the various Subscriber types.
@@ -106,7 +104,8 @@ class SubscriberBatch : public Subscriber
 {
 public:
 
-    SubscriberBatch(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, const Ice::ObjectPrx&);
+    SubscriberBatch(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, const Ice::ObjectPrx&,
+                    const EventFilterPtr&, QueueOverflow, const EventQueue&);
     ~SubscriberBatch();
 
     virtual void flush();
@@ -130,7 +129,8 @@ class SubscriberOneway : public Subscriber
 {
 public:
 
-    SubscriberOneway(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, const Ice::ObjectPrx&);
+    SubscriberOneway(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, const Ice::ObjectPrx&,
+                     const EventFilterPtr&, QueueOverflow, const EventQueue&);
     ~SubscriberOneway();
 
     virtual void flush();
@@ -152,7 +152,7 @@ class SubscriberTwoway : public Subscriber
 public:
 
     SubscriberTwoway(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, int,
-                     const Ice::ObjectPrx&);
+                     const Ice::ObjectPrx&, const EventFilterPtr&, QueueOverflow, const EventQueue&);
 
     virtual void flush();
 
@@ -201,8 +201,11 @@ SubscriberBatch::SubscriberBatch(
     const SubscriberRecord& rec,
     const Ice::ObjectPrx& proxy,
     int retryCount,
-    const Ice::ObjectPrx& obj) :
-    Subscriber(instance, rec, proxy, retryCount, 1),
+    const Ice::ObjectPrx& obj,
+    const EventFilterPtr& filter,
+    QueueOverflow overflow,
+    const EventQueue& events) :
+    Subscriber(instance, rec, proxy, retryCount, 1, filter, overflow, events),
     _obj(obj),
     _interval(instance->flushInterval())
 {
@@ -237,7 +240,7 @@ SubscriberBatch::doFlush()
     }
 
     EventDataSeq v;
-    v.swap(_events);
+    _events.drain(v);
     assert(!v.empty());
     
     if(_observer)
@@ -274,10 +277,15 @@ SubscriberBatch::doFlush()
         return;
     }
 
+    replayEvents();
     if(_events.empty() && _outstanding == 0 && _shutdown)
     {
         _lock.notify();
     }
+    else if(!_events.empty())
+    {
+        flush();
+    }
     
     // This is significantly faster than the async version, but it can
     // block the calling thread. Bad news!
@@ -303,6 +311,7 @@ SubscriberBatch::sent(bool sentSynchronously)
         _observer->delivered(_outstandingCount);
     }
 
+    replayEvents();
     if(_events.empty() && _outstanding == 0 && _shutdown)
     {
         _lock.notify();
@@ -319,8 +328,11 @@ SubscriberOneway::SubscriberOneway(
     const SubscriberRecord& rec,
     const Ice::ObjectPrx& proxy,
     int retryCount,
-    const Ice::ObjectPrx& obj) :
-    Subscriber(instance, rec, proxy, retryCount, 5),
+    const Ice::ObjectPrx& obj,
+    const EventFilterPtr& filter,
+    QueueOverflow overflow,
+    const EventQueue& events) :
+    Subscriber(instance, rec, proxy, retryCount, 5, filter, overflow, events),
     _obj(obj)
 {
     assert(retryCount == 0);
@@ -335,6 +347,8 @@ SubscriberOneway::flush()
 {
     IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
     
+    replayEvents();
+
     //
     // If the subscriber isn't online we're done.
     //
@@ -351,7 +365,7 @@ SubscriberOneway::flush()
         // request.
         //
         EventDataPtr e = _events.front();
-        _events.erase(_events.begin());
+        _events.pop_front();
         if(_observer)
         {
             _observer->outstanding(1);
@@ -359,10 +373,9 @@ SubscriberOneway::flush()
 
         try
         {
-            Ice::AsyncResultPtr result = _obj->begin_ice_invoke(
-                e->op, e->mode, e->data, e->context, Ice::newCallback_Object_ice_invoke(this, 
-                                                                                        &SubscriberOneway::exception,
-                                                                                        &SubscriberOneway::sent));
+            Ice::AsyncResultPtr result = IceStormInternal::sendEvent(
+                _obj, e, Ice::newCallback_Object_ice_invoke(this, &SubscriberOneway::exception,
+                                                            &SubscriberOneway::sent));
             if(!result->sentSynchronously())
             {
                 ++_outstanding;
@@ -377,6 +390,12 @@ SubscriberOneway::flush()
             error(true, ex);
             return;
         }
+
+        //
+        // There's no sent callback for the events sent synchronously,
+        // read the next replayed events now.
+        //
+        replayEvents();
     }
 
     if(_events.empty() && _outstanding == 0 && _shutdown)
@@ -403,6 +422,7 @@ SubscriberOneway::sent(bool sentSynchronously)
         _observer->delivered(1);
     }
 
+    replayEvents();
     if(_events.empty() && _outstanding == 0 && _shutdown)
     {
         _lock.notify();
@@ -419,8 +439,11 @@ SubscriberTwoway::SubscriberTwoway(
     const Ice::ObjectPrx& proxy,
     int retryCount,
     int maxOutstanding,
-    const Ice::ObjectPrx& obj) :
-    Subscriber(instance, rec, proxy, retryCount, maxOutstanding),
+    const Ice::ObjectPrx& obj,
+    const EventFilterPtr& filter,
+    QueueOverflow overflow,
+    const EventQueue& events) :
+    Subscriber(instance, rec, proxy, retryCount, maxOutstanding, filter, overflow, events),
     _obj(obj)
 {
 }
@@ -430,6 +453,8 @@ SubscriberTwoway::flush()
 {
     IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
 
+    replayEvents();
+
     //
     // If the subscriber isn't online we're done.
     //
@@ -446,7 +471,7 @@ SubscriberTwoway::flush()
         // request.
         //
         EventDataPtr e = _events.front();
-        _events.erase(_events.begin());
+        _events.pop_front();
         ++_outstanding;
         if(_observer)
         {
@@ -455,8 +480,8 @@ SubscriberTwoway::flush()
 
         try
         {
-            _obj->begin_ice_invoke(e->op, e->mode, e->data, e->context,
-                                   Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed));
+            IceStormInternal::sendEvent(_obj, e,
+                                        Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed));
         }
         catch(const Ice::Exception& ex)
         {
@@ -472,7 +497,7 @@ namespace
 SubscriberLink::SubscriberLink(
     const InstancePtr& instance,
     const SubscriberRecord& rec) :
-    Subscriber(instance, rec, 0, -1, 1),
+    Subscriber(instance, rec, 0, -1, 1, 0, QueueOverflowDropOldest, EventQueue()),
     _obj(TopicLinkPrx::uncheckedCast(rec.obj->ice_collocationOptimized(false)->ice_timeout(instance->sendTimeout())))
 {
 }
@@ -488,7 +513,7 @@ SubscriberLink::flush()
     }
 
     EventDataSeq v;
-    v.swap(_events);
+    _events.drain(v);
 
     EventDataSeq::iterator p = v.begin();
     while(p != v.end())
@@ -571,6 +596,69 @@ Subscriber::create(
                 throw BadQoS("invalid reliability: " + reliability);
             }
 
+            //
+            // The filter is compiled once here and evaluated for each
+            // event queued for the subscriber.
+            //
+            EventFilterPtr filter;
+            p = rec.theQoS.find("filter");
+            if(p != rec.theQoS.end())
+            {
+                filter = EventFilter::compile(p->second);
+            }
+
+            //
+            // The queue isn't bounded unless the queueSize QoS is set.
+            //
+            Ice::Long queueSize = 0;
+            p = rec.theQoS.find("queueSize");
+            if(p != rec.theQoS.end())
+            {
+                if(!IceUtilInternal::stringToInt64(p->second, queueSize) || queueSize <= 0 ||
+                   queueSize > INT_MAX)
+                {
+                    throw BadQoS("invalid queueSize: " + p->second);
+                }
+            }
+
+            QueueOverflow overflow = QueueOverflowDropOldest;
+            p = rec.theQoS.find("overflow");
+            if(p != rec.theQoS.end())
+            {
+                if(p->second == "drop newest")
+                {
+                    overflow = QueueOverflowDropNewest;
+                }
+                else if(p->second == "conflate")
+                {
+                    overflow = QueueOverflowConflate;
+                }
+                else if(p->second == "offline")
+                {
+                    overflow = QueueOverflowOffline;
+                }
+                else if(p->second != "drop oldest")
+                {
+                    throw BadQoS("invalid overflow: " + p->second);
+                }
+            }
+
+            string conflateKey;
+            p = rec.theQoS.find("conflateKey");
+            if(p != rec.theQoS.end())
+            {
+                conflateKey = p->second;
+            }
+            if(overflow == QueueOverflowConflate && conflateKey.empty())
+            {
+                throw BadQoS("conflate overflow requires the conflateKey QoS");
+            }
+            else if(overflow != QueueOverflowConflate)
+            {
+                conflateKey.clear();
+            }
+            EventQueue events(static_cast<size_t>(queueSize), conflateKey);
+
             //
             // Override the timeout.
             //
@@ -594,7 +682,8 @@ Subscriber::create(
                 {
                     throw BadQoS("ordered reliability requires a twoway proxy");
                 }
-                subscriber = new SubscriberTwoway(instance, rec, proxy, retryCount, 1, newObj);
+                subscriber = new SubscriberTwoway(instance, rec, proxy, retryCount, 1, newObj, filter, overflow,
+                                                  events);
             }
             else if(newObj->ice_isOneway() || newObj->ice_isDatagram())
             {
@@ -602,7 +691,7 @@ Subscriber::create(
                 {
                     throw BadQoS("non-zero retryCount QoS requires a twoway proxy");
                 }
-                subscriber = new SubscriberOneway(instance, rec, proxy, retryCount, newObj);
+                subscriber = new SubscriberOneway(instance, rec, proxy, retryCount, newObj, filter, overflow, events);
             }
             else if(newObj->ice_isBatchOneway() || newObj->ice_isBatchDatagram())
             {
@@ -610,12 +699,13 @@ Subscriber::create(
                 {
                     throw BadQoS("non-zero retryCount QoS requires a twoway proxy");
                 }
-                subscriber = new SubscriberBatch(instance, rec, proxy, retryCount, newObj);
+                subscriber = new SubscriberBatch(instance, rec, proxy, retryCount, newObj, filter, overflow, events);
             }
             else //if(newObj->ice_isTwoway())
             {
                 assert(newObj->ice_isTwoway());
-                subscriber = new SubscriberTwoway(instance, rec, proxy, retryCount, 5, newObj);
+                subscriber = new SubscriberTwoway(instance, rec, proxy, retryCount, 5, newObj, filter, overflow,
+                                                  events);
             }
             per->setSubscriber(subscriber);
         }
@@ -682,13 +772,99 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
     }
     
     case SubscriberStateOnline:
-        copy(events.begin(), events.end(), back_inserter(_events));
+    {
+        Ice::Int count = 0;
+        Ice::Int dropped = 0;
+        bool overflow = false;
+        for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+        {
+            if(_replayLog || _replayLast >= 0)
+            {
+                //
+                // Events appended to the log are ignored while
+                // replaying, the replay reads them from the log, and
+                // once the replay is done if they were replayed.
+                //
+                Ice::Context::const_iterator q = (*p)->context.find(EventLog::sequenceKey);
+                Ice::Long seq;
+                if(q != (*p)->context.end() && IceUtilInternal::stringToInt64(q->second, seq) &&
+                   (_replayLog || seq <= _replayLast))
+                {
+                    continue;
+                }
+            }
+
+            if(_filter && !_filter->match(**p))
+            {
+                continue;
+            }
+            ++count;
+
+            if(overflow || _events.conflate(*p))
+            {
+                ++dropped;
+                continue;
+            }
+            if(_events.full())
+            {
+                if(_overflow == QueueOverflowDropNewest)
+                {
+                    ++dropped;
+                    continue;
+                }
+                else if(_overflow == QueueOverflowOffline)
+                {
+                    dropped += static_cast<Ice::Int>(_events.size()) + 1;
+                    _events.clear();
+                    overflow = true;
+                    continue;
+                }
+                _events.pop_front();
+                ++dropped;
+            }
+            _events.push_back(*p);
+        }
+
         if(_observer)
         {
-            _observer->queued(static_cast<Ice::Int>(events.size()));
+            if(_filter)
+            {
+                _observer->filtered(count, static_cast<Ice::Int>(events.size()) - count);
+            }
+            if(count > 0)
+            {
+                _observer->queued(count);
+            }
+            if(dropped > 0)
+            {
+                _observer->dropped(dropped);
+            }
+        }
+
+        if(overflow)
+        {
+            //
+            // The subscriber can't keep up, discard events for the
+            // discard interval. This isn't counted as a retry.
+            //
+            TraceLevelsPtr traceLevels = _instance->traceLevels();
+            Ice::Warning warn(traceLevels->logger);
+            warn << traceLevels->subscriberCat << ":" << _instance->communicator()->identityToString(_rec.id);
+            if(traceLevels->subscriber > 1)
+            {
+                warn << " endpoints: " << IceStormInternal::describeEndpoints(_rec.obj);
+            }
+            warn << " subscriber offline: queue overflow, discarding events: " << _instance->discardInterval() << "s";
+
+            _next = IceUtil::Time::now(IceUtil::Time::Monotonic) + _instance->discardInterval();
+            setState(SubscriberStateOffline);
+        }
+        else if(count > 0)
+        {
+            flush();
         }
-        flush();
         break;
+    }
 
     case SubscriberStateError:
         return false;
@@ -825,12 +1001,20 @@ Subscriber::error(bool dec, const Ice::Exception& e)
         // clear all queued events.
         _next = now + _instance->discardInterval();
         ++_currentRetry;
+        if(_observer && !_events.empty())
+        {
+            _observer->dropped(static_cast<Ice::Int>(_events.size()));
+        }
         _events.clear();
         setState(SubscriberStateOffline);
     }
     // Errored out.
     else if(_state < SubscriberStateError)
     {
+        if(_observer && !_events.empty())
+        {
+            _observer->dropped(static_cast<Ice::Int>(_events.size()));
+        }
         _events.clear();
         setState(SubscriberStateError);
         
@@ -877,6 +1061,7 @@ Subscriber::completed(const Ice::AsyncResultPtr& result)
         //
         _currentRetry = 0;
         
+        replayEvents();
         if(_events.empty() && _outstanding == 0 && _shutdown)
         {
             _lock.notify();
@@ -923,22 +1108,48 @@ Subscriber::updateObserver()
     }
 }
 
+void
+Subscriber::startReplay(const EventLogPtr& log, Ice::Long seq)
+{
+    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+    _replayLog = log;
+    _replayCursor = EventLogCursor(seq);
+}
+
+void
+Subscriber::flushReplay()
+{
+    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+    replayEvents();
+    if(!_events.empty())
+    {
+        flush();
+    }
+}
+
 Subscriber::Subscriber(
     const InstancePtr& instance,
     const SubscriberRecord& rec,
     const Ice::ObjectPrx& proxy,
     int retryCount,
-    int maxOutstanding) :
+    int maxOutstanding,
+    const EventFilterPtr& filter,
+    QueueOverflow overflow,
+    const EventQueue& events) :
     _instance(instance),
     _rec(rec),
     _retryCount(retryCount),
     _maxOutstanding(maxOutstanding),
     _proxy(proxy),
     _proxyReplica(proxy),
+    _filter(filter),
+    _overflow(overflow),
     _shutdown(false),
     _state(SubscriberStateOnline),
     _outstanding(0),
     _outstandingCount(1),
+    _events(events),
+    _replayLast(-1),
     _currentRetry(0)
 {
     if(_proxy && _instance->publisherReplicaProxy())
@@ -996,6 +1207,16 @@ Subscriber::setState(Subscriber::SubscriberState state)
         }
         _state = state;
 
+        //
+        // The replay is abandoned once the subscriber goes offline,
+        // like the events queued for it.
+        //
+        if(_state != SubscriberStateOnline && _replayLog)
+        {
+            _replayLast = _replayCursor.next() - 1;
+            _replayLog = 0;
+        }
+
         if(_instance->observer())
         {
             _observer.attach(_instance->observer()->getSubscriberObserver(_instance->serviceName(),
@@ -1009,6 +1230,62 @@ Subscriber::setState(Subscriber::SubscriberState state)
     }
 }
 
+void
+Subscriber::replayEvents()
+{
+    //
+    // The events are read from the log once the queued events are
+    // sent and no more than the queue can hold, the queue overflow
+    // policy never drops replayed events.
+    //
+    size_t max = replayChunkSize;
+    if(_events.maxSize() > 0 && _events.maxSize() < max)
+    {
+        max = _events.maxSize();
+    }
+    while(_replayLog && _events.empty() && _state == SubscriberStateOnline)
+    {
+        EventDataSeq events;
+        try
+        {
+            events = _replayLog->read(_replayCursor, max);
+        }
+        catch(const Ice::Exception& ex)
+        {
+            Ice::Warning warn(_instance->traceLevels()->logger);
+            warn << _rec.topicName << ": failed to replay events to "
+                 << _instance->communicator()->identityToString(_rec.id) << ":\n" << ex;
+        }
+        if(events.size() < max)
+        {
+            _replayLast = _replayCursor.next() - 1;
+            _replayLog = 0;
+        }
+
+        Ice::Int count = 0;
+        for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+        {
+            if(!_filter || _filter->match(**p))
+            {
+                _events.push_back(*p);
+                ++count;
+            }
+        }
+
+        if(_observer)
+        {
+            if(_filter)
+            {
+                _observer->filtered(count, static_cast<Ice::Int>(events.size()) - count);
+            }
+            if(count > 0)
+            {
+                _observer->queued(count);
+            }
+        }
+    }
+}
+
 bool
 IceStorm::operator==(const SubscriberPtr& subscriber, const Ice::Identity& id)
 {
@@ -13,6 +13,8 @@
 #include <IceStorm/IceStormInternal.h>
 #include <IceStorm/SubscriberRecord.h>
 #include <IceStorm/Instrumentation.h>
+#include <IceStorm/EventQueue.h>
+#include <IceStorm/EventLog.h>
 #include <Ice/ObserverHelper.h>
 #include <IceUtil/RecMutex.h>
 
@@ -25,6 +27,9 @@ typedef IceUtil::Handle<Instance> InstancePtr;
 class Subscriber;
 typedef IceUtil::Handle<Subscriber> SubscriberPtr;
 
+class EventFilter;
+typedef IceUtil::Handle<EventFilter> EventFilterPtr;
+
 class Subscriber : public IceUtil::Shared
 {
 public:
@@ -53,6 +58,19 @@ public:
 
     void updateObserver();
 
+    //
+    // Replay the events of the log starting with the given sequence
+    // number. startReplay() is called before the subscriber is added
+    // to the topic, with the topic subscribers mutex locked, and
+    // flushReplay() once the mutex is released to send the first
+    // events. The events are then read from the log in chunks once
+    // the events queued for the subscriber are sent, the published
+    // events already appended to the log are ignored until the end
+    // of the log is reached.
+    //
+    void startReplay(const EventLogPtr&, Ice::Long);
+    void flushReplay();
+
     enum SubscriberState
     {
         SubscriberStateOnline, // Online waiting to send events.
@@ -61,13 +79,27 @@ public:
         SubscriberStateReaped // Reaped.
     };
 
+    //
+    // What to do when an event is queued and the queue of the
+    // subscriber is full, set with the overflow QoS.
+    //
+    enum QueueOverflow
+    {
+        QueueOverflowDropOldest, // Drop the oldest event of the queue.
+        QueueOverflowDropNewest, // Drop the new event.
+        QueueOverflowConflate, // Conflate events, drop the oldest event if there's none to conflate with.
+        QueueOverflowOffline // Drop all the events and put the subscriber offline.
+    };
+
     virtual void flush() = 0;
 
 protected:
 
     void setState(SubscriberState);
+    void replayEvents();
 
-    Subscriber(const InstancePtr&, const IceStorm::SubscriberRecord&, const Ice::ObjectPrx&, int, int);
+    Subscriber(const InstancePtr&, const IceStorm::SubscriberRecord&, const Ice::ObjectPrx&, int, int,
+               const EventFilterPtr&, QueueOverflow, const EventQueue&);
 
     // Immutable
     const InstancePtr _instance;
@@ -76,6 +108,8 @@ protected:
     const int _maxOutstanding; // The maximum number of oustanding events.
     const Ice::ObjectPrx _proxy; // The per subscriber object proxy, if any.
     const Ice::ObjectPrx _proxyReplica; // The replicated per subscriber object proxy, if any.
+    const EventFilterPtr _filter; // The filter set with the filter QoS, if any.
+    const QueueOverflow _overflow; // The queue overflow policy.
 
     IceUtil::Monitor<IceUtil::RecMutex> _lock;
 
@@ -85,7 +119,11 @@ protected:
 
     int _outstanding; // The current number of outstanding responses.
     int _outstandingCount; // The current number of outstanding events when batching events (only used for metrics).
-    EventDataSeq _events; // The queue of events to send.
+    EventQueue _events; // The queue of events to send.
+
+    EventLogPtr _replayLog; // The log of the events being replayed, if any.
+    EventLogCursor _replayCursor; // The position of the replay in the log.
+    Ice::Long _replayLast; // The sequence number of the last event replayed, -1 if none.
 
     // The next time to try sending a new event if we're offline.
     IceUtil::Time _next;
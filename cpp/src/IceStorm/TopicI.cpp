@@ -16,6 +16,8 @@
 #include <IceStorm/Observers.h>
 #include <IceStorm/DB.h>
 #include <IceStorm/Util.h>
+#include <IceStorm/EventLog.h>
+#include <IceUtil/InputUtil.h>
 #include <Ice/LoggerUtil.h>
 #include <algorithm>
 
@@ -63,14 +65,7 @@ public:
                const Ice::Current& current)
     {
         // The publish call does a cached read.
-        EventDataPtr event = new EventData(current.operation, current.mode, Ice::ByteSeq(), current.ctx);
-
-        //
-        // COMPILERBUG: gcc 4.0.1 doesn't like this.
-        //
-        //event->data.swap(Ice::ByteSeq(inParams.first, inParams.second));
-        Ice::ByteSeq data(inParams.first, inParams.second);
-        event->data.swap(data);
+        EventDataPtr event = IceStormInternal::createEvent(current, inParams);
         
         EventDataSeq v;
         v.push_back(event);
@@ -104,10 +99,10 @@ public:
     }
 
     virtual void
-    forward(const EventDataSeq& v, const Ice::Current& /*current*/)
+    forward(const EventDataSeq& v, const Ice::Current& current)
     {
         // The publish call does a cached read.
-        _impl->publish(true, v);
+        _impl->publish(true, IceStormInternal::createEvents(current, v));
     }
 
 private:
@@ -406,6 +401,7 @@ TopicImpl::TopicImpl(
     _name(name),
     _id(id),
     _connectionPool(instance->connectionPool()),
+    _log(instance->createEventLog(name)),
     _destroyed(false)
 {
     try
@@ -593,6 +589,17 @@ TopicImpl::subscribe(const QoS& origQoS, const Ice::ObjectPrx& obj)
         }
     }
 
+    //
+    // subscribe() can't raise BadQoS, an invalid replay position is
+    // ignored.
+    //
+    Ice::Long replay = -1;
+    if(!replayPosition(qos, replay) && traceLevels->subscriber > 0)
+    {
+        Ice::Trace out(traceLevels->logger, traceLevels->subscriberCat);
+        out << _name << ": invalid replay QoS ignored.";
+    }
+
     Ice::ObjectPrx newObj = obj;
     if(reliability == "batch")
     {
@@ -716,13 +723,28 @@ TopicImpl::subscribe(const QoS& origQoS, const Ice::ObjectPrx& obj)
         }       
     }
 
+    //
+    // The replay starts with the subscribers mutex locked so that the
+    // subscriber doesn't miss or receive twice the events being
+    // published, the events are read from the log once it's released.
+    //
+    if(replay >= 0)
+    {
+        subscriber->startReplay(_log, replay);
+    }
     _subscribers.push_back(subscriber);
 
     _instance->observers()->addSubscriber(llu, _name, record);
+
+    if(replay >= 0)
+    {
+        sync.release();
+        subscriber->flushReplay();
+    }
 }
 
 Ice::ObjectPrx
-TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
+TopicImpl::subscribeAndGetPublisher(const QoS& origQoS, const Ice::ObjectPrx& obj)
 {
     Ice::Identity id = obj->ice_getIdentity();
 
@@ -749,6 +771,15 @@ TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
         }
     }
 
+    QoS qos = origQoS;
+    Ice::Long replay = -1;
+    if(!replayPosition(qos, replay))
+    {
+        BadQoS ex;
+        ex.reason = _log ? "invalid replay position" : "topic `" + _name + "' is not durable";
+        throw ex;
+    }
+
     IceUtil::Mutex::Lock sync(_subscribersMutex);
 
     SubscriberRecord record;
@@ -800,10 +831,20 @@ TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
         }       
     }
 
+    if(replay >= 0)
+    {
+        subscriber->startReplay(_log, replay);
+    }
     _subscribers.push_back(subscriber);
 
     _instance->observers()->addSubscriber(llu, _name, record);
 
+    if(replay >= 0)
+    {
+        sync.release();
+        subscriber->flushReplay();
+    }
+
     return subscriber->proxy();
 }
 
@@ -1003,6 +1044,11 @@ TopicImpl::shutdown()
         (*p)->shutdown();
     }
 
+    if(_log)
+    {
+        _log->close();
+    }
+
     _observer.detach();
 }
 
@@ -1230,6 +1276,26 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
                     _observer->published();
                 }
             }
+            if(_log)
+            {
+                //
+                // Events are appended with the subscribers mutex locked
+                // so that a new subscriber replaying the log doesn't
+                // miss or receive twice the events being published.
+                //
+                for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+                {
+                    try
+                    {
+                        _log->append(*p);
+                    }
+                    catch(const Ice::Exception& ex)
+                    {
+                        Ice::Warning out(_instance->traceLevels()->logger);
+                        out << _name << ": failed to append event to the event log:\n" << ex;
+                    }
+                }
+            }
             copy = _subscribers;
         }
 
@@ -1479,6 +1545,11 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
     }
     _subscribers.clear();
 
+    if(_log)
+    {
+        _log->destroy();
+    }
+
     // Clear out the database records related to this topic.
     LogUpdate llu;
     for(;;)
@@ -1593,3 +1664,26 @@ TopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
 
     _instance->observers()->removeSubscriber(llu, _name, ids);
 }
+
+bool
+TopicImpl::replayPosition(QoS& qos, Ice::Long& replay) const
+{
+    //
+    // The replay QoS is the sequence number of the first event to
+    // replay to the subscriber. It's not saved with the subscriber
+    // record, the events are replayed only once.
+    //
+    QoS::iterator p = qos.find("replay");
+    if(p == qos.end())
+    {
+        return true;
+    }
+    string value = p->second;
+    qos.erase(p);
+    if(!_log || !IceUtilInternal::stringToInt64(value, replay) || replay < 0)
+    {
+        replay = -1;
+        return false;
+    }
+    return true;
+}
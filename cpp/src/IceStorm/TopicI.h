@@ -29,6 +29,9 @@ typedef IceUtil::Handle<Subscriber> SubscriberPtr;
 class ConnectionPool;
 typedef IceUtil::Handle<ConnectionPool> ConnectionPoolPtr;
 
+class EventLog;
+typedef IceUtil::Handle<EventLog> EventLogPtr;
+
 class TopicImpl : public IceUtil::Shared
 {
 public:
@@ -75,6 +78,7 @@ private:
 
     IceStormElection::LogUpdate destroyInternal(const IceStormElection::LogUpdate&, bool);
     void removeSubscribers(const Ice::IdentitySeq&);
+    bool replayPosition(QoS&, Ice::Long&) const;
 
     //
     // Immutable members.
@@ -85,6 +89,7 @@ private:
     const Ice::Identity _id; // The topic identity
     const std::string _envName;
     const ConnectionPoolPtr _connectionPool; // The connection pool
+    const EventLogPtr _log; // The event log, null if the topic isn't durable.
 
     IceInternal::ObserverHelperT<IceStorm::Instrumentation::TopicObserver> _observer;
 
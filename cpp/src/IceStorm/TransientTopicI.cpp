@@ -44,18 +44,7 @@ public:
                const Ice::Current& current)
     {
         // Use cached reads.
-        EventDataPtr event = new EventData(
-            current.operation,
-            current.mode,
-            Ice::ByteSeq(),
-            current.ctx);
-
-        //
-        // COMPILERBUG: gcc 4.0.1 doesn't like this.
-        //
-        //event->data.swap(Ice::ByteSeq(inParams.first, inParams.second));
-        Ice::ByteSeq data(inParams.first, inParams.second);
-        event->data.swap(data);
+        EventDataPtr event = IceStormInternal::createEvent(current, inParams);
         
         EventDataSeq v;
         v.push_back(event);
@@ -83,9 +72,9 @@ public:
     }
 
     virtual void
-    forward(const EventDataSeq& v, const Ice::Current& /*current*/)
+    forward(const EventDataSeq& v, const Ice::Current& current)
     {
-        _impl->publish(true, v);
+        _impl->publish(true, IceStormInternal::createEvents(current, v));
     }
 
 private:
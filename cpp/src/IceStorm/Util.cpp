@@ -8,8 +8,11 @@
 // **********************************************************************
 
 #include <IceStorm/Util.h>
+#include <Ice/OutgoingAsync.h>
 
 using namespace std;
+using namespace IceStorm;
+using namespace IceStormInternal;
 
 string
 IceStormInternal::describeEndpoints(const Ice::ObjectPrx& proxy)
@@ -33,3 +36,76 @@ IceStormInternal::describeEndpoints(const Ice::ObjectPrx& proxy)
     }
     return os.str();
 }
+
+IceStormInternal::EncodedEventData::EncodedEventData(const string& op, Ice::OperationMode mode,
+                                                     const Ice::Context& context) :
+    EventData(op, mode, Ice::ByteSeq(), context)
+{
+}
+
+void
+IceStormInternal::EncodedEventData::encode(const Ice::CommunicatorPtr& communicator)
+{
+    pair<const Ice::Byte*, const Ice::Byte*> inParams(0, 0);
+    if(!data.empty())
+    {
+        inParams.first = &data[0];
+        inParams.second = inParams.first + data.size();
+    }
+    _params = new IceInternal::EncodedParams(communicator, context, inParams);
+}
+
+EventDataPtr
+IceStormInternal::createEvent(const Ice::Current& current, const pair<const Ice::Byte*, const Ice::Byte*>& inParams)
+{
+    EncodedEventDataPtr event = new EncodedEventData(current.operation, current.mode, current.ctx);
+
+    //
+    // COMPILERBUG: gcc 4.0.1 doesn't like this.
+    //
+    //event->data.swap(Ice::ByteSeq(inParams.first, inParams.second));
+    Ice::ByteSeq data(inParams.first, inParams.second);
+    event->data.swap(data);
+    event->encode(current.adapter->getCommunicator());
+    return event;
+}
+
+EventDataSeq
+IceStormInternal::createEvents(const Ice::Current& current, const EventDataSeq& events)
+{
+    Ice::CommunicatorPtr communicator = current.adapter->getCommunicator();
+    EventDataSeq v;
+    v.reserve(events.size());
+    for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+    {
+        EncodedEventDataPtr event = new EncodedEventData((*p)->op, (*p)->mode, (*p)->context);
+        event->data.swap((*p)->data);
+        event->encode(communicator);
+        v.push_back(event);
+    }
+    return v;
+}
+
+Ice::AsyncResultPtr
+IceStormInternal::sendEvent(const Ice::ObjectPrx& proxy, const EventDataPtr& event,
+                            const IceInternal::CallbackBasePtr& cb)
+{
+    EncodedEventDataPtr encoded = EncodedEventDataPtr::dynamicCast(event);
+    if(encoded && encoded->params())
+    {
+        return proxy->__begin_ice_invoke(event->op, event->mode, event->context, encoded->params(), cb);
+    }
+
+    //
+    // The event isn't encoded, encode it for this subscriber only.
+    //
+    pair<const Ice::Byte*, const Ice::Byte*> inParams(0, 0);
+    if(!event->data.empty())
+    {
+        inParams.first = &event->data[0];
+        inParams.second = inParams.first + event->data.size();
+    }
+    IceInternal::EncodedParamsPtr params =
+        new IceInternal::EncodedParams(proxy->ice_getCommunicator(), event->context, inParams);
+    return proxy->__begin_ice_invoke(event->op, event->mode, event->context, params, cb);
+}
@@ -13,6 +13,7 @@
 #include <string>
 
 #include <Ice/Ice.h>
+#include <IceStorm/IceStormInternal.h>
 
 namespace IceStormInternal
 {
@@ -20,5 +21,56 @@ namespace IceStormInternal
 std::string
 describeEndpoints(const Ice::ObjectPrx&);
 
+//
+// An event with its request context and data encoded once for all
+// the subscribers it's sent to, see sendEvent().
+//
+class EncodedEventData : public IceStorm::EventData
+{
+public:
+
+    EncodedEventData(const std::string&, Ice::OperationMode, const Ice::Context&);
+
+    //
+    // Encode the context and the data of the event. This must be
+    // called again after the context is changed, before the event is
+    // queued.
+    //
+    void encode(const Ice::CommunicatorPtr&);
+
+    const IceInternal::EncodedParamsPtr& params() const
+    {
+        return _params;
+    }
+
+private:
+
+    IceInternal::EncodedParamsPtr _params;
+};
+typedef IceUtil::Handle<EncodedEventData> EncodedEventDataPtr;
+
+//
+// Create the event for an invocation on a publisher object.
+//
+IceStorm::EventDataPtr
+createEvent(const Ice::Current&, const std::pair<const Ice::Byte*, const Ice::Byte*>&);
+
+//
+// Create the events for events forwarded by a linked topic. The data
+// of the forwarded events is moved to the new events.
+//
+IceStorm::EventDataSeq
+createEvents(const Ice::Current&, const IceStorm::EventDataSeq&);
+
+//
+// Send an event to a subscriber with ice_invoke, the request is
+// completed with end_ice_invoke. The encoded context and data of
+// events created with createEvent() or createEvents() are shared by
+// the requests sent to all the subscribers, only the request header
+// is encoded for each subscriber.
+//
+Ice::AsyncResultPtr
+sendEvent(const Ice::ObjectPrx&, const IceStorm::EventDataPtr&, const IceInternal::CallbackBasePtr&);
+
 }
 #endif
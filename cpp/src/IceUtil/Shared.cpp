@@ -114,6 +114,17 @@ IceUtil::Shared::__incRef()
 #if defined(_WIN32)
     assert(InterlockedExchangeAdd(&_ref, 0) >= 0);
     InterlockedIncrement(&_ref);
+#elif defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+    //
+    // The increment doesn't need to be ordered with other memory
+    // operations: a thread can only add a reference to an object it
+    // already holds a reference to.
+    //
+#   ifndef NDEBUG
+    int c =
+#   endif
+        __atomic_fetch_add(&_ref, 1, __ATOMIC_RELAXED);
+    assert(c >= 0);
 #elif defined(ICE_HAS_GCC_BUILTINS)
 
 #   ifndef NDEBUG
@@ -142,6 +153,22 @@ IceUtil::Shared::__decRef()
         _noDelete = true;
         delete this;
     }
+#elif defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+    //
+    // The decrement releases the memory operations of this thread on
+    // the object, the thread which deletes the object acquires them.
+    //
+    int c = __atomic_fetch_sub(&_ref, 1, __ATOMIC_RELEASE);
+    assert(c > 0);
+    if(c == 1)
+    {
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if(!_noDelete)
+        {
+            _noDelete = true;
+            delete this;
+        }
+    }
 #elif defined(ICE_HAS_GCC_BUILTINS)
     int c = __sync_fetch_and_sub(&_ref, 1);
     assert(c > 0);
@@ -179,6 +206,8 @@ IceUtil::Shared::__getRef() const
 {
 #if defined(_WIN32)
     return InterlockedExchangeAdd(const_cast<LONG*>(&_ref), 0);
+#elif defined(ICE_HAS_GCC_ATOMIC_BUILTINS)
+    return __atomic_load_n(&_ref, __ATOMIC_RELAXED);
 #elif defined(ICE_HAS_GCC_BUILTINS)
     return __sync_fetch_and_sub(const_cast<volatile int*>(&_ref), 0);
 #elif defined(ICE_HAS_ATOMIC_FUNCTIONS)
@@ -9,9 +9,11 @@
 
 #include <IceUtil/Timer.h>
 #include <IceUtil/Exception.h>
+#include <IceUtil/TimerWheel.h>
 
 using namespace std;
 using namespace IceUtil;
+using namespace IceUtilInternal;
 
 Timer::Timer() :
     Thread("IceUtil timer thread"),
@@ -31,6 +33,46 @@ Timer::Timer(int priority) :
     __setNoDelete(false);
 }
 
+Timer::Timer(const IceUtil::Time& tick) :
+    Thread("IceUtil timer thread"),
+    _destroyed(false)
+{
+    if(tick < IceUtil::Time())
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "invalid tick");
+    }
+    if(tick > IceUtil::Time())
+    {
+        _wheel.reset(new TimerWheel(tick, IceUtil::Time::now(IceUtil::Time::Monotonic)));
+    }
+
+    __setNoDelete(true);
+    start();
+    __setNoDelete(false);
+}
+
+Timer::Timer(const IceUtil::Time& tick, int priority) :
+    Thread("IceUtil timer thread"),
+    _destroyed(false)
+{
+    if(tick < IceUtil::Time())
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "invalid tick");
+    }
+    if(tick > IceUtil::Time())
+    {
+        _wheel.reset(new TimerWheel(tick, IceUtil::Time::now(IceUtil::Time::Monotonic)));
+    }
+
+    __setNoDelete(true);
+    start(0, priority);
+    __setNoDelete(false);
+}
+
+Timer::~Timer()
+{
+}
+
 void
 Timer::destroy()
 {
@@ -44,6 +86,10 @@ Timer::destroy()
         _monitor.notify();
         _tasks.clear();
         _tokens.clear();
+        if(_wheel.get())
+        {
+            _wheel->clear();
+        }
     }
 
     if(getThreadControl() == ThreadControl())
@@ -72,12 +118,22 @@ Timer::schedule(const TimerTaskPtr& task, const IceUtil::Time& delay)
         throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
     }
 
-    bool inserted = _tasks.insert(make_pair(task, time)).second;
-    if(!inserted)
+    if(_wheel.get())
     {
-        throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        if(!_wheel->add(task, time, IceUtil::Time()))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        }
+    }
+    else
+    {
+        bool inserted = _tasks.insert(make_pair(task, time)).second;
+        if(!inserted)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        }
+        _tokens.insert(Token(time, IceUtil::Time(), task));
     }
-    _tokens.insert(Token(time, IceUtil::Time(), task));
 
     if(_wakeUpTime == IceUtil::Time() || time < _wakeUpTime)
     {
@@ -101,12 +157,22 @@ Timer::scheduleRepeated(const TimerTaskPtr& task, const IceUtil::Time& delay)
         throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
     }
 
-    bool inserted = _tasks.insert(make_pair(task, token.scheduledTime)).second;
-    if(!inserted)
+    if(_wheel.get())
     {
-        throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        if(!_wheel->add(task, token.scheduledTime, delay))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        }
+    }
+    else
+    {
+        bool inserted = _tasks.insert(make_pair(task, token.scheduledTime)).second;
+        if(!inserted)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        }
+        _tokens.insert(token); 
     }
-    _tokens.insert(token); 
    
     if(_wakeUpTime == IceUtil::Time() || token.scheduledTime < _wakeUpTime)
     {
@@ -123,6 +189,11 @@ Timer::cancel(const TimerTaskPtr& task)
         return false;
     }
 
+    if(_wheel.get())
+    {
+        return _wheel->remove(task);
+    }
+
     map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare>::iterator p = _tasks.find(task);
     if(p == _tasks.end())
     {
@@ -152,17 +223,24 @@ Timer::run()
                 //
                 if(token.delay != IceUtil::Time())
                 {
-                    map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare>::iterator p = _tasks.find(token.task);
-                    if(p != _tasks.end())
+                    if(_wheel.get())
                     {
-                        token.scheduledTime = IceUtil::Time::now(IceUtil::Time::Monotonic) + token.delay;
-                        p->second = token.scheduledTime;
-                        _tokens.insert(token);
+                        _wheel->reschedule(token.task, IceUtil::Time::now(IceUtil::Time::Monotonic) + token.delay);
+                    }
+                    else
+                    {
+                        map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare>::iterator p = _tasks.find(token.task);
+                        if(p != _tasks.end())
+                        {
+                            token.scheduledTime = IceUtil::Time::now(IceUtil::Time::Monotonic) + token.delay;
+                            p->second = token.scheduledTime;
+                            _tokens.insert(token);
+                        }
                     }
                 }
                 token = Token(IceUtil::Time(), IceUtil::Time(), 0);
 
-                if(_tokens.empty())
+                if(_wheel.get() ? _wheel->empty() : _tokens.empty())
                 {
                     _wakeUpTime = IceUtil::Time();
                     _monitor.wait();
@@ -174,29 +252,40 @@ Timer::run()
                 break;
             }
             
-            while(!_tokens.empty() && !_destroyed)
+            while(!(_wheel.get() ? _wheel->empty() : _tokens.empty()) && !_destroyed)
             {
                 const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
-                const Token& first = *(_tokens.begin());
-                if(first.scheduledTime <= now)
+                if(_wheel.get())
                 {
-                    token = first;
-                    _tokens.erase(_tokens.begin());
-                    if(token.delay == IceUtil::Time())
+                    if(_wheel->pop(now, token.task, token.delay))
                     {
-                        _tasks.erase(token.task);
+                        break;
+                    }
+                    _wakeUpTime = _wheel->nextWakeUp();
+                }
+                else
+                {
+                    const Token& first = *(_tokens.begin());
+                    if(first.scheduledTime <= now)
+                    {
+                        token = first;
+                        _tokens.erase(_tokens.begin());
+                        if(token.delay == IceUtil::Time())
+                        {
+                            _tasks.erase(token.task);
+                        }
+                        break;
                     }
-                    break;
+                    _wakeUpTime = first.scheduledTime;
                 }
                 
-                _wakeUpTime = first.scheduledTime;
                 try 
                 {
-                    _monitor.timedWait(first.scheduledTime - now);
+                    _monitor.timedWait(_wakeUpTime - now);
                 } 
                 catch(const IceUtil::InvalidTimeoutException&)
                 {
-                    IceUtil::Time timeout = (first.scheduledTime - now) / 2;
+                    IceUtil::Time timeout = (_wakeUpTime - now) / 2;
                     while(timeout > IceUtil::Time())
                     {
                         try 
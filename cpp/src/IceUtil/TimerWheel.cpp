@@ -0,0 +1,360 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceUtil/TimerWheel.h>
+
+#include <cassert>
+
+using namespace std;
+using namespace IceUtil;
+using namespace IceUtilInternal;
+
+namespace
+{
+
+const int Ready = -1;
+const int Unlinked = -2;
+
+}
+
+TimerWheel::TimerWheel(const IceUtil::Time& tick, const IceUtil::Time& now) :
+    _tick(tick.toMicroSeconds()),
+    _start(now),
+    _current(0),
+    _buckets(64),
+    _size(0)
+{
+    assert(_tick > 0);
+    for(int level = 0; level < Levels; ++level)
+    {
+        _levelSize[level] = 0;
+    }
+}
+
+TimerWheel::~TimerWheel()
+{
+    clear();
+}
+
+bool
+TimerWheel::add(const TimerTaskPtr& task, const IceUtil::Time& time, const IceUtil::Time& delay)
+{
+    if(find(task.get()))
+    {
+        return false;
+    }
+
+    Entry* entry = new Entry;
+    entry->task = task;
+    entry->delay = delay;
+    entry->tick = toTick(time, true);
+    entry->level = Unlinked;
+    entry->hashNext = 0;
+    insert(entry);
+    link(entry);
+    return true;
+}
+
+bool
+TimerWheel::remove(const TimerTaskPtr& task)
+{
+    Entry* entry = erase(task.get());
+    if(!entry)
+    {
+        return false;
+    }
+
+    if(entry->level != Unlinked)
+    {
+        unlink(entry);
+    }
+    delete entry;
+    return true;
+}
+
+bool
+TimerWheel::reschedule(const TimerTaskPtr& task, const IceUtil::Time& time)
+{
+    //
+    // If the entry is linked, the task was cancelled and scheduled
+    // again while it was running, it's not ours to reschedule.
+    //
+    Entry* entry = find(task.get());
+    if(!entry || entry->level != Unlinked)
+    {
+        return false;
+    }
+
+    entry->tick = toTick(time, true);
+    link(entry);
+    return true;
+}
+
+bool
+TimerWheel::pop(const IceUtil::Time& now, TimerTaskPtr& task, IceUtil::Time& delay)
+{
+    const Int64 tick = toTick(now, false);
+    while(_ready.empty() && _current < tick)
+    {
+        if(_levelSize[0] == 0)
+        {
+            //
+            // Nothing expires before the next cascade of the higher
+            // levels, skip the empty slots of the first level.
+            //
+            Int64 last = _size == 0 ? tick : (_current | SlotMask);
+            if(last > _current)
+            {
+                _current = last < tick ? last : tick;
+                continue;
+            }
+        }
+        advance();
+    }
+
+    if(_ready.empty())
+    {
+        return false;
+    }
+
+    Entry* entry = static_cast<Entry*>(_ready.next);
+    unlink(entry);
+    task = entry->task;
+    delay = entry->delay;
+    if(delay == IceUtil::Time())
+    {
+        erase(task.get());
+        delete entry;
+    }
+    return true;
+}
+
+IceUtil::Time
+TimerWheel::nextWakeUp() const
+{
+    if(!_ready.empty())
+    {
+        return toTime(_current);
+    }
+
+    if(_levelSize[0] > 0)
+    {
+        for(Int64 tick = _current + 1; tick <= _current + Slots; ++tick)
+        {
+            if(!_slots[0][tick & SlotMask].empty())
+            {
+                return toTime(tick);
+            }
+        }
+        assert(false);
+    }
+    return toTime((_current | SlotMask) + 1);
+}
+
+void
+TimerWheel::clear()
+{
+    for(vector<Entry*>::iterator p = _buckets.begin(); p != _buckets.end(); ++p)
+    {
+        while(*p)
+        {
+            Entry* entry = *p;
+            *p = entry->hashNext;
+            if(entry->level != Unlinked)
+            {
+                unlink(entry);
+            }
+            delete entry;
+        }
+    }
+    _size = 0;
+}
+
+void
+TimerWheel::link(Entry* entry)
+{
+    assert(entry->level == Unlinked);
+
+    Link* slot;
+    Int64 delta = entry->tick - _current;
+    if(delta <= 0)
+    {
+        slot = &_ready;
+        entry->level = Ready;
+    }
+    else
+    {
+        int level = 0;
+        while(level < Levels - 1 && delta >= (Int64(1) << ((level + 1) * SlotBits)))
+        {
+            ++level;
+        }
+
+        //
+        // Tasks beyond the range of the last level are kept in its
+        // farthest slot and linked again when it's cascaded.
+        //
+        Int64 tick = entry->tick;
+        if(delta >= (Int64(1) << (Levels * SlotBits)))
+        {
+            tick = _current + (Int64(1) << (Levels * SlotBits)) - 1;
+        }
+
+        slot = &_slots[level][(tick >> (level * SlotBits)) & SlotMask];
+        entry->level = level;
+        ++_levelSize[level];
+    }
+
+    entry->prev = slot->prev;
+    entry->next = slot;
+    slot->prev->next = entry;
+    slot->prev = entry;
+}
+
+void
+TimerWheel::unlink(Entry* entry)
+{
+    assert(entry->level != Unlinked);
+
+    entry->prev->next = entry->next;
+    entry->next->prev = entry->prev;
+    entry->prev = entry;
+    entry->next = entry;
+    if(entry->level != Ready)
+    {
+        --_levelSize[entry->level];
+    }
+    entry->level = Unlinked;
+}
+
+void
+TimerWheel::cascade(int level, int index)
+{
+    Link& slot = _slots[level][index];
+    while(!slot.empty())
+    {
+        Entry* entry = static_cast<Entry*>(slot.next);
+        unlink(entry);
+        link(entry);
+    }
+}
+
+void
+TimerWheel::advance()
+{
+    ++_current;
+
+    //
+    // When a level wraps around, move the tasks of the current slot of
+    // the level above down the wheel.
+    //
+    for(int level = 1; level < Levels; ++level)
+    {
+        if(((_current >> ((level - 1) * SlotBits)) & SlotMask) != 0)
+        {
+            break;
+        }
+        cascade(level, static_cast<int>((_current >> (level * SlotBits)) & SlotMask));
+    }
+
+    cascade(0, static_cast<int>(_current & SlotMask));
+}
+
+Int64
+TimerWheel::toTick(const IceUtil::Time& time, bool roundUp) const
+{
+    Int64 usec = (time - _start).toMicroSeconds();
+    if(usec <= 0)
+    {
+        return 0;
+    }
+    return roundUp ? (usec + _tick - 1) / _tick : usec / _tick;
+}
+
+IceUtil::Time
+TimerWheel::toTime(Int64 tick) const
+{
+    return _start + IceUtil::Time::microSeconds(tick * _tick);
+}
+
+TimerWheel::Entry*
+TimerWheel::find(const TimerTask* task) const
+{
+    Entry* entry = _buckets[bucket(task)];
+    while(entry && entry->task.get() != task)
+    {
+        entry = entry->hashNext;
+    }
+    return entry;
+}
+
+void
+TimerWheel::insert(Entry* entry)
+{
+    if(_size >= _buckets.size())
+    {
+        rehash();
+    }
+
+    Entry*& head = _buckets[bucket(entry->task.get())];
+    entry->hashNext = head;
+    head = entry;
+    ++_size;
+}
+
+TimerWheel::Entry*
+TimerWheel::erase(const TimerTask* task)
+{
+    Entry** p = &_buckets[bucket(task)];
+    while(*p && (*p)->task.get() != task)
+    {
+        p = &(*p)->hashNext;
+    }
+
+    Entry* entry = *p;
+    if(entry)
+    {
+        *p = entry->hashNext;
+        entry->hashNext = 0;
+        --_size;
+    }
+    return entry;
+}
+
+void
+TimerWheel::rehash()
+{
+    vector<Entry*> buckets(_buckets.size() * 2);
+    _buckets.swap(buckets);
+    for(vector<Entry*>::iterator p = buckets.begin(); p != buckets.end(); ++p)
+    {
+        while(*p)
+        {
+            Entry* entry = *p;
+            *p = entry->hashNext;
+            Entry*& head = _buckets[bucket(entry->task.get())];
+            entry->hashNext = head;
+            head = entry;
+        }
+    }
+}
+
+size_t
+TimerWheel::bucket(const TimerTask* task) const
+{
+    //
+    // Tasks are heap allocated, drop the alignment bits and mix the
+    // remaining ones so that consecutive allocations spread out.
+    //
+    size_t h = reinterpret_cast<size_t>(task) >> 4;
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h & (_buckets.size() - 1);
+}
@@ -0,0 +1,140 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_UTIL_TIMER_WHEEL_H
+#define ICE_UTIL_TIMER_WHEEL_H
+
+#include <IceUtil/Timer.h>
+
+#include <vector>
+
+namespace IceUtilInternal
+{
+
+//
+// A hierarchical timing wheel, used by IceUtil::Timer to store its
+// tasks when it's created with a tick. Scheduling and cancelling a
+// task are O(1): tasks are kept in doubly-linked slot lists, and a
+// chained hash table keyed by the task pointer finds the slot entry
+// of a task.
+//
+// The wheel has four levels of 256 slots. The first level holds the
+// tasks due within the next 256 ticks, each following level holds
+// tasks 256 times further away and is cascaded into the level below
+// when the latter wraps around. Expiry times are rounded up to the
+// next tick so tasks never run early.
+//
+// The wheel isn't thread safe, the timer calls it with its monitor
+// locked.
+//
+class TimerWheel
+{
+public:
+
+    TimerWheel(const IceUtil::Time&, const IceUtil::Time&);
+    ~TimerWheel();
+
+    //
+    // Add a task which expires at the given time. Returns false if the
+    // task is already in the wheel.
+    //
+    bool add(const IceUtil::TimerTaskPtr&, const IceUtil::Time&, const IceUtil::Time&);
+
+    //
+    // Remove a task. Returns false if the task isn't in the wheel.
+    //
+    bool remove(const IceUtil::TimerTaskPtr&);
+
+    //
+    // Put back a repeated task returned by pop() in the wheel. Returns
+    // false if the task was removed while it was running.
+    //
+    bool reschedule(const IceUtil::TimerTaskPtr&, const IceUtil::Time&);
+
+    //
+    // Advance the wheel up to the given time and return the next
+    // expired task with its repeat delay. Returns false if no task
+    // has expired. One-shot tasks are removed from the wheel, repeated
+    // tasks stay in the wheel until they are rescheduled or removed.
+    //
+    bool pop(const IceUtil::Time&, IceUtil::TimerTaskPtr&, IceUtil::Time&);
+
+    //
+    // The time at which pop() must be called again. It's either the
+    // tick of the next non-empty slot of the first level or the next
+    // cascade of the higher levels, whichever is the earliest.
+    //
+    IceUtil::Time nextWakeUp() const;
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    void clear();
+
+private:
+
+    TimerWheel(const TimerWheel&);
+    void operator=(const TimerWheel&);
+
+    struct Link
+    {
+        Link* prev;
+        Link* next;
+
+        Link() : prev(this), next(this)
+        {
+        }
+
+        bool empty() const
+        {
+            return next == this;
+        }
+    };
+
+    struct Entry : public Link
+    {
+        IceUtil::TimerTaskPtr task;
+        IceUtil::Time delay;
+        IceUtil::Int64 tick;
+        int level;
+        Entry* hashNext;
+    };
+
+    enum { SlotBits = 8, Slots = 1 << SlotBits, SlotMask = Slots - 1, Levels = 4 };
+
+    void link(Entry*);
+    void unlink(Entry*);
+    void cascade(int, int);
+    void advance();
+    IceUtil::Int64 toTick(const IceUtil::Time&, bool) const;
+    IceUtil::Time toTime(IceUtil::Int64) const;
+
+    Entry* find(const IceUtil::TimerTask*) const;
+    void insert(Entry*);
+    Entry* erase(const IceUtil::TimerTask*);
+    void rehash();
+    size_t bucket(const IceUtil::TimerTask*) const;
+
+    const IceUtil::Int64 _tick;
+    const IceUtil::Time _start;
+    IceUtil::Int64 _current;
+
+    Link _slots[Levels][Slots];
+    size_t _levelSize[Levels];
+    Link _ready;
+
+    std::vector<Entry*> _buckets;
+    size_t _size;
+};
+
+}
+
+#endif
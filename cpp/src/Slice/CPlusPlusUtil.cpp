@@ -77,6 +77,14 @@ sequenceTypeToString(const SequencePtr& seq, const StringList& metaData, int typ
             string s = typeToString(seq->type(), seq->typeMetaData(), inWstringModule(seq) ? TypeContextUseWstring : 0);
             return "::std::pair<const " + s + "*, const " + s + "*>";
         }
+        else if(seqType == "%view")
+        {
+            if(isViewableSequence(seq))
+            {
+                return "::Ice::SequenceView<" + toTemplateArg(typeToString(seq->type())) + ">";
+            }
+            return fixKwd(seq->scoped());
+        }
         else if(seqType.find("%range") == 0)
         {
             string s;
@@ -1025,8 +1033,9 @@ Slice::findMetaData(const StringList& metaData, int typeCtx)
             //
             // If the form is cpp:type:<...> the data after cpp:type:
             // is returned.
-            // If the form is cpp:range[:<...>], cpp:array or cpp:class,
-            // the return value is % followed by the string after cpp:.
+            // If the form is cpp:range[:<...>], cpp:array, cpp:view or
+            // cpp:class, the return value is % followed by the string
+            // after cpp:.
             //
             if(pos != string::npos)
             {
@@ -1045,6 +1054,10 @@ Slice::findMetaData(const StringList& metaData, int typeCtx)
                     return "%range:array";
                 }
             }
+            else if(str.substr(prefix.size()) == "view")
+            {
+                return "%view";
+            }
             else if(typeCtx & (TypeContextInParam | TypeContextAMIPrivateEnd) && !(typeCtx & TypeContextAMIEnd))
             {
                 string ss = str.substr(prefix.size());
@@ -1074,6 +1087,17 @@ Slice::findMetaData(const StringList& metaData, int typeCtx)
     return "";
 }
 
+bool
+Slice::isViewableSequence(const SequencePtr& seq)
+{
+    BuiltinPtr builtin = BuiltinPtr::dynamicCast(seq->type());
+    return builtin &&
+        builtin->kind() != Builtin::KindString &&
+        builtin->kind() != Builtin::KindObject &&
+        builtin->kind() != Builtin::KindObjectProxy &&
+        builtin->kind() != Builtin::KindLocalObject;
+}
+
 bool
 Slice::inWstringModule(const SequencePtr& seq)
 {
@@ -15,6 +15,7 @@
 #include <IceUtil/Iterator.h>
 #include <Slice/Checksum.h>
 #include <Slice/FileTracker.h>
+#include <Ice/DispatchHash.h>
 
 #include <limits>
 
@@ -41,6 +42,94 @@ getDeprecateSymbol(const ContainedPtr& p1, const ContainedPtr& p2)
     return deprecateSymbol;
 }
 
+//
+// Compute a perfect hash of the operation names of a class for
+// __dispatch() (see Ice/DispatchHash.h). The names are distributed in
+// buckets with the low bits of their hash, and for each bucket, from
+// the largest to the smallest, we search a seed which maps the names
+// of the bucket to free slots. slots[i] is the index of the operation
+// name mapped to slot i, or -1. Returns false if no perfect hash was
+// found, in which case the caller falls back to a binary search.
+//
+bool
+computeDispatchHash(const StringList& names, vector<unsigned int>& seeds, vector<int>& slots)
+{
+    vector<unsigned int> hashes;
+    for(StringList::const_iterator p = names.begin(); p != names.end(); ++p)
+    {
+        hashes.push_back(IceInternal::dispatchHash(*p));
+    }
+
+    size_t minSize = 2;
+    while(minSize < hashes.size())
+    {
+        minSize *= 2;
+    }
+
+    //
+    // Try larger tables if the seeds of a table are exhausted.
+    //
+    for(size_t size = minSize; size <= minSize * 4; size *= 2)
+    {
+        const size_t bucketCount = size / 2;
+        vector<vector<int> > buckets(bucketCount);
+        for(size_t i = 0; i < hashes.size(); ++i)
+        {
+            buckets[hashes[i] & (bucketCount - 1)].push_back(static_cast<int>(i));
+        }
+
+        vector<pair<size_t, size_t> > order; // Bucket size and index.
+        for(size_t i = 0; i < bucketCount; ++i)
+        {
+            order.push_back(make_pair(buckets[i].size(), i));
+        }
+        sort(order.rbegin(), order.rend());
+
+        seeds.assign(bucketCount, 0);
+        slots.assign(size, -1);
+        bool found = true;
+        for(vector<pair<size_t, size_t> >::const_iterator p = order.begin(); p != order.end() && p->first > 0; ++p)
+        {
+            const vector<int>& bucket = buckets[p->second];
+            found = false;
+            for(unsigned int seed = 0; seed < 0x10000 && !found; ++seed)
+            {
+                vector<size_t> taken;
+                for(vector<int>::const_iterator q = bucket.begin(); q != bucket.end(); ++q)
+                {
+                    size_t slot = IceInternal::dispatchSlot(hashes[*q], seed) & (size - 1);
+                    if(slots[slot] != -1 || find(taken.begin(), taken.end(), slot) != taken.end())
+                    {
+                        break;
+                    }
+                    taken.push_back(slot);
+                }
+
+                if(taken.size() == bucket.size())
+                {
+                    for(size_t i = 0; i < bucket.size(); ++i)
+                    {
+                        slots[taken[i]] = bucket[i];
+                    }
+                    seeds[p->second] = seed;
+                    found = true;
+                }
+            }
+
+            if(!found)
+            {
+                break;
+            }
+        }
+
+        if(found)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void
 writeConstantValue(IceUtilInternal::Output& out, const TypePtr& type, const SyntaxTreeBasePtr& valueType,
                    const string& value, int useWstring, const StringList& metaData)
@@ -191,7 +280,7 @@ writeDataMemberInitializers(IceUtilInternal::Output& C, const DataMemberList& me
 Slice::Gen::Gen(const string& base, const string& headerExtension, const string& sourceExtension,
                 const vector<string>& extraHeaders, const string& include,
                 const vector<string>& includePaths, const string& dllExport, const string& dir,
-                bool imp, bool checksum, bool stream, bool ice) :
+                bool imp, bool checksum, bool stream, bool ice, bool dispatchHash) :
     _base(base),
     _headerExtension(headerExtension),
     _implHeaderExtension(headerExtension),
@@ -204,7 +293,8 @@ Slice::Gen::Gen(const string& base, const string& headerExtension, const string&
     _impl(imp),
     _checksum(checksum),
     _stream(stream),
-    _ice(ice)
+    _ice(ice),
+    _dispatchHash(dispatchHash)
 {
     for(vector<string>::iterator p = _includePaths.begin(); p != _includePaths.end(); ++p)
     {
@@ -379,6 +469,10 @@ Slice::Gen::generate(const UnitPtr& p)
 
         C << "\n#include <Ice/LocalException.h>";
         C << "\n#include <Ice/ObjectFactory.h>";
+        if(_dispatchHash)
+        {
+            C << "\n#include <Ice/DispatchHash.h>";
+        }
     }
     else if(p->hasLocalClassDefsWithAsync())
     {
@@ -397,6 +491,7 @@ Slice::Gen::generate(const UnitPtr& p)
 
     H << "\n#include <IceUtil/ScopedArray.h>";
     H << "\n#include <IceUtil/Optional.h>";
+    H << "\n#include <Ice/SequenceView.h>";
 
     if(p->usesNonLocals())
     {
@@ -518,7 +613,7 @@ Slice::Gen::generate(const UnitPtr& p)
     DelegateDVisitor delegateDVisitor(H, C, _dllExport);
     p->visit(&delegateDVisitor, false);
 
-    ObjectVisitor objectVisitor(H, C, _dllExport, _stream);
+    ObjectVisitor objectVisitor(H, C, _dllExport, _stream, _dispatchHash);
     p->visit(&objectVisitor, false);
 
     //
@@ -1257,7 +1352,11 @@ Slice::Gen::TypesVisitor::visitSequence(const SequencePtr& p)
     string seqType = findMetaData(metaData, _useWstring);
     H << sp;
 
-    if(!seqType.empty())
+    if(seqType == "%view" && isViewableSequence(p))
+    {
+        H << nl << "typedef ::Ice::SequenceView<" << (s[0] == ':' ? " " : "") << s << "> " << name << ';';
+    }
+    else if(!seqType.empty() && seqType != "%view")
     {
         H << nl << "typedef " << seqType << ' ' << name << ';';
     }
@@ -1598,6 +1697,11 @@ Slice::Gen::ProxyVisitor::visitClassDefEnd(const ClassDefPtr& p)
     H << nl << "return dynamic_cast<" << name << "*>(::IceProxy::Ice::Object::ice_preferSecure(__preferSecure).get());";
     H << eb;
 
+    H << nl << nl << "::IceInternal::ProxyHandle<" << name << "> ice_coalesce(bool __coalesce) const";
+    H << sb;
+    H << nl << "return dynamic_cast<" << name << "*>(::IceProxy::Ice::Object::ice_coalesce(__coalesce).get());";
+    H << eb;
+
     H << nl << nl << "::IceInternal::ProxyHandle<" << name << "> ice_router(const ::Ice::RouterPrx& __router) const";
     H << sb;
     H << nl << "return dynamic_cast<" << name << "*>(::IceProxy::Ice::Object::ice_router(__router).get());";
@@ -2116,6 +2220,181 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
         }
     }
     
+    //
+    // The future-returning methods. The result of the future is the
+    // return value or out parameter if the operation returns a single
+    // value, and a tuple of the return value and out parameters if it
+    // returns several values. The callback fulfills the promise
+    // directly, no std::function is allocated for the invocation.
+    //
+    vector<string> futureTypes;
+    if(ret)
+    {
+        futureTypes.push_back(retS);
+    }
+    for(ParamDeclList::const_iterator q = outParams.begin(); q != outParams.end(); ++q)
+    {
+        futureTypes.push_back(typeToString((*q)->type(), (*q)->optional(), (*q)->getMetaData(),
+                                           _useWstring | TypeContextAMIEnd));
+    }
+
+    string futureS;
+    if(futureTypes.empty())
+    {
+        futureS = "void";
+    }
+    else if(futureTypes.size() == 1)
+    {
+        futureS = futureTypes.front();
+    }
+    else
+    {
+        futureS = "::std::tuple<";
+        for(vector<string>::const_iterator q = futureTypes.begin(); q != futureTypes.end(); ++q)
+        {
+            if(q != futureTypes.begin())
+            {
+                futureS += ", ";
+            }
+            futureS += *q;
+        }
+        futureS += ">";
+    }
+    string promiseCallbackS = "::IceInternal::Cpp11PromiseCallback< " + futureS + ">";
+
+    //
+    // COMPILERFIX VC compilers up to VC110 don't support std::tuple with more than 5 types
+    // by default due to lack of variadic templates.
+    //
+    if(futureTypes.size() > 5)
+    {
+        H.zeroIndent();
+        H << nl << "#if !defined(_MSC_VER) || _MSC_VER > 1700";
+        H.restoreIndent();
+    }
+
+    H << sp << nl << "::std::future< " << futureS << "> " << name << "Async" << spar << paramsDeclAMI << epar;
+    H << sb;
+    H << nl << "return __" << name << "Async" << spar << argsAMI << "0" << epar << ';';
+    H << eb;
+
+    H << sp << nl << "::std::future< " << futureS << "> " << name << "Async" << spar << paramsDeclAMI
+      << "const ::Ice::Context& __ctx" << epar;
+    H << sb;
+    H << nl << "return __" << name << "Async" << spar << argsAMI << "&__ctx" << epar << ';';
+    H << eb;
+
+    H << nl;
+    H.dec();
+    H << nl << "private:";
+    H.inc();
+
+    H << sp << nl << "::std::future< " << futureS << "> __" << name << "Async" << spar << paramsDeclAMI
+      << "const ::Ice::Context* __ctx" << epar;
+    H << sb;
+    if(p->returnsData())
+    {
+        H << nl << "class Cpp11PromiseCB : public " << promiseCallbackS;
+        H << sb;
+        H.dec();
+        H << nl << "public:";
+        H.inc();
+        H << sp << nl << "virtual void __completed(const ::Ice::AsyncResultPtr& __result) const";
+        H << sb;
+        H << nl << clScope << clName << "Prx __proxy = " << clScope << clName
+          << "Prx::uncheckedCast(__result->getProxy());";
+        vector<string> futureArgs;
+        vector<string>::const_iterator t = futureTypes.begin();
+        if(ret)
+        {
+            H << nl << *t++ << " __ret;";
+            futureArgs.push_back("__ret");
+        }
+        for(vector<string>::const_iterator q = outParamNamesAMI.begin(); q != outParamNamesAMI.end(); ++q)
+        {
+            H << nl << *t++ << ' ' << *q << ';';
+            futureArgs.push_back(*q);
+        }
+        H << nl << "try";
+        H << sb;
+        H << nl;
+        if(ret)
+        {
+            H << "__ret = ";
+        }
+        H << "__proxy->end_" << p->name() << spar << outParamNamesAMI << "__result" << epar << ';';
+        H << eb;
+        H << nl << "catch(const ::Ice::Exception& ex)";
+        H << sb;
+        H << nl << "this->__exception(ex);";
+        H << nl << "return;";
+        H << eb;
+        if(futureArgs.size() == 1)
+        {
+            H << nl << "this->_promise.set_value(::std::move(" << futureArgs.front() << "));";
+        }
+        else
+        {
+            H << nl << "this->_promise.set_value(::std::make_tuple" << spar;
+            for(vector<string>::const_iterator q = futureArgs.begin(); q != futureArgs.end(); ++q)
+            {
+                H << "::std::move(" + *q + ")";
+            }
+            H << epar << ");";
+        }
+        H << nl << "this->__releasePromise();";
+        H << eb;
+        H << eb << ';';
+        H << nl << "::IceUtil::Handle< " << promiseCallbackS << "> __cb = new Cpp11PromiseCB;";
+    }
+    else
+    {
+        //
+        // AMI doesn't support batch requests, the request is queued
+        // with the synchronous method and the returned future is
+        // ready once the request is queued.
+        //
+        H << nl << "if(ice_isBatchOneway() || ice_isBatchDatagram())";
+        H << sb;
+        H << nl << "::std::promise<void> __promise;";
+        H << nl << "try";
+        H << sb;
+        H << nl << fixKwd(name) << spar << argsAMI << "__ctx" << epar << ';';
+        H << nl << "__promise.set_value();";
+        H << eb;
+        H << nl << "catch(...)";
+        H << sb;
+        H << nl << "__promise.set_exception(::std::current_exception());";
+        H << eb;
+        H << nl << "return __promise.get_future();";
+        H << eb;
+        H << nl << "::IceUtil::Handle< " << promiseCallbackS << "> __cb = "
+          << "new ::IceInternal::Cpp11OnewayPromiseCallback;";
+    }
+    H << nl << "::std::future< " << futureS << "> __f = __cb->__getFuture();";
+    H << nl << "try";
+    H << sb;
+    H << nl << "begin_" << name << spar << argsAMI << "__ctx" << "__cb" << "0" << epar << ';';
+    H << eb;
+    H << nl << "catch(...)";
+    H << sb;
+    H << nl << "__cb->__setException(::std::current_exception());";
+    H << eb;
+    H << nl << "return __f;";
+    H << eb;
+
+    H << nl;
+    H.dec();
+    H << nl << "public:";
+    H.inc();
+
+    if(futureTypes.size() > 5)
+    {
+        H.zeroIndent();
+        H << nl << "#endif";
+        H.restoreIndent();
+    }
+
     H.zeroIndent();
     H << nl << "#endif";
     H.restoreIndent();
@@ -3333,8 +3612,10 @@ Slice::Gen::ObjectDeclVisitor::visitOperation(const OperationPtr& p)
     }
 }
 
-Slice::Gen::ObjectVisitor::ObjectVisitor(Output& h, Output& c, const string& dllExport, bool stream) :
-    H(h), C(c), _dllExport(dllExport), _stream(stream), _doneStaticSymbol(false), _useWstring(false)
+Slice::Gen::ObjectVisitor::ObjectVisitor(Output& h, Output& c, const string& dllExport, bool stream,
+                                         bool dispatchHash) :
+    H(h), C(c), _dllExport(dllExport), _stream(stream), _dispatchHash(dispatchHash), _doneStaticSymbol(false),
+    _useWstring(false)
 {
 }
 
@@ -3763,7 +4044,19 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             H << nl
               << "virtual ::Ice::DispatchStatus __dispatch(::IceInternal::Incoming&, const ::Ice::Current&);";
 
+            //
+            // Unless disabled with --no-dispatch-hash, __dispatch()
+            // finds the operation with a perfect hash of the operation
+            // names and a single string comparison instead of a binary
+            // search over the sorted names.
+            //
+            vector<unsigned int> seeds;
+            vector<int> slots;
+            bool dispatchHash = _dispatchHash && computeDispatchHash(allOpNames, seeds, slots);
+
             string flatName = p->flattenedScope() + p->name() + "_all";
+            string seedsName = p->flattenedScope() + p->name() + "_seeds";
+            string slotsName = p->flattenedScope() + p->name() + "_slots";
             C << sp << nl << "namespace";
             C << nl << "{";
             C << nl << "const ::std::string " << flatName << "[] =";
@@ -3778,22 +4071,65 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
                 }
             }
             C << eb << ';';
+
+            if(dispatchHash)
+            {
+                C << sp << nl << "const unsigned int " << seedsName << "[] =";
+                C << sb;
+                for(vector<unsigned int>::const_iterator q = seeds.begin(); q != seeds.end();)
+                {
+                    C << nl << *q;
+                    if(++q != seeds.end())
+                    {
+                        C << ',';
+                    }
+                }
+                C << eb << ';';
+
+                C << sp << nl << "const int " << slotsName << "[] =";
+                C << sb;
+                for(vector<int>::const_iterator q = slots.begin(); q != slots.end();)
+                {
+                    C << nl << *q;
+                    if(++q != slots.end())
+                    {
+                        C << ',';
+                    }
+                }
+                C << eb << ';';
+            }
             C << sp << nl << "}";
             C << sp;
             C << nl << "::Ice::DispatchStatus" << nl << scoped.substr(2)
               << "::__dispatch(::IceInternal::Incoming& in, const ::Ice::Current& current)";
             C << sb;
 
-            C << nl << "::std::pair< const ::std::string*, const ::std::string*> r = "
-              << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-              << ", current.operation);";
-            C << nl << "if(r.first == r.second)";
-            C << sb;
-            C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
-              << "current.facet, current.operation);";
-            C << eb;
-            C << sp;
-            C << nl << "switch(r.first - " << flatName << ')';
+            if(dispatchHash)
+            {
+                C << nl << "unsigned int h = ::IceInternal::dispatchHash(current.operation);";
+                C << nl << "int pos = " << slotsName << "[::IceInternal::dispatchSlot(h, " << seedsName << "[h & "
+                  << seeds.size() - 1 << "]) & " << slots.size() - 1 << "];";
+                C << nl << "if(pos < 0 || " << flatName << "[pos] != current.operation)";
+                C << sb;
+                C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
+                  << "current.facet, current.operation);";
+                C << eb;
+                C << sp;
+                C << nl << "switch(pos)";
+            }
+            else
+            {
+                C << nl << "::std::pair< const ::std::string*, const ::std::string*> r = "
+                  << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
+                  << ", current.operation);";
+                C << nl << "if(r.first == r.second)";
+                C << sb;
+                C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
+                  << "current.facet, current.operation);";
+                C << eb;
+                C << sp;
+                C << nl << "switch(r.first - " << flatName << ')';
+            }
             C << sb;
             int i = 0;
             for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -6408,7 +6744,8 @@ Slice::Gen::MetaDataVisitor::visitOperation(const OperationPtr& p)
         {
             for(StringList::const_iterator q = metaData.begin(); q != metaData.end(); ++q)
             {
-                if(q->find("cpp:type:", 0) == 0 || q->find("cpp:array", 0) == 0 || q->find("cpp:range", 0) == 0)
+                if(q->find("cpp:type:", 0) == 0 || q->find("cpp:array", 0) == 0 || q->find("cpp:range", 0) == 0 ||
+                   *q == "cpp:view")
                 {
                     emitWarning(p->file(), p->line(), "ignoring invalid metadata `" + *q +
                                 "' for operation with void return type");
@@ -6490,6 +6827,17 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
                     {
                         continue;
                     }
+                    if(ss == "view")
+                    {
+                        if(isViewableSequence(SequencePtr::dynamicCast(cont)))
+                        {
+                            continue;
+                        }
+                        emitWarning(file, line, "ignoring invalid metadata `" + s + 
+                                    "': only sequences of primitive types can be mapped to views");
+                        _history.insert(s);
+                        continue;
+                    }
                 }
                 if(DictionaryPtr::dynamicCast(cont) && ss.find("type:") == 0) 
                 {
@@ -31,6 +31,7 @@ public:
         bool,
         bool,
         bool,
+        bool,
         bool);
     ~Gen();
 
@@ -70,6 +71,7 @@ private:
     bool _checksum;
     bool _stream;
     bool _ice;
+    bool _dispatchHash;
 
     class TypesVisitor : private ::IceUtil::noncopyable, public ParserVisitor
     {
@@ -241,7 +243,7 @@ private:
     {
     public:
 
-        ObjectVisitor(::IceUtilInternal::Output&, ::IceUtilInternal::Output&, const std::string&, bool);
+        ObjectVisitor(::IceUtilInternal::Output&, ::IceUtilInternal::Output&, const std::string&, bool, bool);
 
         virtual bool visitModuleStart(const ModulePtr&);
         virtual void visitModuleEnd(const ModulePtr&);
@@ -266,6 +268,7 @@ private:
 
         std::string _dllExport;
         bool _stream;
+        bool _dispatchHash;
         bool _doneStaticSymbol;
         int _useWstring;
         std::list<int> _useWstringHist;
@@ -79,6 +79,7 @@ usage(const char* n)
         "--underscore             Permit underscores in Slice identifiers.\n"
         "--checksum               Generate checksums for Slice definitions.\n"
         "--stream                 Generate marshaling support for public stream API.\n"
+        "--no-dispatch-hash       Dispatch operations with a binary search instead of a perfect hash.\n"
         ;
 }
 
@@ -106,6 +107,7 @@ compile(int argc, char* argv[])
     opts.addOpt("", "underscore");
     opts.addOpt("", "checksum");
     opts.addOpt("", "stream");
+    opts.addOpt("", "no-dispatch-hash");
 
     vector<string> args;
     try
@@ -178,6 +180,8 @@ compile(int argc, char* argv[])
 
     bool stream = opts.isSet("stream");
 
+    bool dispatchHash = !opts.isSet("no-dispatch-hash");
+
     if(args.empty())
     {
         getErrorStream() << argv[0] << ": error: no input file" << endl;
@@ -276,7 +280,8 @@ compile(int argc, char* argv[])
                     try
                     {
                         Gen gen(icecpp->getBaseName(), headerExtension, sourceExtension, extraHeaders, include,
-                                includePaths, dllExport, output, impl, checksum, stream, ice);
+                                includePaths, dllExport, output, impl, checksum, stream, ice,
+                                dispatchHash);
                         gen.generate(u);
                     }
                     catch(const Slice::FileException& ex)
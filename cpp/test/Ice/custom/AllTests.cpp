@@ -1558,6 +1558,52 @@ public:
 };
 typedef IceUtil::Handle<Callback> CallbackPtr;
 
+//
+// The cookie of an invocation is released with its AsyncResult.
+//
+class ViewCookie : public Ice::LocalObject
+{
+public:
+
+    ViewCookie(bool& destroyed, IceUtil::Monitor<IceUtil::Mutex>& monitor) :
+        _destroyed(destroyed), _monitor(monitor)
+    {
+    }
+
+    ~ViewCookie()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _destroyed = true;
+        _monitor.notify();
+    }
+
+private:
+
+    bool& _destroyed;
+    IceUtil::Monitor<IceUtil::Mutex>& _monitor;
+};
+
+//
+// Keeps the views unmarshaled from the reply, the AsyncResult holds
+// this callback.
+//
+class ViewCallback : public CallbackBase, public IceUtil::Shared
+{
+public:
+
+    void
+    completed(const Ice::AsyncResultPtr& r)
+    {
+        Test::TestIntfPrx t = Test::TestIntfPrx::uncheckedCast(r->getProxy());
+        ret = t->end_opViewStruct(out, r);
+        called();
+    }
+
+    Test::ViewStruct ret;
+    Test::ViewStruct out;
+};
+typedef IceUtil::Handle<ViewCallback> ViewCallbackPtr;
+
 Test::TestIntfPrx
 allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
 {
@@ -4637,6 +4683,109 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
 #endif
     }
 
+    cout << "testing sequence views... " << flush;
+    {
+        Test::DoubleSeq doubles(1000);
+        for(size_t i = 0; i < doubles.size(); ++i)
+        {
+            doubles[i] = static_cast<Ice::Double>(i) / 3;
+        }
+        Test::ByteSeq bytes(257);
+        for(size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = static_cast<Ice::Byte>(i);
+        }
+
+        Test::ViewStruct vs;
+        vs.doubles = Ice::SequenceView<Ice::Double>(&doubles[0], &doubles[0] + doubles.size());
+        test(!vs.doubles.detached());
+        test(vs.doubles.size() == doubles.size() && vs.doubles[999] == doubles[999]);
+        vs.bytes = Ice::SequenceView<Ice::Byte>(&bytes[0], &bytes[0] + bytes.size());
+        vs.nested.push_back(Test::DoubleView(&doubles[0], &doubles[0] + 10));
+        vs.nested.push_back(Test::DoubleView());
+        vs.tag = 5;
+
+        Test::ViewStruct outS;
+        Test::ViewStruct retS = t->opViewStruct(vs, outS);
+        test(retS == vs);
+        test(outS == vs);
+        test(retS.doubles.toVector() == doubles);
+        test(retS.nested[1].empty());
+
+        //
+        // The reply of a synchronous invocation isn't kept alive, the
+        // views hold a copy of the elements.
+        //
+        if(!collocated)
+        {
+            test(retS.doubles.detached());
+            test(outS.bytes.detached());
+        }
+
+        Test::ViewStruct copy = retS;
+        copy.doubles.detach();
+        test(copy == vs);
+
+        Test::ViewClassPtr vc = new Test::ViewClass;
+        vc->doubles = vs.doubles;
+        vc->s = vs;
+        Test::ViewClassPtr outC;
+        Test::ViewClassPtr retC = t->opViewClass(vc, outC);
+        test(retC->doubles == vc->doubles);
+        test(retC->s == vs);
+        test(outC->s.nested == vs.nested);
+
+        if(!collocated)
+        {
+            //
+            // The views unmarshaled from an asynchronous reply reference
+            // the reply buffer and keep it alive once the AsyncResult is
+            // released.
+            //
+            Ice::AsyncResultPtr r = t->begin_opViewStruct(vs);
+            retS = t->end_opViewStruct(outS, r);
+            r = 0;
+            test(retS == vs);
+            test(outS == vs);
+            test(!retS.doubles.detached());
+            test(!outS.nested[0].detached());
+
+            r = t->begin_opViewClass(vc);
+            retC = t->end_opViewClass(outC, r);
+            r = 0;
+            test(retC->doubles == vc->doubles);
+            test(outC->s == vs);
+
+            Ice::SequenceView<Ice::Double> view = retC->doubles;
+            retC = 0;
+            outC = 0;
+            test(view.toVector() == doubles);
+
+            //
+            // The views only keep the reply buffer alive, not the
+            // AsyncResult: a callback holding views of the reply doesn't
+            // create a cycle with the AsyncResult.
+            //
+            IceUtil::Monitor<IceUtil::Mutex> monitor;
+            bool destroyed = false;
+            ViewCallbackPtr cb = new ViewCallback;
+            t->begin_opViewStruct(vs, Ice::newCallback(cb, &ViewCallback::completed),
+                                  new ViewCookie(destroyed, monitor));
+            cb->check();
+            {
+                IceUtil::Monitor<IceUtil::Mutex>::Lock sync(monitor);
+                while(!destroyed)
+                {
+                    test(monitor.timedWait(IceUtil::Time::seconds(30)));
+                }
+            }
+            test(cb->ret == vs);
+            test(cb->out == vs);
+            test(!cb->ret.doubles.detached());
+        }
+    }
+    cout << "ok" << endl;
+
     cout << "testing wstring... " << flush;
 
     Test1::WstringSeq wseq1;
@@ -350,6 +350,25 @@ TestIntfI::opBufferStruct_async(const ::Test::AMD_TestIntf_opBufferStructPtr& cb
     cb->ice_response(s);
 }
 
+void 
+TestIntfI::opViewStruct_async(const ::Test::AMD_TestIntf_opViewStructPtr& cb,
+                              const Test::ViewStruct& s, const Ice::Current&)
+{
+    //
+    // The views reference the request buffer, which is only valid
+    // until the dispatch returns. The response is sent before that,
+    // so there's no need to detach them here.
+    //
+    cb->ice_response(s, s);
+}
+
+void 
+TestIntfI::opViewClass_async(const ::Test::AMD_TestIntf_opViewClassPtr& cb,
+                             const Test::ViewClassPtr& c, const Ice::Current&)
+{
+    cb->ice_response(c, c);
+}
+
 void
 TestIntfI::shutdown_async(const Test::AMD_TestIntf_shutdownPtr& shutdownCB,
                           const Ice::Current&)
@@ -168,6 +168,12 @@ public:
     void opBufferStruct_async(const ::Test::AMD_TestIntf_opBufferStructPtr&, const Test::BufferStruct&,
                               const Ice::Current&);
 
+    void opViewStruct_async(const ::Test::AMD_TestIntf_opViewStructPtr&, const Test::ViewStruct&,
+                            const Ice::Current&);
+
+    void opViewClass_async(const ::Test::AMD_TestIntf_opViewClassPtr&, const Test::ViewClassPtr&,
+                           const Ice::Current&);
+
     virtual void shutdown_async(const Test::AMD_TestIntf_shutdownPtr&,
                                 const Ice::Current&);
 
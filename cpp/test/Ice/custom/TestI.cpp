@@ -378,6 +378,20 @@ TestIntfI::opBufferStruct(const Test::BufferStruct& bs, const Ice::Current&)
     return bs;
 }
 
+Test::ViewStruct
+TestIntfI::opViewStruct(const Test::ViewStruct& inS, Test::ViewStruct& outS, const Ice::Current&)
+{
+    outS = inS;
+    return inS;
+}
+
+Test::ViewClassPtr
+TestIntfI::opViewClass(const Test::ViewClassPtr& inC, Test::ViewClassPtr& outC, const Ice::Current&)
+{
+    outC = inC;
+    return inC;
+}
+
 void
 TestIntfI::shutdown(const Ice::Current&)
 {
@@ -178,6 +178,10 @@ public:
 
     Test::BufferStruct opBufferStruct(const Test::BufferStruct&, const Ice::Current&);
 
+    Test::ViewStruct opViewStruct(const Test::ViewStruct&, Test::ViewStruct&, const Ice::Current&);
+
+    Test::ViewClassPtr opViewClass(const Test::ViewClassPtr&, Test::ViewClassPtr&, const Ice::Current&);
+
     virtual void shutdown(const Ice::Current&);
 
 private:
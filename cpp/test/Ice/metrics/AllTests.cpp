@@ -833,6 +833,38 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
 
     cout << "ok" << endl;
 
+    cout << "testing latency histograms... " << flush;
+
+    test(!dm1->histogram);
+
+    props["IceMX.Metrics.View.Map.Dispatch.Histogram"] = "2";
+    updateProps(clientProps, serverProps, update, props, "Dispatch");
+    for(int i = 0; i < 10; ++i)
+    {
+        metrics->op();
+    }
+
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    dm1 = IceMX::DispatchMetricsPtr::dynamicCast(map["op"]);
+    test(dm1->total == 10 && dm1->histogram);
+    {
+        Ice::Long count = 0;
+        for(IceMX::LatencyHistogram::const_iterator p = dm1->histogram->begin(); p != dm1->histogram->end(); ++p)
+        {
+            test(p->first >= 0 && p->second > 0);
+            count += p->second;
+        }
+        test(count == dm1->total - dm1->current);
+    }
+
+    props.erase("IceMX.Metrics.View.Map.Dispatch.Histogram");
+    updateProps(clientProps, serverProps, update, props, "Dispatch");
+    metrics->op();
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    test(!IceMX::DispatchMetricsPtr::dynamicCast(map["op"])->histogram);
+
+    cout << "ok" << endl;
+
     cout << "testing invocation metrics... " << flush;
 
     props["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "operation";
@@ -1048,6 +1080,119 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
 
     cout << "ok" << endl;
 
+    if(communicator->getProperties()->getPropertyAsInt("Ice.BufferPool") > 0)
+    {
+        cout << "testing buffer pool metrics... " << flush;
+
+        props.clear();
+        updateProps(clientProps, serverProps, update, props, "BufferPool");
+        clientMetrics->enableMetricsView("View");
+
+        metrics->ice_ping();
+        metrics->opByteS(Test::ByteSeq(100000));
+
+        IceMX::MetricsAdminPrx admins[] = { clientMetrics, serverMetrics };
+        for(int i = 0; i < 2; ++i)
+        {
+            IceMX::MetricsMap map = admins[i]->getMetricsView("View", timestamp)["BufferPool"];
+            test(!map.empty());
+            Ice::Long hits = 0;
+            Ice::Long misses = 0;
+            for(IceMX::MetricsMap::const_iterator p = map.begin(); p != map.end(); ++p)
+            {
+                IceMX::BufferPoolMetricsPtr m = IceMX::BufferPoolMetricsPtr::dynamicCast(*p);
+                test(m && m->total == m->hits + m->misses);
+                hits += m->hits;
+                misses += m->misses;
+            }
+            test(hits > 0 && misses > 0);
+        }
+
+        cout << "ok" << endl;
+    }
+
+#ifndef ICE_OS_WINRT
+    cout << "testing host resolver metrics... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties();
+        initData.properties->setProperty("Ice.HostResolver.Size", "2");
+        initData.properties->setProperty("Ice.HostResolver.CacheTTL", "60");
+        initData.properties->setProperty("Ice.HostResolver.NegativeCacheTTL", "60");
+        initData.properties->setProperty("IceMX.Metrics.View.GroupBy", "none");
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+        IceMX::MetricsAdminPtr admin = IceMX::MetricsAdminPtr::dynamicCast(com->findAdminFacet("Metrics"));
+        test(admin);
+
+        Ice::ObjectPrx prx = com->stringToProxy("metrics:tcp -p 12010 -h localhost");
+        prx->ice_ping();
+        prx->ice_connectionId("Con1")->ice_ping();
+        prx->ice_connectionId("Con2")->ice_ping();
+
+        IceMX::MetricsMap map = admin->getMetricsView("View", timestamp)["HostResolver"];
+        test(map.size() == 1);
+        IceMX::HostResolverMetricsPtr m = IceMX::HostResolverMetricsPtr::dynamicCast(map[0]);
+        test(m && m->lookups == 1 && m->misses == 1 && m->hits == 2 && m->total == 3 && m->current == 0);
+        test(m->lookupTime >= m->maxLookupTime && m->maxLookupTime >= 0);
+
+        for(int i = 0; i < 2; ++i)
+        {
+            try
+            {
+                com->stringToProxy("test:tcp -t 500 -p 12010 -h unknownfoo.zeroc.com")->ice_ping();
+                test(false);
+            }
+            catch(const Ice::LocalException&)
+            {
+                // Some DNS servers don't fail on unknown DNS names.
+            }
+        }
+
+        m = IceMX::HostResolverMetricsPtr::dynamicCast(admin->getMetricsView("View", timestamp)["HostResolver"][0]);
+        test(m->lookups == 2 && m->misses == 2 && m->hits > 2 && m->total == m->hits + m->misses);
+
+        com->destroy();
+    }
+    cout << "ok" << endl;
+#endif
+
+    cout << "testing connection monitor metrics... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties();
+        initData.properties->setProperty("Ice.ACM.Client", "1");
+        initData.properties->setProperty("Ice.MonitorConnections", "1");
+        initData.properties->setProperty("IceMX.Metrics.View.GroupBy", "none");
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+        IceMX::MetricsAdminPtr admin = IceMX::MetricsAdminPtr::dynamicCast(com->findAdminFacet("Metrics"));
+        test(admin);
+
+        Ice::ObjectPrx prx = com->stringToProxy("metrics:tcp -p 12010 -h localhost");
+        prx->ice_ping();
+
+        IceMX::MetricsMap map = admin->getMetricsView("View", timestamp)["ConnectionMonitor"];
+        test(map.size() == 1);
+        IceMX::ConnectionMonitorMetricsPtr m = IceMX::ConnectionMonitorMetricsPtr::dynamicCast(map[0]);
+        test(m && m->current == 1);
+
+        //
+        // The idle connection is closed by ACM after a few runs of the
+        // monitor.
+        //
+        int nRetry = 50;
+        while(m->current > 0 && --nRetry > 0)
+        {
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+            map = admin->getMetricsView("View", timestamp)["ConnectionMonitor"];
+            m = IceMX::ConnectionMonitorMetricsPtr::dynamicCast(map[0]);
+        }
+        test(m->current == 0 && m->total > 0 && m->checks > 0);
+        test(m->runTime >= m->maxRunTime && m->maxRunTime >= 0);
+
+        com->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing instrumentation observer delegate... " << flush;
 
     test(obsv->threadObserver->getTotal() > 0);
@@ -83,6 +83,7 @@ public:
         ObserverI::reset();
         received = 0;
         sent = 0;
+        queued = 0;
     }
 
     virtual void 
@@ -98,9 +99,17 @@ public:
         IceUtil::Mutex::Lock sync(*this);
         received += s;
     }
+
+    virtual void 
+    queuedBytes(Ice::Int s)
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        queued += s;
+    }
     
     Ice::Int sent;
     Ice::Int received;
+    Ice::Int queued;
 };
 
 class ThreadObserverI : public Ice::Instrumentation::ThreadObserver, public ObserverI
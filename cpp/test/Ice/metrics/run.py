@@ -24,3 +24,5 @@ print("tests with regular server.")
 TestUtil.clientServerTest()
 print("tests with AMD server.")
 TestUtil.clientServerTest(server = "serveramd")
+print("tests with buffer pool.")
+TestUtil.clientServerTest(additionalClientOptions = "--Ice.BufferPool=1", additionalServerOptions = "--Ice.BufferPool=1")
@@ -63,6 +63,28 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
         batchOneways(cl);
         batchOneways(derived);
         cout << "ok" << endl;
+
+        cout << "testing coalesced twoway operations... " << flush;
+        {
+            Test::MyClassPrx p = cl->ice_coalesce(true);
+            test(p->ice_isCoalesce());
+            twowaysNewAMI(communicator, p);
+
+            vector<Ice::AsyncResultPtr> results;
+            for(int i = 0; i < 100; ++i)
+            {
+                results.push_back(p->begin_opShortIntLong(static_cast<Ice::Short>(i), i, i));
+            }
+            for(int i = 0; i < 100; ++i)
+            {
+                Ice::Short s;
+                Ice::Int n;
+                Ice::Long l;
+                test(p->end_opShortIntLong(s, n, l, results[i]) == i);
+                test(s == i && n == i && l == i);
+            }
+        }
+        cout << "ok" << endl;
     }
 
     return cl;
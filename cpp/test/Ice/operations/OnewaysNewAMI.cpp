@@ -235,5 +235,41 @@ onewaysNewAMI(const Ice::CommunicatorPtr&, const Test::MyClassPrx& proxy)
         {
         }
     }
+
+    {
+        p->opVoidAsync().get();
+        p->opIdempotentAsync().get();
+    }
+
+    {
+        std::future<std::tuple<Ice::Byte, Ice::Byte> > f = p->opByteAsync(Ice::Byte(0xff), Ice::Byte(0x0f));
+        try
+        {
+            f.get();
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+        }
+    }
+
+    {
+        Test::MyClassPrx b = p->ice_batchOneway();
+        std::future<void> f = b->opVoidAsync();
+        test(f.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        f.get();
+        b->opIdempotentAsync().get();
+        b->ice_flushBatchRequests();
+
+        std::future<std::tuple<Ice::Byte, Ice::Byte> > g = b->opByteAsync(Ice::Byte(0xff), Ice::Byte(0x0f));
+        try
+        {
+            g.get();
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+        }
+    }
 #endif
 }
@@ -1554,5 +1554,49 @@ twowaysNewAMI(const Ice::CommunicatorPtr& communicator, const Test::MyClassPrx&
                                  [=](const Ice::Exception& ex){ cb->exCB(ex); });
         cb->check();
     }
+
+    {
+        p->opVoidAsync().get();
+
+        std::tuple<Ice::Byte, Ice::Byte> r = p->opByteAsync(Ice::Byte(0xff), Ice::Byte(0x0f)).get();
+        test(std::get<0>(r) == Ice::Byte(0xff));
+        test(std::get<1>(r) == Ice::Byte(0xf0));
+
+        std::tuple<Ice::Long, Ice::Short, Ice::Int, Ice::Long> r2 = p->opShortIntLongAsync(10, 11, 12).get();
+        test(std::get<0>(r2) == 12);
+        test(std::get<1>(r2) == 10);
+        test(std::get<2>(r2) == 11);
+        test(std::get<3>(r2) == 12);
+
+        Ice::Context ctx;
+        ctx["one"] = "ONE";
+        test(p->opContextAsync(ctx).get() == ctx);
+    }
+
+    {
+        //
+        // Dependent calls, each call uses the result of the previous one.
+        //
+        std::future<std::tuple<std::string, std::string> > f = p->opStringAsync("hello", "world");
+        std::string s = std::get<0>(f.get());
+        f = p->opStringAsync(s, "again");
+        std::tuple<std::string, std::string> r = f.get();
+        test(std::get<0>(r) == "hello world again");
+        test(std::get<1>(r) == "again hello world");
+    }
+
+    {
+        Test::MyClassPrx q = Test::MyClassPrx::uncheckedCast(
+            p->ice_identity(communicator->stringToIdentity("noSuchIdentity")));
+        std::future<void> f = q->opVoidAsync();
+        try
+        {
+            f.get();
+            test(false);
+        }
+        catch(const Ice::ObjectNotExistException&)
+        {
+        }
+    }
 #endif
 }
@@ -24,5 +24,12 @@ print("tests with regular server.")
 TestUtil.clientServerTest(additionalClientOptions = "--Ice.Warn.AMICallback=0")
 print("tests with AMD server.")
 TestUtil.clientServerTest(additionalClientOptions = "--Ice.Warn.AMICallback=0", server = "serveramd")
+print("tests with reactor thread pools.")
+TestUtil.clientServerTest(additionalClientOptions = "--Ice.Warn.AMICallback=0 --Ice.ThreadPool.Client.Reactors=2",
+                          additionalServerOptions = "--Ice.ThreadPool.Server.Reactors=4")
+print("tests with compression.")
+TestUtil.clientServerTest(additionalClientOptions = "--Ice.Warn.AMICallback=0 --Ice.Override.Compress=1 " +
+                                                    "--Ice.Compression.MinSize=0 --Ice.Compression.MaxRatio=1000",
+                          additionalServerOptions = "--Ice.Compression.MinSize=0 --Ice.Compression.MaxRatio=1000")
 print("tests with collocated server.")
 TestUtil.collocatedTest()
@@ -341,6 +341,13 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(!b1->ice_isCollocationOptimized());
     prop->setProperty(property, "");
 
+    property = propertyPrefix + ".Coalesce";
+    test(!b1->ice_isCoalesce());
+    prop->setProperty(property, "1");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_isCoalesce());
+    prop->setProperty(property, "");
+
     cout << "ok" << endl;
 
     cout << "testing proxyToProperty... " << flush;
@@ -377,6 +384,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(proxyProps["Test.CollocationOptimized"] == "1");
     test(proxyProps["Test.ConnectionCached"] == "1");
     test(proxyProps["Test.PreferSecure"] == "0");
+    test(proxyProps.find("Test.Coalesce") == proxyProps.end());
     test(proxyProps["Test.EndpointSelection"] == "Ordered");
     test(proxyProps["Test.LocatorCacheTimeout"] == "100");
 
@@ -394,6 +402,10 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(proxyProps["Test.Locator.Router.EndpointSelection"] == "Random");
     test(proxyProps["Test.Locator.Router.LocatorCacheTimeout"] == "200");
 
+    proxyProps = communicator->proxyToProperty(b1->ice_coalesce(true), "Test");
+    test(proxyProps.size() == 19);
+    test(proxyProps["Test.Coalesce"] == "1");
+
     cout << "ok" << endl;
 
     cout << "testing ice_getCommunicator... " << flush;
@@ -416,6 +428,8 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(!base->ice_collocationOptimized(false)->ice_isCollocationOptimized());
     test(base->ice_preferSecure(true)->ice_isPreferSecure());
     test(!base->ice_preferSecure(false)->ice_isPreferSecure());
+    test(base->ice_coalesce(true)->ice_isCoalesce());
+    test(!base->ice_coalesce(false)->ice_isCoalesce());
     test(base->ice_encodingVersion(Ice::Encoding_1_0)->ice_getEncodingVersion() == Ice::Encoding_1_0);
     test(base->ice_encodingVersion(Ice::Encoding_1_1)->ice_getEncodingVersion() == Ice::Encoding_1_1);
     test(base->ice_encodingVersion(Ice::Encoding_1_0)->ice_getEncodingVersion() != Ice::Encoding_1_1);
@@ -518,6 +532,11 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(compObj->ice_preferSecure(true) != compObj->ice_preferSecure(false));
     test(compObj->ice_preferSecure(false) < compObj->ice_preferSecure(true));
     test(!(compObj->ice_preferSecure(true) < compObj->ice_preferSecure(false)));
+
+    test(compObj->ice_coalesce(true) == compObj->ice_coalesce(true));
+    test(compObj->ice_coalesce(true) != compObj->ice_coalesce(false));
+    test(compObj->ice_coalesce(false) < compObj->ice_coalesce(true));
+    test(!(compObj->ice_coalesce(true) < compObj->ice_coalesce(false)));
     
     Ice::ObjectPrx compObj1 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10000");
     Ice::ObjectPrx compObj2 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10001");
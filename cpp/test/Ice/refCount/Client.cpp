@@ -0,0 +1,209 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/IceUtil.h>
+#include <TestCommon.h>
+
+using namespace std;
+
+DEFINE_TEST("client")
+
+namespace
+{
+
+const int threadCount = 16;
+const int iterations = 100000;
+
+class Counted : public IceUtil::Shared
+{
+public:
+
+    Counted(int& destroyed) : _destroyed(destroyed)
+    {
+    }
+
+    ~Counted()
+    {
+        ++_destroyed;
+    }
+
+private:
+
+    int& _destroyed;
+};
+typedef IceUtil::Handle<Counted> CountedPtr;
+
+class Servant : public Ice::Object
+{
+};
+
+//
+// Each thread copies and releases the given handle in a loop, the
+// threads start together to maximize contention on the count.
+//
+template<typename T> class CopyThread : public IceUtil::Thread
+{
+public:
+
+    CopyThread(const T& handle, IceUtilInternal::CountDownLatch& latch) : _handle(handle), _latch(latch)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _latch.await();
+        for(int i = 0; i < iterations; ++i)
+        {
+            T h1 = _handle;
+            T h2 = h1;
+            h1 = 0;
+        }
+    }
+
+private:
+
+    const T _handle;
+    IceUtilInternal::CountDownLatch& _latch;
+};
+
+class FindThread : public IceUtil::Thread
+{
+public:
+
+    FindThread(const Ice::ObjectAdapterPtr& adapter, const Ice::Identity& id,
+               IceUtilInternal::CountDownLatch& latch) :
+        _adapter(adapter), _id(id), _latch(latch)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _latch.await();
+        for(int i = 0; i < iterations; ++i)
+        {
+            test(_adapter->find(_id));
+        }
+    }
+
+private:
+
+    const Ice::ObjectAdapterPtr _adapter;
+    const Ice::Identity _id;
+    IceUtilInternal::CountDownLatch& _latch;
+};
+
+//
+// Run the given threads and print the time of each operation in
+// nanoseconds. The operation count is the number of iterations of
+// all the threads.
+//
+void
+runThreads(const vector<IceUtil::ThreadPtr>& threads, IceUtilInternal::CountDownLatch& latch)
+{
+    vector<IceUtil::ThreadControl> controls;
+    for(vector<IceUtil::ThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+    {
+        controls.push_back((*p)->start());
+    }
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    latch.countDown();
+    for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+    {
+        p->join();
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    cout << elapsed.toMicroSecondsDouble() * 1000 / (static_cast<double>(threads.size()) * iterations) << "ns/op "
+         << flush;
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    try
+    {
+        Ice::CommunicatorPtr communicator = Ice::initialize(argc, argv);
+
+        cout << "testing concurrent reference counting... " << flush;
+        {
+            int destroyed = 0;
+            CountedPtr counted = new Counted(destroyed);
+            test(counted->__getRef() == 1);
+
+            IceUtilInternal::CountDownLatch latch(1);
+            vector<IceUtil::ThreadPtr> threads;
+            for(int i = 0; i < threadCount; ++i)
+            {
+                threads.push_back(new CopyThread<CountedPtr>(counted, latch));
+            }
+            test(counted->__getRef() == threadCount + 1);
+            runThreads(threads, latch);
+            threads.clear();
+
+            test(counted->__getRef() == 1);
+            test(destroyed == 0);
+            counted = 0;
+            test(destroyed == 1);
+        }
+        cout << "ok" << endl;
+
+        cout << "testing concurrent proxy copies... " << flush;
+        {
+            Ice::ObjectPrx proxy = communicator->stringToProxy("test:tcp -p 12010");
+            int count = proxy->__getRef();
+
+            IceUtilInternal::CountDownLatch latch(1);
+            vector<IceUtil::ThreadPtr> threads;
+            for(int i = 0; i < threadCount; ++i)
+            {
+                threads.push_back(new CopyThread<Ice::ObjectPrx>(proxy, latch));
+            }
+            runThreads(threads, latch);
+            threads.clear();
+
+            test(proxy->__getRef() == count);
+        }
+        cout << "ok" << endl;
+
+        cout << "testing concurrent servant lookups... " << flush;
+        {
+            Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+            Ice::ObjectPtr servant = new Servant();
+            Ice::Identity id = communicator->stringToIdentity("servant");
+            adapter->add(servant, id);
+            int count = servant->__getRef();
+
+            IceUtilInternal::CountDownLatch latch(1);
+            vector<IceUtil::ThreadPtr> threads;
+            for(int i = 0; i < threadCount; ++i)
+            {
+                threads.push_back(new FindThread(adapter, id, latch));
+            }
+            runThreads(threads, latch);
+            threads.clear();
+
+            test(servant->__getRef() == count);
+            adapter->destroy();
+        }
+        cout << "ok" << endl;
+
+        communicator->destroy();
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
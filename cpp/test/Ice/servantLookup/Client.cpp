@@ -0,0 +1,328 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/IceUtil.h>
+#include <TestCommon.h>
+
+using namespace std;
+
+DEFINE_TEST("client")
+
+namespace
+{
+
+const int threadCount = 8;
+const int iterations = 500;
+
+//
+// The servants return their name from ice_id(), this shows which
+// servant the adapter found to dispatch a request.
+//
+class Servant : public Ice::Object
+{
+public:
+
+    Servant(const string& name) : _name(name)
+    {
+    }
+
+    virtual const string&
+    ice_id(const Ice::Current&) const
+    {
+        return _name;
+    }
+
+private:
+
+    const string _name;
+};
+
+Ice::Identity
+identity(int i)
+{
+    Ice::Identity id;
+    ostringstream os;
+    os << "servant" << i;
+    id.name = os.str();
+    id.category = i % 2 == 0 ? "even" : "odd";
+    return id;
+}
+
+Ice::ObjectPrx
+proxy(const Ice::CommunicatorPtr& communicator, const Ice::Identity& id)
+{
+    //
+    // Disable collocation optimization to dispatch the requests
+    // through the connection and the servant manager of the adapter.
+    //
+    Ice::ObjectPrx prx = communicator->stringToProxy("dummy:default -p 12010");
+    return prx->ice_identity(id)->ice_collocationOptimized(false);
+}
+
+//
+// Dispatch requests to servants which stay registered, the requests
+// must always reach the right servant while other identities are
+// added and removed.
+//
+class DispatchThread : public IceUtil::Thread
+{
+public:
+
+    DispatchThread(const Ice::CommunicatorPtr& communicator, int stable, unsigned int seed) :
+        _communicator(communicator), _stable(stable), _seed(seed)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        for(int i = 0; i < iterations; ++i)
+        {
+            _seed = _seed * 1103515245 + 12345;
+            Ice::Identity id = identity(static_cast<int>((_seed >> 8) % static_cast<unsigned int>(_stable)));
+            try
+            {
+                test(proxy(_communicator, id)->ice_id() == id.name);
+            }
+            catch(const Ice::Exception& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+        }
+    }
+
+private:
+
+    const Ice::CommunicatorPtr _communicator;
+    const int _stable;
+    unsigned int _seed;
+};
+
+//
+// Add and remove servants, dispatching requests to them while they
+// are registered.
+//
+class RegisterThread : public IceUtil::Thread
+{
+public:
+
+    RegisterThread(const Ice::ObjectAdapterPtr& adapter, int first, int count) :
+        _adapter(adapter), _first(first), _count(count)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        Ice::CommunicatorPtr communicator = _adapter->getCommunicator();
+        for(int i = 0; i < iterations; ++i)
+        {
+            Ice::Identity id = identity(_first + i % _count);
+            try
+            {
+                _adapter->add(new Servant(id.name), id);
+                test(proxy(communicator, id)->ice_id() == id.name);
+                _adapter->remove(id);
+                try
+                {
+                    proxy(communicator, id)->ice_ping();
+                    test(false);
+                }
+                catch(const Ice::ObjectNotExistException&)
+                {
+                }
+            }
+            catch(const Ice::Exception& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+        }
+    }
+
+private:
+
+    const Ice::ObjectAdapterPtr _adapter;
+    const int _first;
+    const int _count;
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        initData.properties->setProperty("TestAdapter.Endpoints", "default -p 12010");
+        initData.properties->setProperty("Ice.ThreadPool.Server.Size", "4");
+        initData.properties->setProperty("Ice.Warn.Dispatch", "0");
+        Ice::CommunicatorPtr communicator = Ice::initialize(argc, argv, initData);
+
+        //
+        // The servants are spread over the shards of the servant
+        // manager by identity hash, use enough identities to have
+        // servants in every shard.
+        //
+        int count = communicator->getProperties()->getPropertyAsIntWithDefault("Test.Identities", 2000);
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+        adapter->activate();
+
+        cout << "testing servant lookup... " << flush;
+        {
+            for(int i = 0; i < count; ++i)
+            {
+                Ice::Identity id = identity(i);
+                adapter->add(new Servant(id.name), id);
+                if(i % 10 == 0)
+                {
+                    adapter->addFacet(new Servant(id.name + "/facet"), id, "facet");
+                }
+            }
+
+            for(int i = 0; i < count; ++i)
+            {
+                Ice::Identity id = identity(i);
+                Ice::ObjectPrx prx = proxy(communicator, id);
+                test(prx->ice_id() == id.name);
+                if(i % 10 == 0)
+                {
+                    test(prx->ice_facet("facet")->ice_id() == id.name + "/facet");
+                }
+                else
+                {
+                    try
+                    {
+                        prx->ice_facet("facet")->ice_ping();
+                        test(false);
+                    }
+                    catch(const Ice::FacetNotExistException&)
+                    {
+                    }
+                }
+            }
+
+            try
+            {
+                proxy(communicator, identity(count))->ice_ping();
+                test(false);
+            }
+            catch(const Ice::ObjectNotExistException&)
+            {
+            }
+        }
+        cout << "ok" << endl;
+
+        cout << "testing lookup after servant removal... " << flush;
+        {
+            Ice::Identity id = identity(0);
+            adapter->removeFacet(id, "facet");
+            test(proxy(communicator, id)->ice_id() == id.name);
+            try
+            {
+                proxy(communicator, id)->ice_facet("facet")->ice_ping();
+                test(false);
+            }
+            catch(const Ice::FacetNotExistException&)
+            {
+            }
+
+            adapter->remove(id);
+            try
+            {
+                proxy(communicator, id)->ice_ping();
+                test(false);
+            }
+            catch(const Ice::ObjectNotExistException&)
+            {
+            }
+
+            id = identity(10);
+            adapter->removeAllFacets(id);
+            try
+            {
+                proxy(communicator, id)->ice_facet("facet")->ice_ping();
+                test(false);
+            }
+            catch(const Ice::ObjectNotExistException&)
+            {
+            }
+
+            adapter->add(new Servant(identity(0).name), identity(0));
+            adapter->add(new Servant(identity(10).name), identity(10));
+            test(proxy(communicator, identity(0))->ice_id() == identity(0).name);
+            test(proxy(communicator, identity(10))->ice_id() == identity(10).name);
+        }
+        cout << "ok" << endl;
+
+        cout << "testing default servant fallback... " << flush;
+        {
+            //
+            // identity(even) isn't registered and is in the "even"
+            // category, identity(even + 1) is in the "odd" category.
+            //
+            int even = count + count % 2;
+            adapter->addDefaultServant(new Servant("default"), "even");
+            test(proxy(communicator, identity(even))->ice_id() == "default");
+            test(proxy(communicator, identity(0))->ice_id() == identity(0).name);
+            try
+            {
+                proxy(communicator, identity(even + 1))->ice_ping();
+                test(false);
+            }
+            catch(const Ice::ObjectNotExistException&)
+            {
+            }
+
+            adapter->removeDefaultServant("even");
+            try
+            {
+                proxy(communicator, identity(even))->ice_ping();
+                test(false);
+            }
+            catch(const Ice::ObjectNotExistException&)
+            {
+            }
+        }
+        cout << "ok" << endl;
+
+        cout << "testing servant lookup with concurrent registrations... " << flush;
+        {
+            vector<IceUtil::ThreadControl> threads;
+            for(int i = 0; i < threadCount; ++i)
+            {
+                IceUtil::ThreadPtr thread = new DispatchThread(communicator, count, i);
+                threads.push_back(thread->start());
+            }
+            for(int i = 0; i < threadCount / 2; ++i)
+            {
+                IceUtil::ThreadPtr thread = new RegisterThread(adapter, count + i * 100, 100);
+                threads.push_back(thread->start());
+            }
+            for(vector<IceUtil::ThreadControl>::iterator p = threads.begin(); p != threads.end(); ++p)
+            {
+                p->join();
+            }
+        }
+        cout << "ok" << endl;
+
+        adapter->destroy();
+        communicator->destroy();
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -79,6 +79,69 @@ public:
 };
 typedef IceUtil::Handle<Callback> CallbackPtr;
 
+class WritableCallbackI : public Ice::ConnectionWritableCallback, public CallbackBase
+{
+public:
+
+    virtual void writable(const Ice::ConnectionPtr&)
+    {
+        called();
+    }
+};
+typedef IceUtil::Handle<WritableCallbackI> WritableCallbackIPtr;
+
+class FillQueueCallback : public IceUtil::Shared, public CallbackBase
+{
+public:
+
+    FillQueueCallback(const TimeoutPrx& to, const TimeoutPrx& timeout) :
+        _to(to),
+        _timeout(timeout),
+        _full(false)
+    {
+    }
+
+    void response()
+    {
+        //
+        // The response is dispatched by a thread of the thread pool
+        // of the connection, which can't wait for the send queue to
+        // drain.
+        //
+        _timeout->holdAdapter(1000);
+        ByteSeq seq(1000000);
+        try
+        {
+            for(int i = 0; i < 100; ++i)
+            {
+                _to->sendData(seq);
+            }
+        }
+        catch(const Ice::SendQueueFullException&)
+        {
+            _full = true;
+        }
+        called();
+    }
+
+    void exception(const ::Ice::Exception&)
+    {
+        test(false);
+    }
+
+    bool full() const
+    {
+        return _full;
+    }
+
+private:
+
+    const TimeoutPrx _to;
+    const TimeoutPrx _timeout;
+    bool _full;
+};
+typedef IceUtil::Handle<FillQueueCallback> FillQueueCallbackPtr;
+
 TimeoutPrx
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -373,5 +436,178 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing send queue limits... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.SendQueue.MaxSize", "200000");
+        initData.properties->setProperty("Ice.SendQueue.Policy", "Fail");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        TimeoutPrx to = TimeoutPrx::uncheckedCast(comm->stringToProxy(sref)->ice_oneway());
+        Ice::ConnectionPtr connection = to->ice_getConnection();
+        WritableCallbackIPtr cb = new WritableCallbackI();
+        connection->setWritableCallback(cb);
+        test(connection->isWritable());
+
+        //
+        // Queue oneway requests while the server doesn't read until
+        // the send queue is full.
+        //
+        timeout->holdAdapter(2000);
+        ByteSeq seq(100000);
+        bool full = false;
+        for(int i = 0; i < 1000 && !full; ++i)
+        {
+            Ice::AsyncResultPtr r = to->begin_sendData(seq);
+            if(r->isCompleted())
+            {
+                try
+                {
+                    to->end_sendData(r);
+                }
+                catch(const Ice::SendQueueFullException&)
+                {
+                    full = true;
+                }
+            }
+        }
+        test(full);
+        test(!connection->isWritable());
+
+        //
+        // The callback is called once the server reads again.
+        //
+        cb->check();
+        test(connection->isWritable());
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing send queue block policy... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.SendQueue.MaxMessages", "2");
+        initData.properties->setProperty("Ice.SendQueue.Policy", "Block");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        TimeoutPrx to = TimeoutPrx::uncheckedCast(comm->stringToProxy(sref)->ice_oneway());
+        Ice::ConnectionPtr connection = to->ice_getConnection();
+
+        //
+        // Asynchronous requests can't wait, they fail once the queue
+        // is full.
+        //
+        timeout->holdAdapter(1000);
+        IceUtil::Time start = IceUtil::Time::now();
+        ByteSeq seq(1000000);
+        bool full = false;
+        for(int i = 0; i < 100 && !full; ++i)
+        {
+            Ice::AsyncResultPtr r = to->begin_sendData(seq);
+            if(!connection->isWritable())
+            {
+                r->waitForCompleted();
+                try
+                {
+                    to->end_sendData(r);
+                    test(false);
+                }
+                catch(const Ice::SendQueueFullException&)
+                {
+                    full = true;
+                }
+            }
+        }
+        test(full);
+
+        //
+        // Synchronous requests wait until the server reads again.
+        //
+        to->sendData(seq);
+        test(IceUtil::Time::now() - start > IceUtil::Time::milliSeconds(500));
+        to->ice_twoway()->op();
+        test(connection->isWritable());
+        comm->destroy();
+    }
+    {
+        //
+        // Synchronous requests from a thread of the thread pool of the
+        // connection fail instead of waiting, even if the thread pool
+        // has several threads.
+        //
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.SendQueue.MaxMessages", "2");
+        initData.properties->setProperty("Ice.SendQueue.Policy", "Block");
+        initData.properties->setProperty("Ice.ThreadPool.Client.Size", "2");
+        initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", "4");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        TimeoutPrx to = TimeoutPrx::uncheckedCast(comm->stringToProxy(sref));
+        to->ice_getConnection();
+
+        FillQueueCallbackPtr cb = new FillQueueCallback(to->ice_oneway(), timeout);
+        to->begin_op(newCallback_Timeout_op(cb, &FillQueueCallback::response, &FillQueueCallback::exception));
+        cb->check();
+        test(cb->full());
+        to->op();
+        test(to->ice_getConnection()->isWritable());
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing send queue drop oldest policy... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.SendQueue.MaxMessages", "3");
+        initData.properties->setProperty("Ice.SendQueue.Policy", "DropOldest");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        TimeoutPrx to = TimeoutPrx::uncheckedCast(comm->stringToProxy(sref)->ice_oneway());
+        Ice::ConnectionPtr connection = to->ice_getConnection();
+
+        timeout->holdAdapter(1000);
+        ByteSeq seq(1000000);
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < 10; ++i)
+        {
+            results.push_back(to->begin_sendData(seq));
+        }
+
+        //
+        // Batch request flushes are never dropped.
+        //
+        to->ice_batchOneway()->sendData(seq);
+        Ice::AsyncResultPtr flush = connection->begin_flushBatchRequests();
+        for(int i = 0; i < 10; ++i)
+        {
+            results.push_back(to->begin_sendData(seq));
+        }
+
+        //
+        // The oldest queued requests are dropped to make room for the
+        // newest ones.
+        //
+        int dropped = 0;
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            (*p)->waitForCompleted();
+            try
+            {
+                to->end_sendData(*p);
+            }
+            catch(const Ice::SendQueueFullException&)
+            {
+                test(*p != results.back());
+                ++dropped;
+            }
+        }
+        test(dropped > 0);
+        flush->waitForCompleted();
+        connection->end_flushBatchRequests(flush);
+        to->ice_twoway()->op();
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
     return timeout;
 }
@@ -135,6 +135,35 @@ allTests(const CommunicatorPtr& communicator)
 
     cout << "ok" << endl;
 
+    cout << "testing udp datagram batches... " << flush;
+    {
+        //
+        // The server and the reply adapter read several datagrams
+        // with a single system call and dispatch them as a batch,
+        // send bursts of datagrams to fill several batches.
+        //
+        const int burst = 100;
+        nRetry = 5;
+        while(nRetry-- > 0)
+        {
+            replyI->reset();
+            for(int i = 0; i < burst; ++i)
+            {
+                obj->ping(reply);
+            }
+            ret = replyI->waitReply(burst, IceUtil::Time::seconds(5));
+            if(ret)
+            {
+                break; // Success
+            }
+
+            replyI = new PingReplyI;
+            reply = PingReplyPrx::uncheckedCast(adapter->addWithUUID(replyI))->ice_datagram();
+        }
+        test(ret);
+    }
+    cout << "ok" << endl;
+
     string endpoint;
     if(communicator->getProperties()->getProperty("Ice.IPv6") == "1")
     {
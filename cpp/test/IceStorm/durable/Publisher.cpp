@@ -0,0 +1,132 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/Options.h>
+#include <IceStorm/IceStorm.h>
+#include <Durable.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceStorm;
+using namespace Test;
+
+int
+run(int argc, char* argv[], const CommunicatorPtr& communicator)
+{
+    IceUtilInternal::Options opts;
+    opts.addOpt("", "first", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "events", IceUtilInternal::Options::NeedArg);
+
+    try
+    {
+        opts.parse(argc, (const char**)argv);
+    }
+    catch(const IceUtilInternal::BadOptException& e)
+    {
+        cerr << argv[0] << ": " << e.reason << endl;
+        return EXIT_FAILURE;
+    }
+
+    int first = 0;
+    string s = opts.optArg("first");
+    if(!s.empty())
+    {
+        first = atoi(s.c_str());
+    }
+
+    int events = 1000;
+    s = opts.optArg("events");
+    if(!s.empty())
+    {
+        events = atoi(s.c_str());
+    }
+    if(events <= 0)
+    {
+        cerr << argv[0] << ": events must be > 0." << endl;
+        return EXIT_FAILURE;
+    }
+
+    PropertiesPtr properties = communicator->getProperties();
+    const char* managerProxyProperty = "IceStormAdmin.TopicManager.Default";
+    string managerProxy = properties->getProperty(managerProxyProperty);
+    if(managerProxy.empty())
+    {
+        cerr << argv[0] << ": property `" << managerProxyProperty << "' is not set" << endl;
+        return EXIT_FAILURE;
+    }
+
+    IceStorm::TopicManagerPrx manager = IceStorm::TopicManagerPrx::checkedCast(
+        communicator->stringToProxy(managerProxy));
+    if(!manager)
+    {
+        cerr << argv[0] << ": `" << managerProxy << "' is not running" << endl;
+        return EXIT_FAILURE;
+    }
+
+    TopicPrx topic;
+    try
+    {
+        topic = manager->retrieve("durable");
+    }
+    catch(const NoSuchTopic& e)
+    {
+        cerr << argv[0] << ": NoSuchTopic: " << e.name << endl;
+        return EXIT_FAILURE;
+    }
+
+    //
+    // Events are published with twoway invocations, the events are
+    // appended to the log of the topic once the invocation returns.
+    //
+    EventPrx proxy = EventPrx::uncheckedCast(topic->getPublisher()->ice_twoway());
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = first; i < first + events; ++i)
+    {
+        proxy->pub(i);
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    cout << "published " << events << " events in " << elapsed.toMilliSecondsDouble() << "ms ("
+         << static_cast<int>(events / elapsed.toSecondsDouble()) << " events/s)" << endl;
+
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status;
+    CommunicatorPtr communicator;
+
+    try
+    {
+        communicator = initialize(argc, argv);
+        status = run(argc, argv, communicator);
+    }
+    catch(const Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,227 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceUtil/DisableWarnings.h>
+#include <Ice/Ice.h>
+#include <IceUtil/Options.h>
+#include <IceStorm/IceStorm.h>
+#include <Durable.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceStorm;
+using namespace Test;
+
+//
+// Checks that the events are received in order and that the sequence
+// number set by IceStorm in the request context matches the event:
+// the publisher publishes the counters 0, 1, 2, ... which are logged
+// with the sequence numbers 1, 2, 3, ...
+//
+class EventI : public Event, public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    EventI(int first, int count) :
+        _next(first),
+        _last(first + count),
+        _start(IceUtil::Time::now(IceUtil::Time::Monotonic))
+    {
+    }
+
+    virtual void
+    pub(int counter, const Current& current)
+    {
+        Lock sync(*this);
+
+        if(counter != _next)
+        {
+            cerr << endl << "received unexpected event " << counter << ", expected " << _next;
+            test(false);
+        }
+
+        Context::const_iterator p = current.ctx.find("IceStorm.Sequence");
+        test(p != current.ctx.end());
+        Ice::Long sequence = -1;
+        istringstream is(p->second);
+        is >> sequence;
+        test(sequence == counter + 1);
+
+        if(++_next == _last)
+        {
+            notify();
+        }
+    }
+
+    void
+    waitForEvents(int count)
+    {
+        Lock sync(*this);
+        while(_next < _last)
+        {
+            if(!timedWait(IceUtil::Time::seconds(30)))
+            {
+                cerr << endl << "timed out waiting for events, received " << (count - (_last - _next))
+                     << "/" << count;
+                test(false);
+            }
+        }
+        IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - _start;
+        cout << "received " << count << " events in " << elapsed.toMilliSecondsDouble() << "ms ("
+             << static_cast<int>(count / elapsed.toSecondsDouble()) << " events/s)" << endl;
+    }
+
+private:
+
+    int _next;
+    const int _last;
+    const IceUtil::Time _start;
+};
+typedef IceUtil::Handle<EventI> EventIPtr;
+
+int
+run(int argc, char* argv[], const CommunicatorPtr& communicator)
+{
+    IceUtilInternal::Options opts;
+    opts.addOpt("", "replay", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "events", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "queueSize", IceUtilInternal::Options::NeedArg);
+
+    try
+    {
+        opts.parse(argc, (const char**)argv);
+    }
+    catch(const IceUtilInternal::BadOptException& e)
+    {
+        cerr << argv[0] << ": " << e.reason << endl;
+        return EXIT_FAILURE;
+    }
+
+    string replay = opts.optArg("replay");
+    if(replay.empty())
+    {
+        cerr << argv[0] << ": --replay must be set." << endl;
+        return EXIT_FAILURE;
+    }
+
+    int events = 1000;
+    string s = opts.optArg("events");
+    if(!s.empty())
+    {
+        events = atoi(s.c_str());
+    }
+    if(events <= 0)
+    {
+        cerr << argv[0] << ": events must be > 0." << endl;
+        return EXIT_FAILURE;
+    }
+
+    PropertiesPtr properties = communicator->getProperties();
+    const char* managerProxyProperty = "IceStormAdmin.TopicManager.Default";
+    string managerProxy = properties->getProperty(managerProxyProperty);
+    if(managerProxy.empty())
+    {
+        cerr << argv[0] << ": property `" << managerProxyProperty << "' is not set" << endl;
+        return EXIT_FAILURE;
+    }
+
+    IceStorm::TopicManagerPrx manager = IceStorm::TopicManagerPrx::checkedCast(
+        communicator->stringToProxy(managerProxy));
+    if(!manager)
+    {
+        cerr << argv[0] << ": `" << managerProxy << "' is not running" << endl;
+        return EXIT_FAILURE;
+    }
+
+    TopicPrx topic;
+    try
+    {
+        topic = manager->retrieve("durable");
+    }
+    catch(const IceStorm::NoSuchTopic& e)
+    {
+        cerr << argv[0] << ": NoSuchTopic: " << e.name << endl;
+        return EXIT_FAILURE;
+    }
+
+    ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("SubscriberAdapter", "default");
+    EventIPtr servant = new EventI(atoi(replay.c_str()) - 1, events);
+    ObjectPrx object = adapter->addWithUUID(servant);
+    adapter->activate();
+
+    {
+        //
+        // An invalid replay position is rejected.
+        //
+        IceStorm::QoS qos;
+        qos["replay"] = "invalid";
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, object);
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+    }
+
+    IceStorm::QoS qos;
+    qos["reliability"] = "ordered";
+    qos["replay"] = replay;
+    string queueSize = opts.optArg("queueSize");
+    if(!queueSize.empty())
+    {
+        //
+        // The replayed events are read from the log as they are sent,
+        // none are dropped by the bounded queue.
+        //
+        qos["queueSize"] = queueSize;
+    }
+    topic->subscribeAndGetPublisher(qos, object);
+
+    servant->waitForEvents(events);
+
+    topic->unsubscribe(object);
+
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status;
+    CommunicatorPtr communicator;
+
+    try
+    {
+        communicator = initialize(argc, argv);
+        status = run(argc, argv, communicator);
+    }
+    catch(const Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
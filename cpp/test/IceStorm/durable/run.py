@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+# **********************************************************************
+#
+# Copyright (c) 2003-2013 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+import os, sys, shutil
+
+path = [ ".", "..", "../..", "../../..", "../../../.." ]
+head = os.path.dirname(sys.argv[0])
+if len(head) > 0:
+    path = [os.path.join(head, p) for p in path]
+path = [os.path.abspath(p) for p in path if os.path.exists(os.path.join(p, "scripts", "TestUtil.py")) ]
+if len(path) == 0:
+    raise RuntimeError("can't find toplevel directory!")
+sys.path.append(os.path.join(path[0], "scripts"))
+import TestUtil, IceStormUtil
+
+publisher = os.path.join(os.getcwd(), "publisher")
+subscriber = os.path.join(os.getcwd(), "subscriber")
+
+logHome = os.path.join(os.getcwd(), "log")
+
+def cleanLogDir():
+    for f in [ os.path.join(logHome, f) for f in os.listdir(logHome) if f != ".gitignore" ]:
+        shutil.rmtree(f)
+
+def publish(icestorm, first, events):
+    publisherProc = TestUtil.startClient(publisher, icestorm.reference() + ' --first %d --events %d' % (first, events),
+                                         echo = False)
+    publisherProc.waitTestSuccess()
+
+def replay(icestorm, first, events, args = ""):
+    subscriberProc = TestUtil.startClient(subscriber, icestorm.reference() +
+                                          ' --replay %d --events %d %s' % (first, events, args), echo = False)
+    subscriberProc.waitTestSuccess()
+
+cleanLogDir()
+
+#
+# Use small segments to check that events are read across segments and
+# that the log survives a restart of the service, and sync the log
+# every 100 events.
+#
+icestorm = IceStormUtil.init(TestUtil.toplevel, os.getcwd(), "persistent",
+                             additional = ' --IceStorm.Durable.Directory="%s"' % logHome +
+                                          ' --IceStorm.Durable.SegmentSize=16' +
+                                          ' --IceStorm.Durable.FlushEvents=100')
+icestorm.start()
+
+sys.stdout.write("creating topic... ")
+sys.stdout.flush()
+icestorm.admin("create durable")
+print("ok")
+
+sys.stdout.write("publishing events... ")
+sys.stdout.flush()
+publish(icestorm, 0, 1000)
+print("ok")
+
+sys.stdout.write("replaying events... ")
+sys.stdout.flush()
+replay(icestorm, 1, 1000)
+print("ok")
+
+sys.stdout.write("replaying events with a bounded queue... ")
+sys.stdout.flush()
+replay(icestorm, 1, 1000, "--queueSize 10")
+print("ok")
+
+sys.stdout.write("restarting icestorm... ")
+sys.stdout.flush()
+icestorm.stop()
+icestorm.start(echo = False)
+print("ok")
+
+sys.stdout.write("replaying events after restart... ")
+sys.stdout.flush()
+replay(icestorm, 501, 500)
+print("ok")
+
+sys.stdout.write("testing throughput... ")
+sys.stdout.flush()
+publish(icestorm, 1000, 10000)
+replay(icestorm, 1001, 10000)
+print("ok")
+
+sys.stdout.write("destroy topic... ")
+sys.stdout.flush()
+icestorm.admin("destroy durable")
+if os.path.exists(os.path.join(logHome, "durable")):
+    print("failed!")
+    sys.exit(1)
+print("ok")
+
+icestorm.stop()
+
+sys.exit(0)
@@ -33,8 +33,13 @@ public:
     virtual void
     event(int i, const Current& current)
     {
+        if(_name == "excluded")
+        {
+            cerr << endl << "received event excluded by the filter: " << i;
+            test(false);
+        }
         if((_name == "default" || _name == "oneway" || _name == "batch" || _name == "datagram" ||
-            _name == "batch datagram") && current.requestId != 0)
+            _name == "batch datagram" || _name == "filter" || _name == "bounded") && current.requestId != 0)
         {
             cerr << endl << "expected oneway request";
             test(false);
@@ -65,6 +70,18 @@ public:
     waitForEvents()
     {
         Lock sync(*this);
+        if(_name == "excluded")
+        {
+            //
+            // The other subscribers already received the events, give
+            // the excluded events time to arrive if they were sent.
+            //
+            cout << "testing filter exclusion... " << flush;
+            timedWait(IceUtil::Time::seconds(1));
+            test(_count == 0);
+            cout << "ok" << endl;
+            return;
+        }
         cout << "testing " << _name << " reliability... " << flush;
         bool datagram = _name == "datagram" || _name == "batch datagram";
         IceUtil::Time timeout = (datagram) ? IceUtil::Time::seconds(5) : IceUtil::Time::seconds(20);
@@ -102,6 +119,166 @@ private:
 };
 typedef IceUtil::Handle<SingleI> SingleIPtr;
 
+//
+// A subscriber which doesn't return from the first event until it's
+// released, the events published in the meantime are queued by
+// IceStorm.
+//
+class OverflowI : public Single, public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    OverflowI() :
+        _released(false)
+    {
+    }
+
+    virtual void
+    event(int i, const Current&)
+    {
+        Lock sync(*this);
+        _received.push_back(i);
+        notifyAll();
+        while(!_released)
+        {
+            wait();
+        }
+    }
+
+    void
+    waitForFirstEvent()
+    {
+        Lock sync(*this);
+        while(_received.empty())
+        {
+            if(!timedWait(IceUtil::Time::seconds(20)))
+            {
+                test(false);
+            }
+        }
+    }
+
+    void
+    release()
+    {
+        Lock sync(*this);
+        _released = true;
+        notifyAll();
+    }
+
+    vector<int>
+    waitForEvents(size_t count)
+    {
+        Lock sync(*this);
+        while(_received.size() < count)
+        {
+            if(!timedWait(IceUtil::Time::seconds(20)))
+            {
+                test(false);
+            }
+        }
+
+        //
+        // Give the events which should have been dropped time to
+        // arrive if they weren't.
+        //
+        timedWait(IceUtil::Time::milliSeconds(500));
+        return _received;
+    }
+
+private:
+
+    bool _released;
+    vector<int> _received;
+};
+typedef IceUtil::Handle<OverflowI> OverflowIPtr;
+
+//
+// Overflow the queue of an ordered subscriber with the given overflow
+// policy and return the events it receives. The first event is sent
+// and blocks the subscriber, the 11 next events are queued in a queue
+// of 3 events. The conflation key of the events 1 to 10 is the event
+// number modulo 3, the event 11 has its own key.
+//
+vector<int>
+overflow(const TopicPrx& topic, const ObjectAdapterPtr& adapter, const string& policy)
+{
+    OverflowIPtr servant = new OverflowI();
+    ObjectPrx object = adapter->addWithUUID(servant);
+
+    IceStorm::QoS qos;
+    qos["reliability"] = "ordered";
+    qos["queueSize"] = "3";
+    qos["overflow"] = policy;
+    if(policy == "conflate")
+    {
+        qos["conflateKey"] = "key";
+    }
+    topic->subscribeAndGetPublisher(qos, object);
+
+    SinglePrx publisher = SinglePrx::uncheckedCast(topic->getPublisher()->ice_twoway());
+    publisher->event(0);
+    servant->waitForFirstEvent();
+    for(int i = 1; i <= 11; ++i)
+    {
+        Context ctx;
+        ostringstream os;
+        os << (i <= 10 ? i % 3 : 3);
+        ctx["key"] = os.str();
+        publisher->event(i, ctx);
+    }
+    servant->release();
+
+    vector<int> received = servant->waitForEvents(policy == "offline" ? 1 : 4);
+    topic->unsubscribe(object);
+    adapter->remove(object->ice_getIdentity());
+    return received;
+}
+
+void
+testOverflow(const TopicManagerPrx& manager, const ObjectAdapterPtr& adapter)
+{
+    cout << "testing queue overflow... " << flush;
+
+    TopicPrx topic;
+    try
+    {
+        topic = manager->create("overflow");
+    }
+    catch(const IceStorm::TopicExists&)
+    {
+        topic = manager->retrieve("overflow");
+    }
+
+    //
+    // The oldest events are dropped, the last 3 events are received.
+    //
+    int dropOldest[] = { 0, 9, 10, 11 };
+    test(overflow(topic, adapter, "drop oldest") == vector<int>(dropOldest, dropOldest + 4));
+
+    //
+    // The new events are dropped, the first 3 events are received.
+    //
+    int dropNewest[] = { 0, 1, 2, 3 };
+    test(overflow(topic, adapter, "drop newest") == vector<int>(dropNewest, dropNewest + 4));
+
+    //
+    // The events 4 to 10 replace the queued event with the same key,
+    // the event 11 can't be conflated and the oldest event is dropped.
+    //
+    int conflate[] = { 0, 8, 9, 11 };
+    test(overflow(topic, adapter, "conflate") == vector<int>(conflate, conflate + 4));
+
+    //
+    // The queued events are dropped and the subscriber is offline when
+    // the event 4 is queued, the next events are discarded.
+    //
+    test(overflow(topic, adapter, "offline") == vector<int>(1, 0));
+
+    topic->destroy();
+    cout << "ok" << endl;
+}
+
 int
 run(int, char* argv[], const CommunicatorPtr& communicator)
 {
@@ -265,6 +442,89 @@ run(int, char* argv[], const CommunicatorPtr& communicator)
         adpt->activate();
     }
 
+    //
+    // Finally we subscribe with filters, only the events matching the
+    // filter are sent to the subscriber.
+    //
+    {
+        subscribers.push_back(new SingleI(communicator, "filter"));
+        IceStorm::QoS qos;
+        qos["filter"] = "op == 'event' && !ctx['unknown']";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back())->ice_oneway();
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        //
+        // The events are published without the context entry, this
+        // filter excludes all of them.
+        //
+        subscribers.push_back(new SingleI(communicator, "excluded"));
+        IceStorm::QoS qos;
+        qos["filter"] = "op == 'event' && ctx['unknown']";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back())->ice_oneway();
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        //
+        // Expressions nested too deeply are rejected.
+        //
+        IceStorm::QoS qos;
+        qos["filter"] = string(1000, '!') + "op == 'event'";
+        Ice::ObjectPrx object = adapter->addWithUUID(new SingleI(communicator, "nested filter"))->ice_oneway();
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, object);
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+    }
+    {
+        IceStorm::QoS qos;
+        qos["filter"] = "op = 'event'";
+        Ice::ObjectPrx object = adapter->addWithUUID(new SingleI(communicator, "invalid filter"))->ice_oneway();
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, object);
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+    }
+
+    //
+    // And with a bounded queue, the queue is large enough to not
+    // overflow.
+    //
+    {
+        subscribers.push_back(new SingleI(communicator, "bounded"));
+        IceStorm::QoS qos;
+        qos["queueSize"] = "1000";
+        qos["overflow"] = "conflate";
+        qos["conflateKey"] = "unknown";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back())->ice_oneway();
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        IceStorm::QoS qos;
+        qos["queueSize"] = "100";
+        qos["overflow"] = "drop all";
+        Ice::ObjectPrx object = adapter->addWithUUID(new SingleI(communicator, "invalid overflow"))->ice_oneway();
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, object);
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+    }
+
     adapter->activate();
     
     vector<Ice::Identity> ids = topic->getSubscribers();
@@ -279,6 +539,8 @@ run(int, char* argv[], const CommunicatorPtr& communicator)
         (*p)->waitForEvents();
     }
 
+    testOverflow(manager, adapter);
+
     return EXIT_SUCCESS;
 }
 
@@ -168,6 +168,83 @@ private:
     bool _done;
 };
 
+//
+// Counts the events received by many subscribers to measure the rate
+// at which IceStorm delivers events depending on the number of
+// subscribers of the topic.
+//
+class FanoutCounter : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    FanoutCounter(const CommunicatorPtr& communicator, int subscribers) :
+        _communicator(communicator), _remaining(subscribers)
+    {
+    }
+
+    void started()
+    {
+        Lock sync(*this);
+        if(_start == IceUtil::Time())
+        {
+            _start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+    }
+
+    void finished()
+    {
+        Lock sync(*this);
+        if(--_remaining == 0)
+        {
+            _stop = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            _communicator->shutdown();
+        }
+    }
+
+    IceUtil::Time elapsed() const
+    {
+        Lock sync(*this);
+        return _stop - _start;
+    }
+
+private:
+
+    const CommunicatorPtr _communicator;
+    int _remaining;
+    IceUtil::Time _start;
+    IceUtil::Time _stop;
+};
+typedef IceUtil::Handle<FanoutCounter> FanoutCounterPtr;
+
+class FanoutEventI : public EventI
+{
+public:
+
+    FanoutEventI(const CommunicatorPtr& communicator, int total, const FanoutCounterPtr& counter) :
+        EventI(communicator, total), _counter(counter)
+    {
+    }
+
+    virtual void
+    pub(int, const Ice::Current&)
+    {
+        Lock sync(*this);
+
+        if(_count == 0)
+        {
+            _counter->started();
+        }
+        if(++_count == _total)
+        {
+            _counter->finished();
+        }
+    }
+
+private:
+
+    const FanoutCounterPtr _counter;
+};
+
 IceUtil::Mutex* ErraticEventI::_remainingMutex = 0;
 int ErraticEventI::_remaining = 0;
 
@@ -210,6 +287,7 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
     opts.addOpt("", "qos", IceUtilInternal::Options::NeedArg, "", IceUtilInternal::Options::Repeat);
     opts.addOpt("", "slow");
     opts.addOpt("", "erratic", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "subscribers", IceUtilInternal::Options::NeedArg);
 
     try
     {
@@ -262,6 +340,18 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
         return EXIT_FAILURE;
     }
 
+    int subscribers = 0;
+    s = opts.optArg("subscribers");
+    if(!s.empty())
+    {
+        subscribers = atoi(s.c_str());
+        if(subscribers <= 0)
+        {
+            cerr << argv[0] << ": subscribers must be > 0." << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
     PropertiesPtr properties = communicator->getProperties();
     const char* managerProxyProperty = "IceStormAdmin.TopicManager.Default";
     string managerProxy = properties->getProperty(managerProxyProperty);
@@ -280,8 +370,26 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
     }
 
     vector<Subscription> subs;
+    FanoutCounterPtr counter;
 
-    if(erratic)
+    if(subscribers > 0)
+    {
+        //
+        // All the subscribers share the same object adapter, IceStorm
+        // sends the events to all of them over the same connection.
+        //
+        counter = new FanoutCounter(communicator, subscribers);
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("SubscriberAdapter", "default");
+        for(int i = 0; i < subscribers; ++i)
+        {
+            Subscription item;
+            item.adapter = adapter;
+            item.servant = new FanoutEventI(communicator, events, counter);
+            item.qos = cmdLineQos;
+            subs.push_back(item);
+        }
+    }
+    else if(erratic)
     {
         for(int i = 0 ; i < erraticNum; ++i)
         {
@@ -383,6 +491,17 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
         }
     }
 
+    if(counter)
+    {
+        double seconds = counter->elapsed().toSecondsDouble();
+        if(seconds > 0)
+        {
+            cout << subscribers << " subscribers: " << static_cast<int>(events / seconds) << " events/s, "
+                 << static_cast<int>(events * static_cast<double>(subscribers) / seconds) << " deliveries/s"
+                 << endl;
+        }
+    }
+
     return EXIT_SUCCESS;
 }
 
@@ -95,6 +95,17 @@ def runtest(type):
     doTest(server1, server2, '--events 20000 ' + server1.reference(), '--events 20000 --oneway')
     print("ok")
 
+    #
+    # Measure the rate at which events are delivered depending on the
+    # number of subscribers.
+    #
+    for n in [1, 10, 100]:
+        sys.stdout.write("Sending 5000 unordered events to %d subscribers... " % n)
+        sys.stdout.flush()
+        doTest(server1, server2, '--events 5000 --subscribers %d %s' % (n, server1.reference()),
+               '--events 5000 --oneway')
+        print("ok")
+
     runAdmin("link TestIceStorm1/fed1 TestIceStorm2/fed1")
     sys.stdout.write("Sending 20000 unordered events across a link... ")
     sys.stdout.flush()
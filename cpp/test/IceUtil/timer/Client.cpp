@@ -136,123 +136,214 @@ private:
 };
 typedef IceUtil::Handle<DestroyTask> DestroyTaskPtr;
 
-int main(int, char**)
+void
+testTimer(const IceUtil::TimerPtr& timer)
 {
-    cout << "testing timer... " << flush;
     {
-        IceUtil::TimerPtr timer = new IceUtil::Timer();
-
+        TestTaskPtr task = new TestTask();
+        timer->schedule(task, IceUtil::Time());
+        task->waitForRun();
+        task->clear();
+
+        //
+        // Verify that the same task cannot be scheduled more than once.
+        //
+        timer->schedule(task, IceUtil::Time::milliSeconds(100));
+        try
         {
-            TestTaskPtr task = new TestTask();
             timer->schedule(task, IceUtil::Time());
-            task->waitForRun();
-            task->clear();
-
-            //
-            // Verify that the same task cannot be scheduled more than once.
-            //
-            timer->schedule(task, IceUtil::Time::milliSeconds(100));
-            try
-            {
-                timer->schedule(task, IceUtil::Time());
-            }
-            catch(const IceUtil::IllegalArgumentException&)
-            {
-                // Expected.
-            }
-            task->waitForRun();
-            task->clear();
         }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            // Expected.
+        }
+        task->waitForRun();
+        task->clear();
+    }
 
+    {
+        TestTaskPtr task = new TestTask();
+        test(!timer->cancel(task));
+        timer->schedule(task, IceUtil::Time::seconds(1));
+        test(!task->hasRun() && timer->cancel(task) && !task->hasRun());
+        test(!timer->cancel(task));
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1100));
+        test(!task->hasRun());
+    }
+
+    {
+        vector<TestTaskPtr> tasks;
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::milliSeconds(500);
+        for(int i = 0; i < 20; ++i)
         {
-            TestTaskPtr task = new TestTask();
-            test(!timer->cancel(task));
-            timer->schedule(task, IceUtil::Time::seconds(1));
-            test(!task->hasRun() && timer->cancel(task) && !task->hasRun());
-            test(!timer->cancel(task));
-            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1100));
-            test(!task->hasRun());
+            tasks.push_back(new TestTask(IceUtil::Time::milliSeconds(500 + i * 5)));
         }
 
+        random_shuffle(tasks.begin(), tasks.end());
+        vector<TestTaskPtr>::const_iterator p;
+        for(p = tasks.begin(); p != tasks.end(); ++p)
         {
-            vector<TestTaskPtr> tasks;
-            IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::milliSeconds(500);
-            for(int i = 0; i < 20; ++i)
-            {
-                tasks.push_back(new TestTask(IceUtil::Time::milliSeconds(500 + i * 5)));
-            }
+            timer->schedule(*p, (*p)->getScheduledTime());
+        }
 
-            random_shuffle(tasks.begin(), tasks.end());
-            vector<TestTaskPtr>::const_iterator p;
-            for(p = tasks.begin(); p != tasks.end(); ++p)
-            {
-                timer->schedule(*p, (*p)->getScheduledTime());
-            }
+        for(p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            (*p)->waitForRun();
+        }
+
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) > start);
 
-            for(p = tasks.begin(); p != tasks.end(); ++p)
+        sort(tasks.begin(), tasks.end());
+        for(p = tasks.begin(); p + 1 != tasks.end(); ++p)
+        {
+            if((*p)->getRunTime() > (*(p + 1))->getRunTime())
             {
-                (*p)->waitForRun();
+                test(false);
             }
+        }
+    }
+
+    {
+        TestTaskPtr task = new TestTask();
+        timer->scheduleRepeated(task, IceUtil::Time::milliSeconds(20));
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        test(task->hasRun());
+        test(task->getCount() > 1);
+        test(task->getCount() < 26);
+        test(timer->cancel(task));
+        int count = task->getCount();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        test(count == task->getCount() || count + 1 == task->getCount());
+    }
 
-            test(IceUtil::Time::now(IceUtil::Time::Monotonic) > start);
+    timer->destroy();
+}
 
-            sort(tasks.begin(), tasks.end());
-            for(p = tasks.begin(); p + 1 != tasks.end(); ++p)
-            {
-                if((*p)->getRunTime() > (*(p + 1))->getRunTime())
-                {
-                    test(false);
-                }
-            }
+void
+testTimerDestroy(const IceUtil::Time& tick)
+{
+    {
+        IceUtil::TimerPtr timer = new IceUtil::Timer(tick);
+        DestroyTaskPtr destroyTask = new DestroyTask(timer);
+        timer->schedule(destroyTask, IceUtil::Time());
+        destroyTask->waitForRun();
+        try
+        {
+            timer->schedule(destroyTask, IceUtil::Time());
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            // Expected;
+        }
+    }
+    {
+        IceUtil::TimerPtr timer = new IceUtil::Timer(tick);
+        TestTaskPtr testTask = new TestTask();
+        timer->schedule(testTask, IceUtil::Time());
+        timer->destroy();
+        try
+        {
+            timer->schedule(testTask, IceUtil::Time());
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            // Expected;
         }
+    }
+}
 
+void
+benchmarkTimer(const IceUtil::TimerPtr& timer, const vector<IceUtil::TimerTaskPtr>& tasks)
+{
+    //
+    // Schedule the tasks with delays spread over an hour so that they
+    // land in all the levels of a timing wheel, then cancel them.
+    //
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(size_t i = 0; i < tasks.size(); ++i)
+    {
+        timer->schedule(tasks[i], IceUtil::Time::milliSeconds(60000 + static_cast<IceUtil::Int64>(i * 7919) % 3600000));
+    }
+    for(size_t i = 0; i < tasks.size(); ++i)
+    {
+        test(timer->cancel(tasks[i]));
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    cout << elapsed.toMicroSecondsDouble() * 1000 / (2 * tasks.size()) << "ns/op " << flush;
+    timer->destroy();
+}
+
+int main(int argc, char** argv)
+{
+    //
+    // Use "client 1000000" to benchmark scheduling and cancelling one
+    // million tasks.
+    //
+    int count = argc > 1 ? atoi(argv[1]) : 100000;
+
+    cout << "testing timer... " << flush;
+    testTimer(new IceUtil::Timer());
+    cout << "ok" << endl;
+
+    cout << "testing timer wheel... " << flush;
+    {
+        testTimer(new IceUtil::Timer(IceUtil::Time::milliSeconds(1)));
+
+        //
+        // Tasks far in the future are cascaded down the levels of the
+        // wheel, check that they still run in order and that repeated
+        // tasks cancelled while they run aren't rescheduled.
+        //
+        IceUtil::TimerPtr timer = new IceUtil::Timer(IceUtil::Time::microSeconds(100));
+        vector<TestTaskPtr> tasks;
+        for(int i = 0; i < 10; ++i)
         {
-            TestTaskPtr task = new TestTask();
-            timer->scheduleRepeated(task, IceUtil::Time::milliSeconds(20));
-            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
-            test(task->hasRun());
-            test(task->getCount() > 1);
-            test(task->getCount() < 26);
-            test(timer->cancel(task));
-            int count = task->getCount();
-            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
-            test(count == task->getCount() || count + 1 == task->getCount());
+            tasks.push_back(new TestTask(IceUtil::Time::milliSeconds(100 + i * 20)));
+            timer->schedule(tasks.back(), tasks.back()->getScheduledTime());
+        }
+        for(vector<TestTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            (*p)->waitForRun();
+            test(p == tasks.begin() || (*(p - 1))->getRunTime() <= (*p)->getRunTime());
         }
 
+        TestTaskPtr task = new TestTask();
+        timer->scheduleRepeated(task, IceUtil::Time::milliSeconds(1));
+        while(task->getCount() < 10)
+        {
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1));
+        }
+        test(timer->cancel(task));
+        test(!timer->cancel(task));
+        timer->schedule(task, IceUtil::Time::seconds(1));
+        test(timer->cancel(task));
         timer->destroy();
+
+        try
+        {
+            new IceUtil::Timer(IceUtil::Time::milliSeconds(-1));
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+        }
     }
     cout << "ok" << endl;
 
     cout << "testing timer destroy... " << flush;
+    testTimerDestroy(IceUtil::Time());
+    testTimerDestroy(IceUtil::Time::milliSeconds(1));
+    cout << "ok" << endl;
+
+    cout << "testing timer schedule and cancel... " << flush;
     {
+        vector<IceUtil::TimerTaskPtr> tasks;
+        for(int i = 0; i < count; ++i)
         {
-            IceUtil::TimerPtr timer = new IceUtil::Timer();
-            DestroyTaskPtr destroyTask = new DestroyTask(timer);
-            timer->schedule(destroyTask, IceUtil::Time());
-            destroyTask->waitForRun();
-            try
-            {
-                timer->schedule(destroyTask, IceUtil::Time());
-            }
-            catch(const IceUtil::IllegalArgumentException&)
-            {
-                // Expected;
-            }
-        }
-        {
-            IceUtil::TimerPtr timer = new IceUtil::Timer();
-            TestTaskPtr testTask = new TestTask();
-            timer->schedule(testTask, IceUtil::Time());
-            timer->destroy();
-            try
-            {
-                timer->schedule(testTask, IceUtil::Time());
-            }
-            catch(const IceUtil::IllegalArgumentException&)
-            {
-                // Expected;
-            }
+            tasks.push_back(new TestTask());
         }
+        benchmarkTimer(new IceUtil::Timer(), tasks);
+        benchmarkTimer(new IceUtil::Timer(IceUtil::Time::milliSeconds(1)), tasks);
     }
     cout << "ok" << endl;
 
@@ -409,6 +409,12 @@ namespace Ice
                 //
                 _transceiver.checkSendSize(os.getBuffer(), _instance.messageSizeMax());
 
+                //
+                // Synchronous requests wait for the send queue to drain with the
+                // Block policy.
+                //
+                checkSendQueue(os.size(), true);
+
                 int requestId = 0;
                 if(response)
                 {
@@ -439,7 +445,9 @@ namespace Ice
                 bool sent = false;
                 try
                 {
-                    sent = sendMessage(new OutgoingMessage(og, os, compress, requestId));
+                    OutgoingMessage message = new OutgoingMessage(og, os, compress, requestId);
+                    message.oneway = !response;
+                    sent = sendMessage(message);
                 }
                 catch(LocalException ex)
                 {
@@ -491,6 +499,12 @@ namespace Ice
                 //
                 _transceiver.checkSendSize(os.getBuffer(), _instance.messageSizeMax());
 
+                //
+                // Asynchronous requests can't wait, they fail with
+                // SendQueueFullException with the Block policy.
+                //
+                checkSendQueue(os.size(), false);
+
                 int requestId = 0;
                 if(response)
                 {
@@ -518,6 +532,7 @@ namespace Ice
                 try
                 {
                     OutgoingMessage msg = new OutgoingMessage(og, og.ostr__, compress, requestId);
+                    msg.oneway = !response;
                     sent = sendMessage(msg);
                     sentCallback = msg.sentCallback;
                 }
@@ -1590,6 +1605,12 @@ namespace Ice
 
             if(_sendStreams.Count > 0)
             {
+                if(_observer != null && _sendQueueSize > 0)
+                {
+                    _observer.queuedBytes(-_sendQueueSize);
+                }
+                _sendQueueSize = 0;
+
                 if(!_writeStream.isEmpty())
                 {
                     //
@@ -1722,6 +1743,32 @@ namespace Ice
             }
         }
 
+        public void setWritableCallback(ConnectionWritableCallback callback)
+        {
+            _m.Lock();
+            try
+            {
+                _writableCallback = callback;
+            }
+            finally
+            {
+                _m.Unlock();
+            }
+        }
+
+        public bool isWritable()
+        {
+            _m.Lock();
+            try
+            {
+                return !_sendQueueFull;
+            }
+            finally
+            {
+                _m.Unlock();
+            }
+        }
+
         public string ice_toString_()
         {
             return ToString();
@@ -1819,6 +1866,29 @@ namespace Ice
             _dispatchCount = 0;
             _state = StateNotInitialized;
 
+            _sendQueueMaxSize = System.Math.Max(0, initData.properties.getPropertyAsInt("Ice.SendQueue.MaxSize"));
+            _sendQueueMaxMessages =
+                System.Math.Max(0, initData.properties.getPropertyAsInt("Ice.SendQueue.MaxMessages"));
+            string policy = initData.properties.getPropertyWithDefault("Ice.SendQueue.Policy", "Block");
+            if(policy.Equals("Fail"))
+            {
+                _sendQueuePolicy = SendQueuePolicyFail;
+            }
+            else if(policy.Equals("DropOldest"))
+            {
+                _sendQueuePolicy = SendQueuePolicyDropOldest;
+            }
+            else
+            {
+                if(!policy.Equals("Block"))
+                {
+                    _logger.warning("invalid value for Ice.SendQueue.Policy: `" + policy + "'; using Block");
+                }
+                _sendQueuePolicy = SendQueuePolicyBlock;
+            }
+            _sendQueueSize = 0;
+            _sendQueueFull = false;
+
             _compressionLevel = initData.properties.getPropertyAsIntWithDefault("Ice.Compression.Level", 1);
             if(_compressionLevel < 1)
             {
@@ -1881,6 +1951,10 @@ namespace Ice
         private const int StateClosed = 5;
         private const int StateFinished = 6;
 
+        private const int SendQueuePolicyBlock = 0;
+        private const int SendQueuePolicyFail = 1;
+        private const int SendQueuePolicyDropOldest = 2;
+
         private void setState(int state, LocalException ex)
         {
             //
@@ -2068,6 +2142,13 @@ namespace Ice
                 ConnectionState newState = toConnectionState(state);
                 if(oldState != newState)
                 {
+                    //
+                    // Move the queued bytes to the observer of the new state.
+                    //
+                    if(_observer != null && _sendQueueSize > 0)
+                    {
+                        _observer.queuedBytes(-_sendQueueSize);
+                    }
                     _observer = _instance.getObserver().getConnectionObserver(initConnectionInfo(),
                                                                               _endpoint, 
                                                                               newState,
@@ -2075,6 +2156,10 @@ namespace Ice
                     if(_observer != null)
                     {
                         _observer.attach();
+                        if(_sendQueueSize > 0)
+                        {
+                            _observer.queuedBytes(_sendQueueSize);
+                        }
                     }
                     else
                     {
@@ -2301,6 +2386,7 @@ namespace Ice
                         callbacks.Enqueue(message);
                     }
                     _sendStreams.Dequeue();
+                    messageDequeued(message.size);
 
                     //
                     // If there's nothing left to send, we're done.
@@ -2387,10 +2473,12 @@ namespace Ice
         private bool sendMessage(OutgoingMessage message)
         {
             Debug.Assert(_state < StateClosed);
+            message.size = message.stream.size();
             if(_sendStreams.Count > 0)
             {
                 message.adopt();
                 _sendStreams.Enqueue(message);
+                messageQueued(message.size);
                 return false;
             }
 
@@ -2438,11 +2526,169 @@ namespace Ice
 
             _writeStream.swap(message.stream);
             _sendStreams.Enqueue(message);
+            messageQueued(message.size);
             scheduleTimeout(IceInternal.SocketOperation.Write, _endpoint.timeout());
             _threadPool.register(this, IceInternal.SocketOperation.Write);
             return false;
         }
 
+        private void checkSendQueue(int size, bool block)
+        {
+            if(!sendQueueFull(size))
+            {
+                return;
+            }
+
+            _sendQueueFull = true;
+            switch(_sendQueuePolicy)
+            {
+                case SendQueuePolicyBlock:
+                {
+                    if(!block)
+                    {
+                        throw new SendQueueFullException();
+                    }
+
+                    //
+                    // Unlike C++/Java, the send queue is drained from the .NET I/O
+                    // threads, a thread of the Ice thread pool can wait for it.
+                    //
+                    while(sendQueueFull(size) && _exception == null)
+                    {
+                        _sendQueueFull = true;
+                        _m.Wait();
+                    }
+                    if(_exception != null)
+                    {
+                        //
+                        // The request wasn't sent, it can be retried.
+                        //
+                        throw new IceInternal.LocalExceptionWrapper(_exception, true);
+                    }
+                    break;
+                }
+
+                case SendQueuePolicyDropOldest:
+                {
+                    while(sendQueueFull(size) && dropOldestOneway())
+                    {
+                    }
+                    if(sendQueueFull(size))
+                    {
+                        throw new SendQueueFullException();
+                    }
+                    break;
+                }
+
+                case SendQueuePolicyFail:
+                {
+                    throw new SendQueueFullException();
+                }
+            }
+        }
+
+        private bool sendQueueFull(int size)
+        {
+            //
+            // A message is always accepted by an empty queue, even if it's
+            // larger than the limit.
+            //
+            if(_sendStreams.Count == 0)
+            {
+                return false;
+            }
+            return (_sendQueueMaxSize > 0 && _sendQueueSize + size > _sendQueueMaxSize) ||
+                   (_sendQueueMaxMessages > 0 && _sendStreams.Count >= _sendQueueMaxMessages);
+        }
+
+        private bool dropOldestOneway()
+        {
+            //
+            // The first message is being sent, only oneway requests which
+            // aren't prepared yet can be dropped. Batch request flushes are
+            // never dropped.
+            //
+            OutgoingMessage dropped = null;
+            Queue<OutgoingMessage> sendStreams = new Queue<OutgoingMessage>();
+            bool first = true;
+            foreach(OutgoingMessage m in _sendStreams)
+            {
+                if(!first && dropped == null && m.oneway && !m.prepared)
+                {
+                    dropped = m;
+                }
+                else
+                {
+                    sendStreams.Enqueue(m);
+                }
+                first = false;
+            }
+            if(dropped == null)
+            {
+                return false;
+            }
+
+            _sendStreams = sendStreams;
+            messageDequeued(dropped.size);
+            if(dropped.outAsync != null)
+            {
+                //
+                // The callbacks can't be called with the connection locked.
+                //
+                _threadPool.dispatch(delegate()
+                                     {
+                                         dropped.finished(new SendQueueFullException());
+                                     });
+            }
+            else
+            {
+                dropped.finished(new SendQueueFullException());
+            }
+            return true;
+        }
+
+        private void messageQueued(int size)
+        {
+            _sendQueueSize += size;
+            if(_observer != null)
+            {
+                _observer.queuedBytes(size);
+            }
+        }
+
+        private void messageDequeued(int size)
+        {
+            Debug.Assert(_sendQueueSize >= size);
+            _sendQueueSize -= size;
+            if(_observer != null)
+            {
+                _observer.queuedBytes(-size);
+            }
+
+            if(_sendQueueFull &&
+               (_sendQueueMaxSize == 0 || _sendQueueSize <= _sendQueueMaxSize / 2) &&
+               (_sendQueueMaxMessages == 0 || _sendStreams.Count <= _sendQueueMaxMessages / 2))
+            {
+                _sendQueueFull = false;
+                _m.NotifyAll(); // Notify the threads waiting for the queue to drain.
+                if(_writableCallback != null)
+                {
+                    ConnectionWritableCallback callback = _writableCallback;
+                    _threadPool.dispatch(delegate()
+                                         {
+                                             try
+                                             {
+                                                 callback.writable(this);
+                                             }
+                                             catch(System.Exception ex)
+                                             {
+                                                 warning("connection writable callback exception", ex);
+                                             }
+                                         });
+                }
+            }
+        }
+
         private IceInternal.BasicStream doCompress(IceInternal.BasicStream uncompressed, bool compress)
         {
             if(_compressionSupported)
@@ -3029,6 +3275,8 @@ namespace Ice
             internal bool prepared;
             internal bool isSent;
             internal Ice.AsyncCallback sentCallback = null;
+            internal int size; // The size of the message in the send queue.
+            internal bool oneway; // True for oneway requests, they can be dropped from a full send queue.
         }
 
         private Communicator _communicator;
@@ -3080,6 +3328,13 @@ namespace Ice
 
         private Queue<OutgoingMessage> _sendStreams = new Queue<OutgoingMessage>();
 
+        private int _sendQueueMaxSize; // 0 if the size of the send queue isn't limited.
+        private int _sendQueueMaxMessages; // 0 if the number of queued messages isn't limited.
+        private int _sendQueuePolicy;
+        private int _sendQueueSize; // The number of bytes in _sendStreams.
+        private bool _sendQueueFull; // True once the limits are reached, until the queue drains below half.
+        private ConnectionWritableCallback _writableCallback;
+
         private IceInternal.BasicStream _readStream;
         private bool _readHeader;
         private IceInternal.BasicStream _writeStream;
@@ -767,6 +767,16 @@ namespace IceInternal
             }
         }
 
+        public void queuedBytes(int num)
+        {
+            _queuedBytes = num;
+            forEach(queuedBytesUpdate);
+            if(delegate_ != null)
+            {
+                delegate_.queuedBytes(num);
+            }
+        }
+
         private void sentBytesUpdate(ConnectionMetrics v)
         {
             v.sentBytes += _sentBytes;
@@ -777,8 +787,14 @@ namespace IceInternal
             v.receivedBytes += _receivedBytes;
         }
 
+        private void queuedBytesUpdate(ConnectionMetrics v)
+        {
+            v.queuedBytes = (v.queuedBytes.HasValue ? v.queuedBytes.Value : 0) + _queuedBytes;
+        }
+
         private int _sentBytes;
         private int _receivedBytes;
+        private int _queuedBytes;
     };
 
     public class DispatchObserverI : ObserverWithDelegate<DispatchMetrics, Ice.Instrumentation.DispatchObserver>,
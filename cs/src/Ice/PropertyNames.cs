@@ -8,7 +8,7 @@
 // **********************************************************************
 
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Fri Jul 26 23:12:55 2013
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sun Oct 18 09:44:31 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -30,6 +30,7 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.Coalesce$", false, null),
              new Property(@"^Ice\.Admin\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.PublishedEndpoints$", false, null),
              new Property(@"^Ice\.Admin\.ReplicaGroupId$", false, null),
@@ -40,6 +41,7 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Router\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.Coalesce$", false, null),
              new Property(@"^Ice\.Admin\.Router$", false, null),
              new Property(@"^Ice\.Admin\.ProxyOptions$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.Size$", false, null),
@@ -49,15 +51,41 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Facets$", false, null),
              new Property(@"^Ice\.Admin\.InstanceName$", false, null),
              new Property(@"^Ice\.Admin\.ServerId$", false, null),
              new Property(@"^Ice\.BackgroundLocatorCacheUpdates$", false, null),
              new Property(@"^Ice\.BatchAutoFlush$", false, null),
+             new Property(@"^Ice\.BufferPool$", false, null),
+             new Property(@"^Ice\.BufferPool\.MaxBuffers$", false, null),
+             new Property(@"^Ice\.BufferPool\.MaxSize$", false, null),
              new Property(@"^Ice\.ChangeUser$", false, null),
              new Property(@"^Ice\.ClientAccessPolicyProtocol$", false, null),
+             new Property(@"^Ice\.Coalesce\.MaxSize$", false, null),
+             new Property(@"^Ice\.Coalesce\.Window$", false, null),
+             new Property(@"^Ice\.Compression\.Codec$", false, null),
              new Property(@"^Ice\.Compression\.Level$", false, null),
+             new Property(@"^Ice\.Compression\.MaxRatio$", false, null),
+             new Property(@"^Ice\.Compression\.MinSize$", false, null),
              new Property(@"^Ice\.Config$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
@@ -71,6 +99,7 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Default\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.Coalesce$", false, null),
              new Property(@"^Ice\.Default\.Locator$", false, null),
              new Property(@"^Ice\.Default\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Default\.Package$", false, null),
@@ -83,6 +112,7 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Router\.Router$", false, null),
              new Property(@"^Ice\.Default\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.Router\.Coalesce$", false, null),
              new Property(@"^Ice\.Default\.Router$", false, null),
              new Property(@"^Ice\.Default\.SlicedFormat$", false, null),
              new Property(@"^Ice\.IPv4$", false, null),
@@ -90,6 +120,9 @@ namespace IceInternal
              new Property(@"^Ice\.EventLog\.Source$", false, null),
              new Property(@"^Ice\.FactoryAssemblies$", false, null),
              new Property(@"^Ice\.GC\.Interval$", false, null),
+             new Property(@"^Ice\.HostResolver\.CacheTTL$", false, null),
+             new Property(@"^Ice\.HostResolver\.NegativeCacheTTL$", false, null),
+             new Property(@"^Ice\.HostResolver\.Size$", false, null),
              new Property(@"^Ice\.ImplicitContext$", false, null),
              new Property(@"^Ice\.InitPlugins$", false, null),
              new Property(@"^Ice\.LogFile$", false, null),
@@ -110,8 +143,12 @@ namespace IceInternal
              new Property(@"^Ice\.PrintProcessId$", false, null),
              new Property(@"^Ice\.PrintStackTraces$", false, null),
              new Property(@"^Ice\.ProgramName$", false, null),
+             new Property(@"^Ice\.RequestHeaderCacheSize$", false, null),
              new Property(@"^Ice\.RetryIntervals$", false, null),
              new Property(@"^Ice\.ServerIdleTime$", false, null),
+             new Property(@"^Ice\.SendQueue\.MaxMessages$", false, null),
+             new Property(@"^Ice\.SendQueue\.MaxSize$", false, null),
+             new Property(@"^Ice\.SendQueue\.Policy$", false, null),
              new Property(@"^Ice\.SOCKSProxyHost$", false, null),
              new Property(@"^Ice\.SOCKSProxyPort$", false, null),
              new Property(@"^Ice\.StdErr$", false, null),
@@ -124,6 +161,24 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Client\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Affinity$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.PinThreads$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.BusyPoll$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.BusyPollSocket$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.NUMA$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.NUMAIncoming$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactors$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.Size$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.SizeMax$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.StackSize$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.Serialize$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.Affinity$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.PinThreads$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeWarn$", false, null),
@@ -131,7 +186,26 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Server\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Affinity$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.PinThreads$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.BusyPoll$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.BusyPollSocket$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.NUMA$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.NUMAIncoming$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactors$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.Size$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.SizeMax$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.StackSize$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.Serialize$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.Affinity$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.PinThreads$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^Ice\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Timer\.Tick$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Properties$", false, null),
              new Property(@"^Ice\.Trace\.GC$", false, null),
              new Property(@"^Ice\.Trace\.Locator$", false, null),
@@ -140,6 +214,7 @@ namespace IceInternal
              new Property(@"^Ice\.Trace\.Retry$", false, null),
              new Property(@"^Ice\.Trace\.Slicing$", false, null),
              new Property(@"^Ice\.Trace\.ThreadPool$", false, null),
+             new Property(@"^Ice\.UDP\.BatchSize$", false, null),
              new Property(@"^Ice\.UDP\.RcvSize$", false, null),
              new Property(@"^Ice\.UDP\.SndSize$", false, null),
              new Property(@"^Ice\.TCP\.Backlog$", false, null),
@@ -165,6 +240,7 @@ namespace IceInternal
              new Property(@"^IceMX\.Metrics\.[^\s]+\.RetainDetached$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+\.Accept$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+\.Reject$", false, null),
+             new Property(@"^IceMX\.Metrics\.[^\s]+\.Histogram$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+$", false, null),
              null
         };
@@ -186,6 +262,7 @@ namespace IceInternal
              new Property(@"^IceBox\.ServiceManager\.Locator\.Locator$", false, null),
              new Property(@"^IceBox\.ServiceManager\.Locator\.Router$", false, null),
              new Property(@"^IceBox\.ServiceManager\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.Locator\.Coalesce$", false, null),
              new Property(@"^IceBox\.ServiceManager\.Locator$", false, null),
              new Property(@"^IceBox\.ServiceManager\.PublishedEndpoints$", false, null),
              new Property(@"^IceBox\.ServiceManager\.ReplicaGroupId$", false, null),
@@ -196,6 +273,7 @@ namespace IceInternal
              new Property(@"^IceBox\.ServiceManager\.Router\.Locator$", false, null),
              new Property(@"^IceBox\.ServiceManager\.Router\.Router$", false, null),
              new Property(@"^IceBox\.ServiceManager\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.Router\.Coalesce$", false, null),
              new Property(@"^IceBox\.ServiceManager\.Router$", false, null),
              new Property(@"^IceBox\.ServiceManager\.ProxyOptions$", false, null),
              new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Size$", false, null),
@@ -205,6 +283,24 @@ namespace IceInternal
              new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceBox\.ServiceManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceBox\.ServiceManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceBox\.ServiceManager\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceBox\.Trace\.ServiceObserver$", false, null),
              new Property(@"^IceBox\.UseSharedCommunicator\.[^\s]+$", false, null),
              null
@@ -219,6 +315,7 @@ namespace IceInternal
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Locator$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Router$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.CollocationOptimized$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Coalesce$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy$", false, null),
              null
         };
@@ -247,6 +344,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.Coalesce$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.PublishedEndpoints$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ReplicaGroupId$", false, null),
@@ -257,6 +355,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.Coalesce$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ProxyOptions$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Size$", false, null),
@@ -266,6 +365,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM$", false, null),
              new Property(@"^IceGrid\.Node\.AdapterId$", false, null),
@@ -277,6 +394,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Node\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.PublishedEndpoints$", false, null),
              new Property(@"^IceGrid\.Node\.ReplicaGroupId$", false, null),
@@ -287,6 +405,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Node\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.ProxyOptions$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.Size$", false, null),
@@ -296,6 +415,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
              new Property(@"^IceGrid\.Node\.CollocateRegistry$", false, null),
@@ -320,6 +457,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper$", false, null),
              new Property(@"^IceGrid\.Node\.WaitTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminCryptPasswords$", false, null),
@@ -330,6 +468,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM$", false, null),
@@ -342,6 +481,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.PublishedEndpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ReplicaGroupId$", false, null),
@@ -352,6 +492,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ProxyOptions$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Size$", false, null),
@@ -361,6 +502,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.PreferSecure$", false, null),
@@ -368,6 +527,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.AdapterId$", false, null),
@@ -379,6 +539,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.PublishedEndpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ReplicaGroupId$", false, null),
@@ -389,6 +550,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ProxyOptions$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Size$", false, null),
@@ -398,6 +560,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.Data$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
@@ -412,6 +592,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.PublishedEndpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ReplicaGroupId$", false, null),
@@ -422,6 +603,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ProxyOptions$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Size$", false, null),
@@ -431,6 +613,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceGrid\.Registry\.NodeSessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ConnectionCached$", false, null),
@@ -439,6 +639,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier$", false, null),
              new Property(@"^IceGrid\.Registry\.ReplicaName$", false, null),
              new Property(@"^IceGrid\.Registry\.ReplicaSessionTimeout$", false, null),
@@ -454,6 +655,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.PublishedEndpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ReplicaGroupId$", false, null),
@@ -464,6 +666,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ProxyOptions$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Size$", false, null),
@@ -473,6 +676,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.AdapterId$", false, null),
@@ -484,6 +705,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.PublishedEndpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ReplicaGroupId$", false, null),
@@ -494,6 +716,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ProxyOptions$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Size$", false, null),
@@ -503,6 +726,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionCached$", false, null),
@@ -511,6 +752,7 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Coalesce$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier$", false, null),
              new Property(@"^IceGrid\.Registry\.Trace\.Application$", false, null),
              new Property(@"^IceGrid\.Registry\.Trace\.Adapter$", false, null),
@@ -547,6 +789,7 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Locator\.Locator$", false, null),
              new Property(@"^IcePatch2\.Locator\.Router$", false, null),
              new Property(@"^IcePatch2\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^IcePatch2\.Locator\.Coalesce$", false, null),
              new Property(@"^IcePatch2\.Locator$", false, null),
              new Property(@"^IcePatch2\.PublishedEndpoints$", false, null),
              new Property(@"^IcePatch2\.ReplicaGroupId$", false, null),
@@ -557,6 +800,7 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Router\.Locator$", false, null),
              new Property(@"^IcePatch2\.Router\.Router$", false, null),
              new Property(@"^IcePatch2\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^IcePatch2\.Router\.Coalesce$", false, null),
              new Property(@"^IcePatch2\.Router$", false, null),
              new Property(@"^IcePatch2\.ProxyOptions$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.Size$", false, null),
@@ -566,6 +810,24 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^IcePatch2\.ChunkSize$", true, @"IcePatch2Client.ChunkSize"),
              new Property(@"^IcePatch2\.Directory$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
@@ -644,6 +906,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.Coalesce$", false, null),
              new Property(@"^Glacier2\.Client\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.PublishedEndpoints$", false, null),
              new Property(@"^Glacier2\.Client\.ReplicaGroupId$", false, null),
@@ -654,6 +917,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.Coalesce$", false, null),
              new Property(@"^Glacier2\.Client\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.ProxyOptions$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.Size$", false, null),
@@ -663,6 +927,24 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
              new Property(@"^Glacier2\.Client\.ForwardContext$", false, null),
@@ -686,6 +968,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.Coalesce$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier$", false, null),
              new Property(@"^Glacier2\.ReturnClientProxy$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
@@ -695,6 +978,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.Coalesce$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier$", false, null),
              new Property(@"^Glacier2\.RoutingTable\.MaxSize$", false, null),
              new Property(@"^Glacier2\.Server\.ACM$", false, null),
@@ -707,6 +991,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.Coalesce$", false, null),
              new Property(@"^Glacier2\.Server\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.PublishedEndpoints$", false, null),
              new Property(@"^Glacier2\.Server\.ReplicaGroupId$", false, null),
@@ -717,6 +1002,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.Coalesce$", false, null),
              new Property(@"^Glacier2\.Server\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.ProxyOptions$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.Size$", false, null),
@@ -726,6 +1012,24 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Affinity$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.PinThreads$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.BusyPoll$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.BusyPollSocket$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.NUMA$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.NUMAIncoming$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.Size$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.SizeMax$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.SizeWarn$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.StackSize$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.Serialize$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.ThreadIdleTime$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.Affinity$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.PinThreads$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.BusyPoll$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactor\.BusyPollSocket$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
              new Property(@"^Glacier2\.Server\.ForwardContext$", false, null),
@@ -739,6 +1043,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.SessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SessionManager\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.Coalesce$", false, null),
              new Property(@"^Glacier2\.SessionManager$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.EndpointSelection$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.ConnectionCached$", false, null),
@@ -747,6 +1052,7 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLSessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.CollocationOptimized$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.Coalesce$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager$", false, null),
              new Property(@"^Glacier2\.SessionTimeout$", false, null),
              new Property(@"^Glacier2\.Trace\.RoutingTable$", false, null),
@@ -189,6 +189,15 @@ namespace IceInternal
                 throw ex;
             }
 
+            //
+            // A request rejected because the send queue of the connection is
+            // full would be rejected again, the application must pace itself.
+            //
+            if(ex is Ice.SendQueueFullException)
+            {
+                throw ex;
+            }
+
             ++cnt;
             Debug.Assert(cnt > 0);
 
@@ -208,6 +208,7 @@ public class ConnectionObserverI : ObserverI , Ice.Instrumentation.ConnectionObs
             base.reset();
             received = 0;
             sent = 0;
+            queued = 0;
         }
     }
 
@@ -228,9 +229,19 @@ public class ConnectionObserverI : ObserverI , Ice.Instrumentation.ConnectionObs
             received += s;
         }
     }
+
+    public void 
+    queuedBytes(int s)
+    {
+        lock(this)
+        {
+            queued += s;
+        }
+    }
     
     public int sent;
     public int received;
+    public int queued;
 };
 
 public class ThreadObserverI : ObserverI , Ice.Instrumentation.ThreadObserver
@@ -323,6 +323,12 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         //
         _transceiver.checkSendSize(os.getBuffer(), _instance.messageSizeMax());
 
+        //
+        // Synchronous requests wait for the send queue to drain with the
+        // Block policy.
+        //
+        checkSendQueue(os.size(), true);
+
         if(response)
         {
             //
@@ -354,6 +360,7 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         try
         {
             OutgoingMessage message = new OutgoingMessage(out, out.os(), compress, requestId);
+            message.oneway = !response;
             sent = (sendMessage(message) & IceInternal.AsyncStatus.Sent) > 0;
         }
         catch(Ice.LocalException ex)
@@ -400,6 +407,12 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         //
         _transceiver.checkSendSize(os.getBuffer(), _instance.messageSizeMax());
 
+        //
+        // Asynchronous requests can't wait, they fail with
+        // SendQueueFullException with the Block policy.
+        //
+        checkSendQueue(os.size(), false);
+
         if(response)
         {
             //
@@ -425,7 +438,9 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         int status;
         try
         {
-            status = sendMessage(new OutgoingMessage(out, out.__getOs(), compress, requestId));
+            OutgoingMessage message = new OutgoingMessage(out, out.__getOs(), compress, requestId);
+            message.oneway = !response;
+            status = sendMessage(message);
         }
         catch(Ice.LocalException ex)
         {
@@ -1360,6 +1375,12 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         
         if(!_sendStreams.isEmpty())
         {
+            if(_observer != null && _sendQueueSize > 0)
+            {
+                _observer.queuedBytes(-_sendQueueSize);
+            }
+            _sendQueueSize = 0;
+
             if(!_writeStream.isEmpty())
             {
                 //
@@ -1477,6 +1498,18 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         return initConnectionInfo();
     }
 
+    public synchronized void
+    setWritableCallback(ConnectionWritableCallback callback)
+    {
+        _writableCallback = callback;
+    }
+
+    public synchronized boolean
+    isWritable()
+    {
+        return !_sendQueueFull;
+    }
+
     public String
     _toString()
     {
@@ -1557,6 +1590,28 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         _dispatchCount = 0;
         _state = StateNotInitialized;
 
+        _sendQueueMaxSize = Math.max(0, initData.properties.getPropertyAsInt("Ice.SendQueue.MaxSize"));
+        _sendQueueMaxMessages = Math.max(0, initData.properties.getPropertyAsInt("Ice.SendQueue.MaxMessages"));
+        String policy = initData.properties.getPropertyWithDefault("Ice.SendQueue.Policy", "Block");
+        if(policy.equals("Fail"))
+        {
+            _sendQueuePolicy = SendQueuePolicyFail;
+        }
+        else if(policy.equals("DropOldest"))
+        {
+            _sendQueuePolicy = SendQueuePolicyDropOldest;
+        }
+        else
+        {
+            if(!policy.equals("Block"))
+            {
+                _logger.warning("invalid value for Ice.SendQueue.Policy: `" + policy + "'; using Block");
+            }
+            _sendQueuePolicy = SendQueuePolicyBlock;
+        }
+        _sendQueueSize = 0;
+        _sendQueueFull = false;
+
         int compressionLevel = initData.properties.getPropertyAsIntWithDefault("Ice.Compression.Level", 1);
         if(compressionLevel < 1)
         {
@@ -1645,6 +1700,10 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
     private static final int StateClosed = 5;
     private static final int StateFinished = 6;
 
+    private static final int SendQueuePolicyBlock = 0;
+    private static final int SendQueuePolicyFail = 1;
+    private static final int SendQueuePolicyDropOldest = 2;
+
     private void
     setState(int state, LocalException ex)
     {
@@ -1837,6 +1896,13 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
             Ice.Instrumentation.ConnectionState newState = toConnectionState(state);
             if(oldState != newState)
             {
+                //
+                // Move the queued bytes to the observer of the new state.
+                //
+                if(_observer != null && _sendQueueSize > 0)
+                {
+                    _observer.queuedBytes(-_sendQueueSize);
+                }
                 _observer = _instance.getObserver().getConnectionObserver(initConnectionInfo(),
                                                                           _endpoint, 
                                                                           newState,
@@ -1844,6 +1910,10 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
                 if(_observer != null)
                 {
                     _observer.attach();
+                    if(_sendQueueSize > 0)
+                    {
+                        _observer.queuedBytes(_sendQueueSize);
+                    }
                 }
                 else
                 {
@@ -2068,6 +2138,7 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
                     callbacks.add(message);
                 }
                 _sendStreams.removeFirst();
+                messageDequeued(message.size);
 
                 //
                 // If there's nothing left to send, we're done.
@@ -2154,10 +2225,12 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
     sendMessage(OutgoingMessage message)
     {
         assert(_state < StateClosed);
+        message.size = message.stream.size();
         if(!_sendStreams.isEmpty())
         {
             message.adopt();
             _sendStreams.addLast(message);
+            messageQueued(message.size);
             return IceInternal.AsyncStatus.Queued;
         }
 
@@ -2209,11 +2282,205 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
 
         _writeStream.swap(message.stream);
         _sendStreams.addLast(message);
+        messageQueued(message.size);
         scheduleTimeout(IceInternal.SocketOperation.Write, _endpoint.timeout());
         _threadPool.register(this, IceInternal.SocketOperation.Write);
         return IceInternal.AsyncStatus.Queued;
     }
 
+    private void
+    checkSendQueue(int size, boolean block)
+        throws IceInternal.LocalExceptionWrapper
+    {
+        if(!sendQueueFull(size))
+        {
+            return;
+        }
+
+        _sendQueueFull = true;
+        switch(_sendQueuePolicy)
+        {
+            case SendQueuePolicyBlock:
+            {
+                if(!block)
+                {
+                    throw new SendQueueFullException();
+                }
+
+                //
+                // The queue is drained by the thread pool of the
+                // connection, a thread of this thread pool can't wait
+                // for it. Even if the thread pool has other threads,
+                // they might all be waiting for the queue to drain.
+                //
+                if(_threadPool.isPoolThread())
+                {
+                    throw new SendQueueFullException();
+                }
+
+                while(sendQueueFull(size) && _exception == null)
+                {
+                    _sendQueueFull = true;
+                    try
+                    {
+                        wait();
+                    }
+                    catch(InterruptedException ex)
+                    {
+                    }
+                }
+                if(_exception != null)
+                {
+                    //
+                    // The request wasn't sent, it can be retried.
+                    //
+                    throw new IceInternal.LocalExceptionWrapper((Ice.LocalException)_exception.fillInStackTrace(),
+                                                                true);
+                }
+                break;
+            }
+
+            case SendQueuePolicyDropOldest:
+            {
+                while(sendQueueFull(size) && dropOldestOneway())
+                {
+                }
+                if(sendQueueFull(size))
+                {
+                    throw new SendQueueFullException();
+                }
+                break;
+            }
+
+            case SendQueuePolicyFail:
+            {
+                throw new SendQueueFullException();
+            }
+        }
+    }
+
+    private boolean
+    sendQueueFull(int size)
+    {
+        //
+        // A message is always accepted by an empty queue, even if it's
+        // larger than the limit.
+        //
+        if(_sendStreams.isEmpty())
+        {
+            return false;
+        }
+        return (_sendQueueMaxSize > 0 && _sendQueueSize + size > _sendQueueMaxSize) ||
+               (_sendQueueMaxMessages > 0 && _sendStreams.size() >= _sendQueueMaxMessages);
+    }
+
+    private boolean
+    dropOldestOneway()
+    {
+        //
+        // The first message is being sent, only oneway requests which
+        // aren't prepared yet can be dropped. Batch request flushes are
+        // never dropped.
+        //
+        java.util.Iterator<OutgoingMessage> p = _sendStreams.iterator();
+        p.next();
+        while(p.hasNext())
+        {
+            final OutgoingMessage message = p.next();
+            if(message.oneway && !message.prepared)
+            {
+                p.remove();
+                messageDequeued(message.size);
+                if(message.outAsync != null)
+                {
+                    //
+                    // The callbacks can't be called with the connection
+                    // locked.
+                    //
+                    try
+                    {
+                        _threadPool.execute(new IceInternal.DispatchWorkItem(_instance)
+                            {
+                                public void
+                                run()
+                                {
+                                    message.finished(new SendQueueFullException());
+                                }
+                            });
+                    }
+                    catch(CommunicatorDestroyedException ex)
+                    {
+                    }
+                }
+                else
+                {
+                    message.finished(new SendQueueFullException());
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    private void
+    messageQueued(int size)
+    {
+        _sendQueueSize += size;
+        if(_observer != null)
+        {
+            _observer.queuedBytes(size);
+        }
+    }
+
+    private void
+    messageDequeued(int size)
+    {
+        assert(_sendQueueSize >= size);
+        _sendQueueSize -= size;
+        if(_observer != null)
+        {
+            _observer.queuedBytes(-size);
+        }
+
+        if(_sendQueueFull &&
+           (_sendQueueMaxSize == 0 || _sendQueueSize <= _sendQueueMaxSize / 2) &&
+           (_sendQueueMaxMessages == 0 || _sendStreams.size() <= _sendQueueMaxMessages / 2))
+        {
+            _sendQueueFull = false;
+            notifyAll(); // Notify the threads waiting for the queue to drain.
+            if(_writableCallback != null)
+            {
+                final ConnectionWritableCallback callback = _writableCallback;
+                try
+                {
+                    _threadPool.execute(new IceInternal.DispatchWorkItem(_instance)
+                        {
+                            public void
+                            run()
+                            {
+                                try
+                                {
+                                    callback.writable(ConnectionI.this);
+                                }
+                                catch(java.lang.Exception ex)
+                                {
+                                    java.io.StringWriter sw = new java.io.StringWriter();
+                                    java.io.PrintWriter pw = new java.io.PrintWriter(sw);
+                                    ex.printStackTrace(pw);
+                                    pw.flush();
+                                    _logger.warning("connection writable callback exception:\n" + sw.toString() +
+                                                    '\n' + _desc);
+                                }
+                            }
+                        });
+                }
+                catch(CommunicatorDestroyedException ex)
+                {
+                }
+            }
+        }
+    }
+
     private IceInternal.BasicStream
     doCompress(IceInternal.BasicStream uncompressed, boolean compress)
     {
@@ -2850,6 +3117,8 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
         boolean adopt;
         boolean prepared;
         boolean isSent;
+        int size; // The size of the message in the send queue.
+        boolean oneway; // True for oneway requests, they can be dropped from a full send queue.
     }
 
     private Communicator _communicator;
@@ -2903,6 +3172,13 @@ public final class ConnectionI extends IceInternal.EventHandler implements Conne
 
     private java.util.LinkedList<OutgoingMessage> _sendStreams = new java.util.LinkedList<OutgoingMessage>();
 
+    private final int _sendQueueMaxSize; // 0 if the size of the send queue isn't limited.
+    private final int _sendQueueMaxMessages; // 0 if the number of queued messages isn't limited.
+    private final int _sendQueuePolicy;
+    private int _sendQueueSize; // The number of bytes in _sendStreams.
+    private boolean _sendQueueFull; // True once the limits are reached, until the queue drains below half.
+    private ConnectionWritableCallback _writableCallback;
+
     private IceInternal.BasicStream _readStream;
     private boolean _readHeader;
     private IceInternal.BasicStream _writeStream;
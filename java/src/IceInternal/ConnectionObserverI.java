@@ -35,6 +35,17 @@ public class ConnectionObserverI
         }
     }
 
+    public void 
+    queuedBytes(int num)
+    {
+        _queuedBytes = num;
+        forEach(_queuedBytesUpdate);
+        if(_delegate != null)
+        {
+            _delegate.queuedBytes(num);
+        }
+    }
+
     private MetricsUpdate<IceMX.ConnectionMetrics> _sentBytesUpdate = new MetricsUpdate<IceMX.ConnectionMetrics>()
         {
             public void
@@ -53,6 +64,16 @@ public class ConnectionObserverI
             }
         };
 
+    private MetricsUpdate<IceMX.ConnectionMetrics> _queuedBytesUpdate = new MetricsUpdate<IceMX.ConnectionMetrics>()
+        {
+            public void
+            update(IceMX.ConnectionMetrics v)
+            {
+                v.setQueuedBytes((v.hasQueuedBytes() ? v.getQueuedBytes() : 0) + _queuedBytes);
+            }
+        };
+
     private int _sentBytes;
     private int _receivedBytes;
+    private int _queuedBytes;
 }
\ No newline at end of file
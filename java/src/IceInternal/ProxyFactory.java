@@ -203,6 +203,15 @@ public final class ProxyFactory
             throw ex;
         }
 
+        //
+        // A request rejected because the send queue of the connection is
+        // full would be rejected again, the application must pace itself.
+        //
+        if(ex instanceof Ice.SendQueueFullException)
+        {
+            throw ex;
+        }
+
         ++cnt;
         assert(cnt > 0);
 
@@ -307,6 +307,25 @@ public final class ThreadPool
         return _prefix;
     }
 
+    //
+    // Returns true if the calling thread is a thread of this thread
+    // pool. Such a thread can't wait for an event handled by this
+    // thread pool: all the threads of the thread pool might be
+    // waiting.
+    //
+    public synchronized boolean
+    isPoolThread()
+    {
+        for(EventHandlerThread thread : _threads)
+        {
+            if(thread._thread == Thread.currentThread())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     private void
     run(EventHandlerThread thread)
     {
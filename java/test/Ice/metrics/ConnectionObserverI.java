@@ -17,6 +17,7 @@ class ConnectionObserverI extends ObserverI implements Ice.Instrumentation.Conne
         super.reset();
         received = 0;
         sent = 0;
+        queued = 0;
     }
 
     public synchronized void 
@@ -30,8 +31,15 @@ class ConnectionObserverI extends ObserverI implements Ice.Instrumentation.Conne
     {
         received += s;
     }
+
+    public synchronized void 
+    queuedBytes(int s)
+    {
+        queued += s;
+    }
     
     int sent;
     int received;
+    int queued;
 };
 